@@ -158,6 +158,10 @@ if("${CMAKE_SOURCE_DIR}" STREQUAL "${CMAKE_CURRENT_SOURCE_DIR}")
 
   define_option(ARROW_HIVESERVER2 "Build the HiveServer2 client and Arrow adapter" OFF)
 
+  define_option(ARROW_IO_URING
+                "Build the io_uring local file reader (Linux only, requires linux/io_uring.h)"
+                OFF)
+
   define_option(ARROW_IPC "Build the Arrow IPC extensions" ON)
 
   define_option(ARROW_JEMALLOC "Build the Arrow jemalloc-based allocator" ON)
@@ -20,6 +20,8 @@
 include(CheckCXXCompilerFlag)
 # x86/amd64 compiler flags
 check_cxx_compiler_flag("-msse4.2" CXX_SUPPORTS_SSE4_2)
+check_cxx_compiler_flag("-mavx2" CXX_SUPPORTS_AVX2)
+check_cxx_compiler_flag("-mavx512f" CXX_SUPPORTS_AVX512)
 # power compiler flags
 check_cxx_compiler_flag("-maltivec" CXX_SUPPORTS_ALTIVEC)
 # Arm64 compiler flags
@@ -276,6 +278,21 @@ if(ARROW_USE_SIMD)
   add_definitions(-DARROW_USE_SIMD)
 endif()
 
+# Kernels which are dispatched at runtime based on CpuInfo are compiled with
+# these flags on a per-file basis, without affecting the rest of the build
+if(ARROW_USE_SIMD AND NOT MSVC)
+  if(CXX_SUPPORTS_AVX2)
+    set(ARROW_HAVE_RUNTIME_AVX2 ON)
+    set(ARROW_AVX2_FLAG "-mavx2")
+    add_definitions(-DARROW_HAVE_RUNTIME_AVX2)
+  endif()
+  if(CXX_SUPPORTS_AVX512)
+    set(ARROW_HAVE_RUNTIME_AVX512 ON)
+    set(ARROW_AVX512_FLAG "-mavx512f")
+    add_definitions(-DARROW_HAVE_RUNTIME_AVX512)
+  endif()
+endif()
+
 # ----------------------------------------------------------------------
 # Setup Gold linker, if available. Code originally from Apache Kudu
 
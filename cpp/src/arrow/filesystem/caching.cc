@@ -0,0 +1,697 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/caching.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace fs {
+
+namespace {
+
+const char kBlockSuffix[] = ".block";
+
+bool HasBlockSuffix(const std::string& path) {
+  const size_t suffix_length = sizeof(kBlockSuffix) - 1;
+  return path.size() > suffix_length &&
+         path.compare(path.size() - suffix_length, suffix_length, kBlockSuffix) == 0;
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Block cache, shared by the filesystem and the files it opened
+
+class CachingFileSystem::Impl {
+ public:
+  explicit Impl(const CachingOptions& options) : options_(options) {
+    if (!options_.disk_cache_dir.empty()) {
+      Status st = InitDiskCache();
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "Disabling disk cache in '" << options_.disk_cache_dir
+                           << "': " << st.ToString();
+        disk_enabled_ = false;
+      }
+    }
+  }
+
+  const CachingOptions& options() const { return options_; }
+
+  // Identifies the contents of a file. Writes through the filesystem bump
+  // the generation of their path, or the epoch for directory operations.
+  // Those only live in this process, so they are left out of the disk keys:
+  // the disk blocks of a path are deleted instead when its generation changes
+  struct FileKey {
+    std::string path;
+    // Path, size and modification time
+    std::string stats;
+    uint64_t epoch;
+    uint64_t generation;
+  };
+
+  FileKey MakeFileKey(const FileStats& stats) {
+    std::stringstream ss;
+    ss << stats.path() << '\n' << stats.size() << '\n'
+       << stats.mtime().time_since_epoch().count() << '\n';
+    std::lock_guard<std::mutex> lock(generation_mutex_);
+    auto it = generations_.find(stats.path());
+    return FileKey{stats.path(), ss.str(), epoch_,
+                   it == generations_.end() ? 0 : it->second};
+  }
+
+  void Invalidate(const std::string& path) {
+    {
+      std::lock_guard<std::mutex> lock(generation_mutex_);
+      ++generations_[path];
+    }
+    if (disk_enabled_) {
+      std::lock_guard<std::mutex> lock(disk_mutex_);
+      DeleteDiskBlocks(DiskBlockPrefix(path));
+    }
+  }
+
+  void InvalidateAll() {
+    {
+      std::lock_guard<std::mutex> lock(generation_mutex_);
+      ++epoch_;
+      generations_.clear();
+    }
+    if (disk_enabled_) {
+      std::lock_guard<std::mutex> lock(disk_mutex_);
+      DeleteDiskBlocks("");
+    }
+  }
+
+  // Look a block up in memory, then on disk. *out is null if not found
+  void GetBlock(const FileKey& file, int64_t index, std::shared_ptr<Buffer>* out) {
+    const std::string key = MemoryKey(file, index);
+    {
+      std::lock_guard<std::mutex> lock(memory_mutex_);
+      auto it = memory_index_.find(key);
+      if (it != memory_index_.end()) {
+        memory_lru_.splice(memory_lru_.begin(), memory_lru_, it->second);
+        *out = it->second->second;
+        ++statistics_.memory_hits;
+        return;
+      }
+    }
+    out->reset();
+    if (disk_enabled_ && ReadDiskBlock(file, index, out)) {
+      ++statistics_.disk_hits;
+      PutMemoryBlock(key, *out);
+    }
+  }
+
+  // Cache a copy of the given data, so that the cache only ever holds the
+  // memory it accounts for
+  Status PutBlock(const FileKey& file, int64_t index, const Buffer& data,
+                  std::shared_ptr<Buffer>* out) {
+    std::shared_ptr<Buffer> block;
+    RETURN_NOT_OK(AllocateBuffer(options_.pool, data.size(), &block));
+    std::memcpy(block->mutable_data(), data.data(), static_cast<size_t>(data.size()));
+    ++statistics_.misses;
+    PutMemoryBlock(MemoryKey(file, index), block);
+    if (disk_enabled_) {
+      Status st = WriteDiskBlock(file, index, *block);
+      if (!st.ok()) {
+        ARROW_LOG(WARNING) << "Failed writing cached block to disk: " << st.ToString();
+      }
+    }
+    *out = std::move(block);
+    return Status::OK();
+  }
+
+  CacheStatistics statistics() const {
+    CacheStatistics out;
+    out.memory_hits = statistics_.memory_hits;
+    out.disk_hits = statistics_.disk_hits;
+    out.misses = statistics_.misses;
+    return out;
+  }
+
+ private:
+  using MemoryEntry = std::pair<std::string, std::shared_ptr<Buffer>>;
+
+  struct AtomicStatistics {
+    std::atomic<int64_t> memory_hits{0};
+    std::atomic<int64_t> disk_hits{0};
+    std::atomic<int64_t> misses{0};
+  };
+
+  struct DiskEntry {
+    std::list<std::string>::iterator lru_position;
+    int64_t size;
+  };
+
+  static std::string MemoryKey(const FileKey& file, int64_t index) {
+    std::stringstream ss;
+    ss << file.stats << file.epoch << '.' << file.generation << '\n' << index;
+    return ss.str();
+  }
+
+  static std::string DiskKey(const FileKey& file, int64_t index) {
+    return file.stats + std::to_string(index);
+  }
+
+  bool IsCurrent(const FileKey& file) {
+    std::lock_guard<std::mutex> lock(generation_mutex_);
+    auto it = generations_.find(file.path);
+    return file.epoch == epoch_ &&
+           file.generation == (it == generations_.end() ? 0 : it->second);
+  }
+
+  void PutMemoryBlock(const std::string& key, const std::shared_ptr<Buffer>& block) {
+    if (block->size() > options_.memory_capacity) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(memory_mutex_);
+    auto it = memory_index_.find(key);
+    if (it != memory_index_.end()) {
+      memory_size_ -= it->second->second->size();
+      memory_lru_.erase(it->second);
+      memory_index_.erase(it);
+    }
+    memory_lru_.emplace_front(key, block);
+    memory_index_[key] = memory_lru_.begin();
+    memory_size_ += block->size();
+    while (memory_size_ > options_.memory_capacity) {
+      const MemoryEntry& victim = memory_lru_.back();
+      memory_size_ -= victim.second->size();
+      memory_index_.erase(victim.first);
+      memory_lru_.pop_back();
+    }
+  }
+
+  // Disk blocks are indexed by file name, named after a hash of their path
+  // then a hash of their key
+  static std::string DiskBlockPrefix(const std::string& path) {
+    std::stringstream ss;
+    ss << std::hex << std::hash<std::string>()(path) << '-';
+    return ss.str();
+  }
+
+  static std::string DiskBlockName(const FileKey& file, const std::string& key) {
+    std::stringstream ss;
+    ss << DiskBlockPrefix(file.path) << std::hex << std::hash<std::string>()(key)
+       << kBlockSuffix;
+    return ss.str();
+  }
+
+  std::string DiskPath(const std::string& name) const {
+    return internal::ConcatAbstractPath(options_.disk_cache_dir, name);
+  }
+
+  // Index the blocks already present in the cache directory, most recent first
+  Status InitDiskCache() {
+    RETURN_NOT_OK(local_fs_.CreateDir(options_.disk_cache_dir));
+    Selector select;
+    select.base_dir = options_.disk_cache_dir;
+    std::vector<FileStats> stats;
+    RETURN_NOT_OK(local_fs_.GetTargetStats(select, &stats));
+    std::sort(stats.begin(), stats.end(), [](const FileStats& a, const FileStats& b) {
+      return a.mtime() > b.mtime();
+    });
+    for (const auto& st : stats) {
+      if (st.IsFile() && HasBlockSuffix(st.path())) {
+        AddDiskEntry(st.base_name(), st.size(), /*most_recent=*/false);
+      }
+    }
+    EvictDiskBlocks();
+    return Status::OK();
+  }
+
+  // The following disk index functions must be called with disk_mutex_ held,
+  // except in InitDiskCache()
+
+  void AddDiskEntry(const std::string& name, int64_t size, bool most_recent) {
+    auto position = most_recent ? disk_lru_.insert(disk_lru_.begin(), name)
+                                : disk_lru_.insert(disk_lru_.end(), name);
+    disk_index_[name] = DiskEntry{position, size};
+    disk_size_ += size;
+  }
+
+  void RemoveDiskEntry(const std::string& name) {
+    auto it = disk_index_.find(name);
+    if (it != disk_index_.end()) {
+      disk_size_ -= it->second.size;
+      disk_lru_.erase(it->second.lru_position);
+      disk_index_.erase(it);
+    }
+  }
+
+  void DeleteDiskBlocks(const std::string& prefix) {
+    std::vector<std::string> victims;
+    for (const auto& entry : disk_index_) {
+      if (entry.first.compare(0, prefix.size(), prefix) == 0) {
+        victims.push_back(entry.first);
+      }
+    }
+    for (const auto& victim : victims) {
+      RemoveDiskEntry(victim);
+      ARROW_UNUSED(local_fs_.DeleteFile(DiskPath(victim)));
+    }
+  }
+
+  void EvictDiskBlocks() {
+    while (disk_size_ > options_.disk_capacity && !disk_lru_.empty()) {
+      const std::string victim = disk_lru_.back();
+      RemoveDiskEntry(victim);
+      ARROW_UNUSED(local_fs_.DeleteFile(DiskPath(victim)));
+    }
+  }
+
+  // A disk block is a 32-bit key length, the key, then the block data
+  bool ReadDiskBlock(const FileKey& file, int64_t index, std::shared_ptr<Buffer>* out) {
+    const std::string key = DiskKey(file, index);
+    const std::string name = DiskBlockName(file, key);
+    {
+      std::lock_guard<std::mutex> lock(disk_mutex_);
+      auto it = disk_index_.find(name);
+      if (it == disk_index_.end()) {
+        return false;
+      }
+      disk_lru_.splice(disk_lru_.begin(), disk_lru_, it->second.lru_position);
+    }
+    std::shared_ptr<io::RandomAccessFile> disk_file;
+    std::string header(sizeof(uint32_t) + key.size(), '\0');
+    std::shared_ptr<Buffer> block;
+    int64_t size = 0, bytes_read = 0;
+    Status st = local_fs_.OpenInputFile(DiskPath(name), &disk_file);
+    if (st.ok()) {
+      st = disk_file->GetSize(&size);
+    }
+    const int64_t header_size = static_cast<int64_t>(header.size());
+    if (st.ok() && size < header_size) {
+      st = Status::IOError("Truncated block");
+    }
+    if (st.ok()) {
+      st = disk_file->ReadAt(0, header_size, &bytes_read, &header[0]);
+    }
+    uint32_t key_length = 0;
+    std::memcpy(&key_length, header.data(), sizeof(key_length));
+    if (!st.ok() || bytes_read != header_size || key_length != key.size() ||
+        header.compare(sizeof(key_length), key.size(), key) != 0) {
+      // Unreadable block, or hash collision with another key
+      return false;
+    }
+    // Read the data into a buffer of its own
+    st = AllocateBuffer(options_.pool, size - header_size, &block);
+    if (st.ok()) {
+      st = disk_file->ReadAt(header_size, block->size(), &bytes_read,
+                             block->mutable_data());
+    }
+    if (st.ok()) {
+      st = disk_file->Close();
+    }
+    if (!st.ok() || bytes_read != block->size()) {
+      return false;
+    }
+    *out = std::move(block);
+    return true;
+  }
+
+  Status WriteDiskBlock(const FileKey& file, int64_t index, const Buffer& block) {
+    const std::string key = DiskKey(file, index);
+    const uint32_t key_length = static_cast<uint32_t>(key.size());
+    const int64_t size = sizeof(key_length) + key.size() + block.size();
+    if (size > options_.disk_capacity) {
+      return Status::OK();
+    }
+    const std::string name = DiskBlockName(file, key);
+    const std::string path = DiskPath(name);
+    std::stringstream ss;
+    ss << path << ".tmp" << temp_counter_++;
+    const std::string temp_path = ss.str();
+
+    // Write to a temporary file first, so that readers never see a partial block
+    std::shared_ptr<io::OutputStream> stream;
+    RETURN_NOT_OK(local_fs_.OpenOutputStream(temp_path, &stream));
+    RETURN_NOT_OK(stream->Write(&key_length, sizeof(key_length)));
+    RETURN_NOT_OK(stream->Write(key.data(), static_cast<int64_t>(key.size())));
+    RETURN_NOT_OK(stream->Write(block.data(), block.size()));
+    RETURN_NOT_OK(stream->Close());
+
+    std::lock_guard<std::mutex> lock(disk_mutex_);
+    if (!IsCurrent(file)) {
+      // The file was written to since it was read: its blocks were deleted
+      return local_fs_.DeleteFile(temp_path);
+    }
+    RETURN_NOT_OK(local_fs_.Move(temp_path, path));
+    RemoveDiskEntry(name);
+    AddDiskEntry(name, size, /*most_recent=*/true);
+    EvictDiskBlocks();
+    return Status::OK();
+  }
+
+  const CachingOptions options_;
+  AtomicStatistics statistics_;
+
+  std::mutex generation_mutex_;
+  uint64_t epoch_ = 0;
+  std::unordered_map<std::string, uint64_t> generations_;
+
+  std::mutex memory_mutex_;
+  std::list<MemoryEntry> memory_lru_;
+  std::unordered_map<std::string, std::list<MemoryEntry>::iterator> memory_index_;
+  int64_t memory_size_ = 0;
+
+  bool disk_enabled_ = !options_.disk_cache_dir.empty();
+  LocalFileSystem local_fs_;
+  std::mutex disk_mutex_;
+  std::list<std::string> disk_lru_;
+  std::unordered_map<std::string, DiskEntry> disk_index_;
+  int64_t disk_size_ = 0;
+  std::atomic<int64_t> temp_counter_{0};
+};
+
+namespace {
+
+// A file reading fixed-size blocks through the cache
+class CachedFile : public io::RandomAccessFile {
+ public:
+  CachedFile(std::shared_ptr<CachingFileSystem::Impl> cache,
+             std::shared_ptr<FileSystem> base_fs, const FileStats& stats)
+      : cache_(std::move(cache)),
+        base_fs_(std::move(base_fs)),
+        path_(stats.path()),
+        size_(stats.size()),
+        block_size_(cache_->options().block_size),
+        key_(cache_->MakeFileKey(stats)) {}
+
+  ~CachedFile() override { io::internal::CloseFromDestructor(this); }
+
+  Status Close() override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+    if (base_file_ != nullptr) {
+      auto base_file = std::move(base_file_);
+      return base_file->Close();
+    }
+    return Status::OK();
+  }
+
+  bool closed() const override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+
+  Status Tell(int64_t* position) const override {
+    RETURN_NOT_OK(CheckClosed());
+    *position = pos_;
+    return Status::OK();
+  }
+
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0 || position > size_) {
+      return Status::IOError("Seek out of bounds");
+    }
+    pos_ = position;
+    return Status::OK();
+  }
+
+  Status GetSize(int64_t* size) override {
+    RETURN_NOT_OK(CheckClosed());
+    *size = size_;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
+    RETURN_NOT_OK(ReadAt(pos_, nbytes, bytes_read, out));
+    pos_ += *bytes_read;
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    RETURN_NOT_OK(ReadAt(pos_, nbytes, out));
+    pos_ += (*out)->size();
+    return Status::OK();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override {
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(ReadAt(position, nbytes, &buffer));
+    std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+    *bytes_read = buffer->size();
+    return Status::OK();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0) {
+      return Status::Invalid("Cannot read from negative position");
+    }
+    if (nbytes < 0) {
+      return Status::Invalid("Negative read size: ", nbytes);
+    }
+    nbytes = std::min(nbytes, std::max<int64_t>(size_ - position, 0));
+    if (nbytes == 0) {
+      *out = std::make_shared<Buffer>(nullptr, 0);
+      return Status::OK();
+    }
+
+    const int64_t first_block = position / block_size_;
+    const int64_t last_block = (position + nbytes - 1) / block_size_;
+    std::vector<std::shared_ptr<Buffer>> blocks;
+    RETURN_NOT_OK(GetBlocks(first_block, last_block, &blocks));
+
+    const int64_t offset = position - first_block * block_size_;
+    if (blocks.size() == 1) {
+      // Zero-copy slice of the cached block
+      *out = SliceBuffer(blocks[0], offset, nbytes);
+      return Status::OK();
+    }
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(AllocateBuffer(cache_->options().pool, nbytes, &buffer));
+    int64_t copied = 0;
+    for (const auto& block : blocks) {
+      const int64_t start = copied == 0 ? offset : 0;
+      const int64_t length = std::min(block->size() - start, nbytes - copied);
+      std::memcpy(buffer->mutable_data() + copied, block->data() + start,
+                  static_cast<size_t>(length));
+      copied += length;
+    }
+    DCHECK_EQ(copied, nbytes);
+    *out = std::move(buffer);
+    return Status::OK();
+  }
+
+ private:
+  Status CheckClosed() const {
+    if (closed()) {
+      return Status::Invalid("Operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  int64_t BlockLength(int64_t block_index) const {
+    return std::min(block_size_, size_ - block_index * block_size_);
+  }
+
+  Status GetBaseFile(std::shared_ptr<io::RandomAccessFile>* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_) {
+      return Status::Invalid("Operation on closed file");
+    }
+    if (base_file_ == nullptr) {
+      RETURN_NOT_OK(base_fs_->OpenInputFile(path_, &base_file_));
+    }
+    *out = base_file_;
+    return Status::OK();
+  }
+
+  // Get the blocks from first to last, reading each run of consecutive
+  // missing blocks with a single read of the underlying file
+  Status GetBlocks(int64_t first, int64_t last,
+                   std::vector<std::shared_ptr<Buffer>>* out) {
+    std::vector<std::shared_ptr<Buffer>> blocks(last - first + 1);
+    for (int64_t i = first; i <= last; ++i) {
+      cache_->GetBlock(key_, i, &blocks[i - first]);
+    }
+    int64_t i = first;
+    while (i <= last) {
+      if (blocks[i - first] != nullptr) {
+        ++i;
+        continue;
+      }
+      int64_t run_end = i;
+      while (run_end < last && blocks[run_end + 1 - first] == nullptr) {
+        ++run_end;
+      }
+      const int64_t run_start = i * block_size_;
+      const int64_t run_length =
+          (run_end - i) * block_size_ + BlockLength(run_end);
+
+      std::shared_ptr<io::RandomAccessFile> base_file;
+      RETURN_NOT_OK(GetBaseFile(&base_file));
+      std::shared_ptr<Buffer> data;
+      RETURN_NOT_OK(base_file->ReadAt(run_start, run_length, &data));
+      if (data->size() != run_length) {
+        return Status::IOError("File '", path_, "' changed while reading: expected ",
+                               run_length, " bytes at offset ", run_start, ", got ",
+                               data->size());
+      }
+      for (int64_t j = i; j <= run_end; ++j) {
+        const Buffer block(data, (j - i) * block_size_, BlockLength(j));
+        RETURN_NOT_OK(cache_->PutBlock(key_, j, block, &blocks[j - first]));
+      }
+      i = run_end + 1;
+    }
+    *out = std::move(blocks);
+    return Status::OK();
+  }
+
+  std::shared_ptr<CachingFileSystem::Impl> cache_;
+  std::shared_ptr<FileSystem> base_fs_;
+  const std::string path_;
+  const int64_t size_;
+  const int64_t block_size_;
+  const CachingFileSystem::Impl::FileKey key_;
+
+  mutable std::mutex mutex_;
+  bool closed_ = false;
+  std::shared_ptr<io::RandomAccessFile> base_file_;
+  int64_t pos_ = 0;
+};
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// CachingFileSystem implementation
+
+CachingFileSystem::CachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                     const CachingOptions& options)
+    : base_fs_(std::move(base_fs)), impl_(std::make_shared<Impl>(options)) {}
+
+CachingFileSystem::~CachingFileSystem() {}
+
+Status CachingFileSystem::Make(std::shared_ptr<FileSystem> base_fs,
+                               const CachingOptions& options,
+                               std::shared_ptr<CachingFileSystem>* out) {
+  if (options.block_size <= 0) {
+    return Status::Invalid("Cache block size must be positive, got ",
+                           options.block_size);
+  }
+  if (options.pool == nullptr) {
+    return Status::Invalid("Cache memory pool must not be null");
+  }
+  out->reset(new CachingFileSystem(std::move(base_fs), options));
+  return Status::OK();
+}
+
+CacheStatistics CachingFileSystem::statistics() const { return impl_->statistics(); }
+
+Status CachingFileSystem::GetTargetStats(const std::string& path, FileStats* out) {
+  return base_fs_->GetTargetStats(path, out);
+}
+
+Status CachingFileSystem::GetTargetStats(const Selector& select,
+                                         std::vector<FileStats>* out) {
+  return base_fs_->GetTargetStats(select, out);
+}
+
+Status CachingFileSystem::GetTargetStatsBatches(const Selector& select,
+                                                FileStatsIterator* out) {
+  return base_fs_->GetTargetStatsBatches(select, out);
+}
+
+Status CachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status CachingFileSystem::DeleteDir(const std::string& path) {
+  impl_->InvalidateAll();
+  return base_fs_->DeleteDir(path);
+}
+
+Status CachingFileSystem::DeleteDirContents(const std::string& path) {
+  impl_->InvalidateAll();
+  return base_fs_->DeleteDirContents(path);
+}
+
+Status CachingFileSystem::DeleteFile(const std::string& path) {
+  impl_->Invalidate(path);
+  return base_fs_->DeleteFile(path);
+}
+
+Status CachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  // Either may be a directory
+  impl_->InvalidateAll();
+  return base_fs_->Move(src, dest);
+}
+
+Status CachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  impl_->Invalidate(dest);
+  return base_fs_->CopyFile(src, dest);
+}
+
+Status CachingFileSystem::OpenInputStream(const std::string& path,
+                                          std::shared_ptr<io::InputStream>* out) {
+  std::shared_ptr<io::RandomAccessFile> file;
+  RETURN_NOT_OK(OpenInputFile(path, &file));
+  *out = std::move(file);
+  return Status::OK();
+}
+
+Status CachingFileSystem::OpenInputFile(const std::string& path,
+                                        std::shared_ptr<io::RandomAccessFile>* out) {
+  FileStats stats;
+  RETURN_NOT_OK(base_fs_->GetTargetStats(path, &stats));
+  if (!stats.IsFile() || stats.size() == kNoSize) {
+    // Let the underlying filesystem report errors, or read uncached if the
+    // file size is unknown
+    return base_fs_->OpenInputFile(path, out);
+  }
+  *out = std::make_shared<CachedFile>(impl_, base_fs_, stats);
+  return Status::OK();
+}
+
+Status CachingFileSystem::OpenOutputStream(const std::string& path,
+                                           std::shared_ptr<io::OutputStream>* out) {
+  impl_->Invalidate(path);
+  return base_fs_->OpenOutputStream(path, out);
+}
+
+Status CachingFileSystem::OpenAppendStream(const std::string& path,
+                                           std::shared_ptr<io::OutputStream>* out) {
+  impl_->Invalidate(path);
+  return base_fs_->OpenAppendStream(path, out);
+}
+
+}  // namespace fs
+}  // namespace arrow
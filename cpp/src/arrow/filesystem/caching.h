@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/memory_pool.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace fs {
+
+/// \brief EXPERIMENTAL: options for CachingFileSystem
+struct ARROW_EXPORT CachingOptions {
+  /// The size of the cached blocks. Reads from the underlying filesystem are
+  /// aligned on, and a multiple of, this size.
+  int64_t block_size = 1 << 20;
+  /// The number of bytes of blocks kept in memory.
+  int64_t memory_capacity = 256 << 20;
+  /// A local directory where blocks are also kept. Empty disables the disk cache.
+  std::string disk_cache_dir;
+  /// The number of bytes of blocks kept on disk.
+  int64_t disk_capacity = int64_t(4) << 30;
+  /// The pool cached blocks and reads spanning several blocks are allocated from.
+  MemoryPool* pool = default_memory_pool();
+
+  static CachingOptions Defaults() { return CachingOptions(); }
+};
+
+/// \brief EXPERIMENTAL: block cache counters, in number of blocks
+struct ARROW_EXPORT CacheStatistics {
+  /// Blocks served from memory
+  int64_t memory_hits = 0;
+  /// Blocks served from the disk cache
+  int64_t disk_hits = 0;
+  /// Blocks read from the underlying filesystem
+  int64_t misses = 0;
+};
+
+/// \brief EXPERIMENTAL: a FileSystem implementation that delegates to another
+/// implementation and caches blocks of the files it reads.
+///
+/// Files opened for reading are split in fixed-size blocks, kept in memory
+/// and optionally on local disk, each with least-recently-used eviction.
+/// Blocks are keyed by file path, size and modification time, as returned by
+/// the underlying GetTargetStats(), so that a file changed on the underlying
+/// filesystem is read anew. Files rewritten without a change of size and
+/// modification time are only detected when written through this filesystem,
+/// which also deletes their blocks from the disk cache.
+///
+/// Blocks found on disk, including those left by an earlier process using
+/// the same directory, are checked against their key before use.
+class ARROW_EXPORT CachingFileSystem : public FileSystem {
+ public:
+  ~CachingFileSystem() override;
+
+  /// Create a CachingFileSystem reading through the given filesystem.
+  static Status Make(std::shared_ptr<FileSystem> base_fs, const CachingOptions& options,
+                     std::shared_ptr<CachingFileSystem>* out);
+
+  /// \cond FALSE
+  using FileSystem::GetTargetStats;
+  /// \endcond
+  Status GetTargetStats(const std::string& path, FileStats* out) override;
+  Status GetTargetStats(const Selector& select, std::vector<FileStats>* out) override;
+  Status GetTargetStatsBatches(const Selector& select, FileStatsIterator* out) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path) override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  /// Open an input stream reading through the block cache.
+  Status OpenInputStream(const std::string& path,
+                         std::shared_ptr<io::InputStream>* out) override;
+
+  /// Open an input file reading through the block cache.
+  ///
+  /// The underlying file is only opened once a block is missing from the cache.
+  Status OpenInputFile(const std::string& path,
+                       std::shared_ptr<io::RandomAccessFile>* out) override;
+
+  Status OpenOutputStream(const std::string& path,
+                          std::shared_ptr<io::OutputStream>* out) override;
+
+  Status OpenAppendStream(const std::string& path,
+                          std::shared_ptr<io::OutputStream>* out) override;
+
+  /// The cache counters since construction.
+  CacheStatistics statistics() const;
+
+  class Impl;
+
+ protected:
+  CachingFileSystem(std::shared_ptr<FileSystem> base_fs, const CachingOptions& options);
+
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace fs
+}  // namespace arrow
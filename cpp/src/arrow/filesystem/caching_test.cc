@@ -0,0 +1,331 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/caching.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/io/slow.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace fs {
+namespace internal {
+
+using ::arrow::internal::TemporaryDir;
+
+// Counts the calls to the underlying SlowFileSystem, without sleeping
+class CountingLatencies : public io::LatencyGenerator {
+ public:
+  double NextLatency() override {
+    ++count_;
+    return 0.0;
+  }
+
+  int64_t count() const { return count_; }
+
+ private:
+  std::atomic<int64_t> count_{0};
+};
+
+static std::string MakeContents(int64_t size) {
+  std::string contents;
+  for (int64_t i = 0; i < size; ++i) {
+    contents += static_cast<char>('a' + (i * 7) % 26);
+  }
+  return contents;
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Generic CachingFileSystem tests
+
+class TestCachingFSGeneric : public ::testing::Test, public GenericFileSystemTest {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    fs_ = std::make_shared<MockFileSystem>(time_);
+    CachingOptions options;
+    options.block_size = 4;
+    ASSERT_OK(CachingFileSystem::Make(fs_, options, &caching_fs_));
+  }
+
+ protected:
+  std::shared_ptr<FileSystem> GetEmptyFileSystem() override { return caching_fs_; }
+
+  TimePoint time_;
+  std::shared_ptr<MockFileSystem> fs_;
+  std::shared_ptr<CachingFileSystem> caching_fs_;
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestCachingFSGeneric);
+
+////////////////////////////////////////////////////////////////////////////
+// Block cache tests
+
+class TestCachingFileSystem : public ::testing::Test {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    mock_fs_ = std::make_shared<MockFileSystem>(time_);
+    latencies_ = std::make_shared<CountingLatencies>();
+    slow_fs_ = std::make_shared<SlowFileSystem>(mock_fs_, latencies_);
+    contents_ = MakeContents(1000);
+    CreateFile(mock_fs_.get(), "data", contents_);
+
+    options_.block_size = 100;
+    options_.memory_capacity = 1000;
+    options_.pool = &pool_;
+  }
+
+  void MakeFileSystem() { ASSERT_OK(CachingFileSystem::Make(slow_fs_, options_, &fs_)); }
+
+  void AssertReadAt(io::RandomAccessFile* file, int64_t position, int64_t nbytes) {
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(file->ReadAt(position, nbytes, &buffer));
+    AssertBufferEqual(*buffer, contents_.substr(position, nbytes));
+  }
+
+  void AssertStatistics(int64_t memory_hits, int64_t disk_hits, int64_t misses) {
+    auto statistics = fs_->statistics();
+    ASSERT_EQ(memory_hits, statistics.memory_hits);
+    ASSERT_EQ(disk_hits, statistics.disk_hits);
+    ASSERT_EQ(misses, statistics.misses);
+  }
+
+ protected:
+  TimePoint time_;
+  std::shared_ptr<MockFileSystem> mock_fs_;
+  std::shared_ptr<CountingLatencies> latencies_;
+  std::shared_ptr<SlowFileSystem> slow_fs_;
+  std::string contents_;
+  ProxyMemoryPool pool_{default_memory_pool()};
+  CachingOptions options_;
+  std::shared_ptr<CachingFileSystem> fs_;
+};
+
+TEST_F(TestCachingFileSystem, InvalidOptions) {
+  options_.block_size = 0;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(slow_fs_, options_, &fs_));
+  options_.block_size = 100;
+  options_.pool = nullptr;
+  ASSERT_RAISES(Invalid, CachingFileSystem::Make(slow_fs_, options_, &fs_));
+}
+
+TEST_F(TestCachingFileSystem, ReadAt) {
+  MakeFileSystem();
+  std::shared_ptr<io::RandomAccessFile> file;
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+  int64_t size;
+  ASSERT_OK(file->GetSize(&size));
+  ASSERT_EQ(1000, size);
+
+  // Blocks 1 to 3, read from the underlying file with a single call
+  const int64_t calls_before = latencies_->count();
+  AssertReadAt(file.get(), 150, 200);
+  AssertStatistics(0, 0, 3);
+  // Opening the underlying file, then reading
+  ASSERT_EQ(calls_before + 2, latencies_->count());
+
+  // Cached: zero-copy slices of blocks 1 and 2. Blocks read together are
+  // copied out of the read buffer, which isn't kept alive by the cache
+  std::shared_ptr<Buffer> first, second;
+  ASSERT_OK(file->ReadAt(190, 10, &first));
+  ASSERT_OK(file->ReadAt(200, 10, &second));
+  AssertBufferEqual(*first, contents_.substr(190, 10));
+  AssertBufferEqual(*second, contents_.substr(200, 10));
+  ASSERT_NE(first->data() + 10, second->data());
+  AssertStatistics(2, 0, 3);
+  // Three blocks, each padded to 128 bytes
+  ASSERT_EQ(3 * 128, pool_.bytes_allocated());
+
+  // Blocks 0 to 4: only the missing ones are read, in two calls
+  AssertReadAt(file.get(), 0, 500);
+  AssertStatistics(5, 0, 5);
+  ASSERT_EQ(calls_before + 4, latencies_->count());
+
+  // The last block is shorter, reads are clamped to the file size
+  AssertReadAt(file.get(), 950, 100);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->ReadAt(1000, 10, &buffer));
+  ASSERT_EQ(0, buffer->size());
+
+  // Read() and the raw pointer variant
+  ASSERT_OK(file->Seek(95));
+  ASSERT_OK(file->Read(10, &buffer));
+  AssertBufferEqual(*buffer, contents_.substr(95, 10));
+  std::string out(20, '\0');
+  int64_t bytes_read;
+  ASSERT_OK(file->ReadAt(390, 20, &bytes_read, &out[0]));
+  ASSERT_EQ(20, bytes_read);
+  ASSERT_EQ(contents_.substr(390, 20), out);
+
+  ASSERT_OK(file->Close());
+  ASSERT_RAISES(Invalid, file->ReadAt(0, 10, &buffer));
+}
+
+TEST_F(TestCachingFileSystem, SharedBetweenFiles) {
+  MakeFileSystem();
+  std::shared_ptr<io::RandomAccessFile> file;
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+  AssertReadAt(file.get(), 0, 1000);
+  AssertStatistics(0, 0, 10);
+  ASSERT_OK(file->Close());
+
+  // Another file on the same path is served from the cache, without opening
+  // the underlying file
+  const int64_t calls_before = latencies_->count();
+  std::shared_ptr<io::InputStream> stream;
+  ASSERT_OK(fs_->OpenInputStream("data", &stream));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream->Read(1000, &buffer));
+  AssertBufferEqual(*buffer, contents_);
+  AssertStatistics(10, 0, 10);
+  // Only GetTargetStats() reached the underlying filesystem
+  ASSERT_EQ(calls_before + 1, latencies_->count());
+}
+
+TEST_F(TestCachingFileSystem, LRUEviction) {
+  options_.memory_capacity = 300;
+  MakeFileSystem();
+  std::shared_ptr<io::RandomAccessFile> file;
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+
+  AssertReadAt(file.get(), 0, 100);
+  AssertReadAt(file.get(), 100, 100);
+  AssertReadAt(file.get(), 200, 100);
+  AssertStatistics(0, 0, 3);
+  // Touch block 0, then evict the least recently used block 1
+  AssertReadAt(file.get(), 0, 10);
+  AssertReadAt(file.get(), 300, 100);
+  AssertStatistics(1, 0, 4);
+
+  AssertReadAt(file.get(), 0, 10);
+  AssertReadAt(file.get(), 200, 10);
+  AssertStatistics(3, 0, 4);
+  AssertReadAt(file.get(), 100, 10);
+  AssertStatistics(3, 0, 5);
+
+  // Only the cached blocks remain allocated, each padded to 128 bytes
+  AssertReadAt(file.get(), 0, 1000);
+  ASSERT_EQ(3 * 128, pool_.bytes_allocated());
+}
+
+TEST_F(TestCachingFileSystem, ChangedFiles) {
+  MakeFileSystem();
+  std::shared_ptr<io::RandomAccessFile> file;
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+  AssertReadAt(file.get(), 0, 100);
+
+  // Changed behind the cache's back: the size is part of the key
+  contents_ = MakeContents(1001);
+  CreateFile(mock_fs_.get(), "data", contents_);
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+  AssertReadAt(file.get(), 0, 100);
+  AssertStatistics(0, 0, 2);
+
+  // Same size and modification time, but written through the cache
+  contents_ = std::string(1001, 'z');
+  CreateFile(fs_.get(), "data", contents_);
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+  AssertReadAt(file.get(), 0, 100);
+  AssertStatistics(0, 0, 3);
+
+  // Non-existent files and directories
+  ASSERT_OK(mock_fs_->CreateDir("dir"));
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("dir", &file));
+  ASSERT_RAISES(IOError, fs_->OpenInputFile("nonexistent", &file));
+}
+
+TEST_F(TestCachingFileSystem, DiskCache) {
+  std::unique_ptr<TemporaryDir> temp_dir;
+  ASSERT_OK(TemporaryDir::Make("caching-fs-test-", &temp_dir));
+  options_.disk_cache_dir = temp_dir->path().ToString() + "cache";
+  options_.memory_capacity = 200;
+  MakeFileSystem();
+
+  std::shared_ptr<io::RandomAccessFile> file;
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+  AssertReadAt(file.get(), 0, 500);
+  AssertStatistics(0, 0, 5);
+  // Evicted from memory, but still on disk
+  AssertReadAt(file.get(), 0, 200);
+  AssertStatistics(0, 2, 5);
+
+  // A new filesystem finds the blocks left on disk
+  MakeFileSystem();
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+  const int64_t calls_before = latencies_->count();
+  AssertReadAt(file.get(), 250, 200);
+  AssertStatistics(0, 3, 0);
+  ASSERT_EQ(calls_before, latencies_->count());
+  AssertReadAt(file.get(), 400, 200);
+  AssertStatistics(1, 3, 1);
+
+  // Disk capacity is enforced, oldest blocks first
+  options_.disk_capacity = 250;
+  MakeFileSystem();
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+  AssertReadAt(file.get(), 0, 600);
+  auto statistics = fs_->statistics();
+  ASSERT_EQ(2, statistics.disk_hits);
+  ASSERT_EQ(4, statistics.misses);
+}
+
+TEST_F(TestCachingFileSystem, DiskCacheInvalidation) {
+  std::unique_ptr<TemporaryDir> temp_dir;
+  ASSERT_OK(TemporaryDir::Make("caching-fs-test-", &temp_dir));
+  options_.disk_cache_dir = temp_dir->path().ToString() + "cache";
+  MakeFileSystem();
+
+  std::shared_ptr<io::RandomAccessFile> file;
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+  AssertReadAt(file.get(), 0, 200);
+  AssertStatistics(0, 0, 2);
+
+  // Same size and modification time, written through the cache: the blocks
+  // on disk are deleted, so that another process doesn't read them
+  contents_ = std::string(1000, 'z');
+  CreateFile(fs_.get(), "data", contents_);
+  MakeFileSystem();
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+  AssertReadAt(file.get(), 0, 200);
+  AssertStatistics(0, 0, 2);
+
+  // A file opened before a write doesn't cache its blocks on disk
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+  CreateFile(fs_.get(), "data", contents_);
+  AssertReadAt(file.get(), 500, 100);
+  MakeFileSystem();
+  ASSERT_OK(fs_->OpenInputFile("data", &file));
+  AssertReadAt(file.get(), 500, 100);
+  AssertStatistics(0, 0, 1);
+}
+
+}  // namespace internal
+}  // namespace fs
+}  // namespace arrow
@@ -114,6 +114,18 @@ Status FileSystem::GetTargetStats(const std::vector<std::string>& paths,
   return Status::OK();
 }
 
+Status FileSystem::GetTargetStatsBatches(const Selector& select,
+                                         FileStatsIterator* out) {
+  FileStatsVector stats;
+  RETURN_NOT_OK(GetTargetStats(select, &stats));
+  std::vector<FileStatsVector> batches;
+  if (!stats.empty()) {
+    batches.push_back(std::move(stats));
+  }
+  *out = MakeVectorIterator(std::move(batches));
+  return Status::OK();
+}
+
 Status FileSystem::DeleteFiles(const std::vector<std::string>& paths) {
   Status st = Status::OK();
   for (const auto& path : paths) {
@@ -186,6 +198,23 @@ Status SubTreeFileSystem::GetTargetStats(const Selector& select,
   return Status::OK();
 }
 
+Status SubTreeFileSystem::GetTargetStatsBatches(const Selector& select,
+                                                FileStatsIterator* out) {
+  auto selector = select;
+  selector.base_dir = PrependBase(selector.base_dir);
+  FileStatsIterator it;
+  RETURN_NOT_OK(base_fs_->GetTargetStatsBatches(selector, &it));
+  auto fix_stats = [this](FileStatsVector stats, FileStatsVector* out) {
+    for (auto& st : stats) {
+      RETURN_NOT_OK(FixStats(&st));
+    }
+    *out = std::move(stats);
+    return Status::OK();
+  };
+  *out = MakeMaybeMapIterator(std::move(fix_stats), std::move(it));
+  return Status::OK();
+}
+
 Status SubTreeFileSystem::CreateDir(const std::string& path, bool recursive) {
   auto s = path;
   RETURN_NOT_OK(PrependBaseNonEmpty(&s));
@@ -279,6 +308,12 @@ Status SlowFileSystem::GetTargetStats(const Selector& selector,
   return base_fs_->GetTargetStats(selector, out);
 }
 
+Status SlowFileSystem::GetTargetStatsBatches(const Selector& selector,
+                                             FileStatsIterator* out) {
+  latencies_->Sleep();
+  return base_fs_->GetTargetStatsBatches(selector, out);
+}
+
 Status SlowFileSystem::CreateDir(const std::string& path, bool recursive) {
   latencies_->Sleep();
   return base_fs_->CreateDir(path, recursive);
@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "arrow/status.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
@@ -131,6 +132,19 @@ struct ARROW_EXPORT FileStats {
 
 ARROW_EXPORT std::ostream& operator<<(std::ostream& os, const FileStats&);
 
+using FileStatsVector = std::vector<FileStats>;
+/// \brief An iterator of FileStats batches, ending with an empty batch
+using FileStatsIterator = Iterator<FileStatsVector>;
+
+}  // namespace fs
+
+template <>
+struct IterationTraits<fs::FileStatsVector> {
+  static fs::FileStatsVector End() { return {}; }
+};
+
+namespace fs {
+
 /// \brief EXPERIMENTAL: file selector
 struct ARROW_EXPORT Selector {
   // The directory in which to select files.
@@ -167,7 +181,19 @@ class ARROW_EXPORT FileSystem {
   /// The selector's base directory will not be part of the results, even if
   /// it exists.
   /// If it doesn't exist, see `Selector::allow_non_existent`.
+  /// The order of the results is unspecified, unless documented by the
+  /// implementation.
   virtual Status GetTargetStats(const Selector& select, std::vector<FileStats>* out) = 0;
+  /// Same, streaming the results in batches as they are listed.
+  ///
+  /// Batches are never empty and come in unspecified order.  This allows
+  /// processing the first results before a large listing completes.
+  /// Errors may be returned either by this call or by the iterator.
+  /// The filesystem must be kept alive until the iterator is destroyed.
+  ///
+  /// The default implementation returns the result of
+  /// GetTargetStats(Selector) as a single batch.
+  virtual Status GetTargetStatsBatches(const Selector& select, FileStatsIterator* out);
 
   /// Create a directory and subdirectories.
   ///
@@ -243,6 +269,7 @@ class ARROW_EXPORT SubTreeFileSystem : public FileSystem {
   /// \endcond
   Status GetTargetStats(const std::string& path, FileStats* out) override;
   Status GetTargetStats(const Selector& select, std::vector<FileStats>* out) override;
+  Status GetTargetStatsBatches(const Selector& select, FileStatsIterator* out) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -290,6 +317,7 @@ class ARROW_EXPORT SlowFileSystem : public FileSystem {
   using FileSystem::GetTargetStats;
   Status GetTargetStats(const std::string& path, FileStats* out) override;
   Status GetTargetStats(const Selector& select, std::vector<FileStats>* out) override;
+  Status GetTargetStatsBatches(const Selector& select, FileStatsIterator* out) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
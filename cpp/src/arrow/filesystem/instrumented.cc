@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/instrumented.h"
+
+#include <utility>
+
+#include "arrow/status.h"
+
+namespace arrow {
+namespace fs {
+
+using io::IOOperation;
+
+InstrumentedFileSystem::InstrumentedFileSystem(std::shared_ptr<FileSystem> base_fs)
+    : InstrumentedFileSystem(std::move(base_fs), std::make_shared<io::IOMetrics>()) {}
+
+InstrumentedFileSystem::InstrumentedFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                               std::shared_ptr<io::IOMetrics> metrics)
+    : base_fs_(std::move(base_fs)), metrics_(std::move(metrics)) {}
+
+Status InstrumentedFileSystem::GetTargetStats(const std::string& path, FileStats* out) {
+  return metrics_->Time(IOOperation::GetTargetStats,
+                        [&]() { return base_fs_->GetTargetStats(path, out); });
+}
+
+Status InstrumentedFileSystem::GetTargetStats(const Selector& selector,
+                                              std::vector<FileStats>* out) {
+  return metrics_->Time(IOOperation::ListDir,
+                        [&]() { return base_fs_->GetTargetStats(selector, out); });
+}
+
+Status InstrumentedFileSystem::GetTargetStatsBatches(const Selector& selector,
+                                                     FileStatsIterator* out) {
+  FileStatsIterator it;
+  RETURN_NOT_OK(metrics_->Time(IOOperation::ListDir, [&]() {
+    return base_fs_->GetTargetStatsBatches(selector, &it);
+  }));
+  // Also record the time spent waiting for each batch
+  auto metrics = metrics_;
+  auto shared_it = std::make_shared<FileStatsIterator>(std::move(it));
+  *out = MakeFunctionIterator([metrics, shared_it](FileStatsVector* batch) {
+    return metrics->Time(IOOperation::ListDir,
+                         [&]() { return shared_it->Next(batch); });
+  });
+  return Status::OK();
+}
+
+Status InstrumentedFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return metrics_->Time(IOOperation::CreateDir,
+                        [&]() { return base_fs_->CreateDir(path, recursive); });
+}
+
+Status InstrumentedFileSystem::DeleteDir(const std::string& path) {
+  return metrics_->Time(IOOperation::DeleteDir,
+                        [&]() { return base_fs_->DeleteDir(path); });
+}
+
+Status InstrumentedFileSystem::DeleteDirContents(const std::string& path) {
+  return metrics_->Time(IOOperation::DeleteDir,
+                        [&]() { return base_fs_->DeleteDirContents(path); });
+}
+
+Status InstrumentedFileSystem::DeleteFile(const std::string& path) {
+  return metrics_->Time(IOOperation::DeleteFile,
+                        [&]() { return base_fs_->DeleteFile(path); });
+}
+
+Status InstrumentedFileSystem::Move(const std::string& src, const std::string& dest) {
+  return metrics_->Time(IOOperation::Move, [&]() { return base_fs_->Move(src, dest); });
+}
+
+Status InstrumentedFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  return metrics_->Time(IOOperation::CopyFile,
+                        [&]() { return base_fs_->CopyFile(src, dest); });
+}
+
+Status InstrumentedFileSystem::OpenInputStream(const std::string& path,
+                                               std::shared_ptr<io::InputStream>* out) {
+  std::shared_ptr<io::InputStream> stream;
+  RETURN_NOT_OK(metrics_->Time(IOOperation::OpenInputStream, [&]() {
+    return base_fs_->OpenInputStream(path, &stream);
+  }));
+  *out = std::make_shared<io::InstrumentedInputStream>(stream, metrics_);
+  return Status::OK();
+}
+
+Status InstrumentedFileSystem::OpenInputFile(const std::string& path,
+                                             std::shared_ptr<io::RandomAccessFile>* out) {
+  std::shared_ptr<io::RandomAccessFile> file;
+  RETURN_NOT_OK(metrics_->Time(IOOperation::OpenInputFile, [&]() {
+    return base_fs_->OpenInputFile(path, &file);
+  }));
+  *out = std::make_shared<io::InstrumentedRandomAccessFile>(file, metrics_);
+  return Status::OK();
+}
+
+Status InstrumentedFileSystem::OpenOutputStream(const std::string& path,
+                                                std::shared_ptr<io::OutputStream>* out) {
+  std::shared_ptr<io::OutputStream> stream;
+  RETURN_NOT_OK(metrics_->Time(IOOperation::OpenOutputStream, [&]() {
+    return base_fs_->OpenOutputStream(path, &stream);
+  }));
+  *out = std::make_shared<io::InstrumentedOutputStream>(stream, metrics_);
+  return Status::OK();
+}
+
+Status InstrumentedFileSystem::OpenAppendStream(const std::string& path,
+                                                std::shared_ptr<io::OutputStream>* out) {
+  std::shared_ptr<io::OutputStream> stream;
+  RETURN_NOT_OK(metrics_->Time(IOOperation::OpenOutputStream, [&]() {
+    return base_fs_->OpenAppendStream(path, &stream);
+  }));
+  *out = std::make_shared<io::InstrumentedOutputStream>(stream, metrics_);
+  return Status::OK();
+}
+
+}  // namespace fs
+}  // namespace arrow
@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/io/instrumented.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace fs {
+
+/// \brief EXPERIMENTAL: a FileSystem implementation that delegates to another
+/// implementation and records I/O metrics.
+///
+/// All filesystem calls are timed and counted.  Opened streams and files
+/// are wrapped so that their reads, writes and closes are recorded as well,
+/// in the same io::IOMetrics instance.
+class ARROW_EXPORT InstrumentedFileSystem : public FileSystem {
+ public:
+  explicit InstrumentedFileSystem(std::shared_ptr<FileSystem> base_fs);
+  InstrumentedFileSystem(std::shared_ptr<FileSystem> base_fs,
+                         std::shared_ptr<io::IOMetrics> metrics);
+
+  /// \cond FALSE
+  using FileSystem::GetTargetStats;
+  /// \endcond
+  Status GetTargetStats(const std::string& path, FileStats* out) override;
+  Status GetTargetStats(const Selector& select, std::vector<FileStats>* out) override;
+  Status GetTargetStatsBatches(const Selector& select, FileStatsIterator* out) override;
+
+  Status CreateDir(const std::string& path, bool recursive = true) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path) override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Status OpenInputStream(const std::string& path,
+                         std::shared_ptr<io::InputStream>* out) override;
+
+  Status OpenInputFile(const std::string& path,
+                       std::shared_ptr<io::RandomAccessFile>* out) override;
+
+  Status OpenOutputStream(const std::string& path,
+                          std::shared_ptr<io::OutputStream>* out) override;
+
+  Status OpenAppendStream(const std::string& path,
+                          std::shared_ptr<io::OutputStream>* out) override;
+
+  /// The metrics recorded by this filesystem and the streams it opened.
+  const std::shared_ptr<io::IOMetrics>& metrics() const { return metrics_; }
+
+ protected:
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<io::IOMetrics> metrics_;
+};
+
+}  // namespace fs
+}  // namespace arrow
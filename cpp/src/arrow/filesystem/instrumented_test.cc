@@ -0,0 +1,209 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/filesystem/instrumented.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/instrumented.h"
+#include "arrow/io/memory.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace fs {
+namespace internal {
+
+using io::IOHistogram;
+using io::IOMetrics;
+using io::IOMetricsSnapshot;
+using io::IOOperation;
+
+////////////////////////////////////////////////////////////////////////////
+// IOMetrics tests
+
+TEST(IOHistogram, Buckets) {
+  ASSERT_EQ(0, IOHistogram::BucketIndex(0));
+  ASSERT_EQ(0, IOHistogram::BucketIndex(1));
+  ASSERT_EQ(1, IOHistogram::BucketIndex(2));
+  ASSERT_EQ(2, IOHistogram::BucketIndex(3));
+  ASSERT_EQ(2, IOHistogram::BucketIndex(4));
+  ASSERT_EQ(12, IOHistogram::BucketIndex(4096));
+  ASSERT_EQ(13, IOHistogram::BucketIndex(4097));
+  ASSERT_EQ(IOHistogram::kNumBuckets - 1, IOHistogram::BucketIndex(int64_t(1) << 62));
+
+  ASSERT_EQ(1, IOHistogram::BucketUpperBound(0));
+  ASSERT_EQ(4096, IOHistogram::BucketUpperBound(12));
+}
+
+TEST(IOMetrics, Basics) {
+  IOMetrics metrics;
+  for (int64_t size : {10, 100, 100, 100, 5000}) {
+    metrics.Record(IOOperation::Read, size * 1000, Status::OK());
+    metrics.RecordRead(size, size / 2);
+  }
+  metrics.Record(IOOperation::Read, 0, Status::IOError("xxx"));
+  metrics.RecordWrite(42);
+
+  auto snapshot = metrics.Snapshot();
+  const auto& reads = snapshot.operation(IOOperation::Read);
+  ASSERT_EQ(6, reads.count);
+  ASSERT_EQ(1, reads.errors);
+  ASSERT_EQ(5310, reads.latency_us.sum);
+  ASSERT_EQ(128, reads.latency_us.Quantile(0.5));
+  ASSERT_EQ(8192, reads.latency_us.Quantile(1.0));
+  ASSERT_EQ(0, snapshot.operation(IOOperation::Write).count);
+  ASSERT_EQ(5, snapshot.read_sizes.count);
+  ASSERT_EQ(1, snapshot.read_sizes.buckets[IOHistogram::BucketIndex(10)]);
+  ASSERT_EQ(3, snapshot.read_sizes.buckets[IOHistogram::BucketIndex(100)]);
+  ASSERT_EQ(2655, snapshot.bytes_read);
+  ASSERT_EQ(42, snapshot.bytes_written);
+  ASSERT_DOUBLE_EQ(5310e-6, snapshot.total_time());
+  ASSERT_NE(std::string::npos, snapshot.ToString().find("Read: count=6 errors=1"));
+
+  metrics.Reset();
+  snapshot = metrics.Snapshot();
+  ASSERT_EQ(0, snapshot.operation(IOOperation::Read).count);
+  ASSERT_EQ(0, snapshot.bytes_read);
+  ASSERT_EQ("", snapshot.ToString());
+}
+
+TEST(InstrumentedStreams, Reads) {
+  auto metrics = std::make_shared<IOMetrics>();
+  auto buffer = std::make_shared<Buffer>("some data to read");
+  auto file = std::make_shared<io::InstrumentedRandomAccessFile>(
+      std::make_shared<io::BufferReader>(buffer), metrics);
+  ASSERT_TRUE(file->supports_zero_copy());
+
+  std::shared_ptr<Buffer> out;
+  ASSERT_OK(file->Read(4, &out));
+  ASSERT_OK(file->ReadAt(10, 100, &out));
+  AssertBufferEqual(*out, "to read");
+  char chars[3];
+  int64_t bytes_read;
+  ASSERT_OK(file->ReadAt(5, 3, &bytes_read, chars));
+  ASSERT_RAISES(IOError, file->ReadAt(0, -1, &out));
+  ASSERT_OK(file->Close());
+
+  auto snapshot = metrics->Snapshot();
+  ASSERT_EQ(4, snapshot.operation(IOOperation::Read).count);
+  ASSERT_EQ(1, snapshot.operation(IOOperation::Read).errors);
+  ASSERT_EQ(1, snapshot.operation(IOOperation::Close).count);
+  ASSERT_EQ(14, snapshot.bytes_read);
+  ASSERT_EQ(3, snapshot.read_sizes.count);
+  ASSERT_EQ(1, snapshot.read_sizes.buckets[IOHistogram::BucketIndex(100)]);
+}
+
+TEST(InstrumentedStreams, Writes) {
+  auto metrics = std::make_shared<IOMetrics>();
+  std::shared_ptr<io::BufferOutputStream> sink;
+  ASSERT_OK(io::BufferOutputStream::Create(64, default_memory_pool(), &sink));
+  io::InstrumentedOutputStream stream(sink, metrics);
+
+  ASSERT_OK(stream.Write("abc"));
+  ASSERT_OK(stream.Write(std::make_shared<Buffer>("de")));
+  ASSERT_OK(
+      stream.Writev({std::make_shared<Buffer>("f"), std::make_shared<Buffer>("g")}));
+  ASSERT_OK(stream.Flush());
+  ASSERT_OK(stream.Close());
+  ASSERT_TRUE(sink->closed());
+
+  auto snapshot = metrics->Snapshot();
+  ASSERT_EQ(3, snapshot.operation(IOOperation::Write).count);
+  ASSERT_EQ(1, snapshot.operation(IOOperation::Flush).count);
+  ASSERT_EQ(1, snapshot.operation(IOOperation::Close).count);
+  ASSERT_EQ(7, snapshot.bytes_written);
+}
+
+////////////////////////////////////////////////////////////////////////////
+// Generic InstrumentedFileSystem tests
+
+class TestInstrumentedFSGeneric : public ::testing::Test, public GenericFileSystemTest {
+ public:
+  void SetUp() override {
+    time_ = TimePoint(TimePoint::duration(42));
+    fs_ = std::make_shared<MockFileSystem>(time_);
+    instrumented_fs_ = std::make_shared<InstrumentedFileSystem>(fs_);
+  }
+
+ protected:
+  std::shared_ptr<FileSystem> GetEmptyFileSystem() override { return instrumented_fs_; }
+
+  TimePoint time_;
+  std::shared_ptr<MockFileSystem> fs_;
+  std::shared_ptr<InstrumentedFileSystem> instrumented_fs_;
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestInstrumentedFSGeneric);
+
+////////////////////////////////////////////////////////////////////////////
+// InstrumentedFileSystem tests
+
+TEST(InstrumentedFileSystem, Metrics) {
+  auto mock_fs = std::make_shared<MockFileSystem>(TimePoint(TimePoint::duration(42)));
+  InstrumentedFileSystem fs(mock_fs);
+  const auto& metrics = fs.metrics();
+
+  ASSERT_OK(fs.CreateDir("AB"));
+  CreateFile(&fs, "AB/ab", "some data");
+  FileStats stats;
+  ASSERT_OK(fs.GetTargetStats("AB/ab", &stats));
+  ASSERT_RAISES(IOError, fs.DeleteDir("non-existent"));
+
+  std::vector<FileStats> listing;
+  Selector selector;
+  selector.base_dir = "AB";
+  ASSERT_OK(fs.GetTargetStats(selector, &listing));
+  ASSERT_EQ(1, listing.size());
+
+  std::shared_ptr<io::RandomAccessFile> file;
+  ASSERT_OK(fs.OpenInputFile("AB/ab", &file));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file->ReadAt(5, 4, &buffer));
+  std::shared_ptr<io::InputStream> stream;
+  ASSERT_OK(fs.OpenInputStream("AB/ab", &stream));
+  ASSERT_OK(stream->Read(100, &buffer));
+  ASSERT_RAISES(IOError, fs.OpenInputStream("non-existent", &stream));
+
+  auto snapshot = metrics->Snapshot();
+  ASSERT_EQ(1, snapshot.operation(IOOperation::CreateDir).count);
+  ASSERT_EQ(1, snapshot.operation(IOOperation::OpenOutputStream).count);
+  ASSERT_EQ(1, snapshot.operation(IOOperation::GetTargetStats).count);
+  ASSERT_EQ(1, snapshot.operation(IOOperation::ListDir).count);
+  ASSERT_EQ(1, snapshot.operation(IOOperation::DeleteDir).errors);
+  ASSERT_EQ(1, snapshot.operation(IOOperation::OpenInputFile).count);
+  ASSERT_EQ(2, snapshot.operation(IOOperation::OpenInputStream).count);
+  ASSERT_EQ(1, snapshot.operation(IOOperation::OpenInputStream).errors);
+  ASSERT_EQ(2, snapshot.operation(IOOperation::Read).count);
+  ASSERT_EQ(13, snapshot.bytes_read);
+  ASSERT_EQ(9, snapshot.bytes_written);
+
+  // Metrics can be shared between filesystems
+  InstrumentedFileSystem other_fs(mock_fs, metrics);
+  ASSERT_OK(other_fs.DeleteFile("AB/ab"));
+  ASSERT_EQ(1, metrics->Snapshot().operation(IOOperation::DeleteFile).count);
+}
+
+}  // namespace internal
+}  // namespace fs
+}  // namespace arrow
@@ -171,8 +171,11 @@ Status StatFile(const std::string& path, FileStats* out) {
 
 #endif
 
-Status StatSelector(const PlatformFilename& dir_fn, const Selector& select,
-                    int32_t nesting_depth, std::vector<FileStats>* out) {
+// List a single directory, appending the directories to recurse into (if any)
+// to `subdirs`
+Status StatDirectory(const PlatformFilename& dir_fn, const Selector& select,
+                     int32_t nesting_depth, std::vector<FileStats>* out,
+                     std::vector<PlatformFilename>* subdirs) {
   std::vector<PlatformFilename> children;
   Status status = ListDir(dir_fn, &children);
   if (!status.ok()) {
@@ -190,13 +193,23 @@ Status StatSelector(const PlatformFilename& dir_fn, const Selector& select,
     FileStats st;
     PlatformFilename full_fn = dir_fn.Join(child_fn);
     RETURN_NOT_OK(StatFile(full_fn.ToNative(), &st));
-    if (st.type() != FileType::NonExistent) {
-      out->push_back(std::move(st));
-    }
     if (nesting_depth < select.max_recursion && select.recursive &&
         st.type() == FileType::Directory) {
-      RETURN_NOT_OK(StatSelector(full_fn, select, nesting_depth + 1, out));
+      subdirs->push_back(std::move(full_fn));
     }
+    if (st.type() != FileType::NonExistent) {
+      out->push_back(std::move(st));
+    }
+  }
+  return Status::OK();
+}
+
+Status StatSelector(const PlatformFilename& dir_fn, const Selector& select,
+                    int32_t nesting_depth, std::vector<FileStats>* out) {
+  std::vector<PlatformFilename> subdirs;
+  RETURN_NOT_OK(StatDirectory(dir_fn, select, nesting_depth, out, &subdirs));
+  for (const auto& subdir_fn : subdirs) {
+    RETURN_NOT_OK(StatSelector(subdir_fn, select, nesting_depth + 1, out));
   }
   return Status::OK();
 }
@@ -222,10 +235,36 @@ Status LocalFileSystem::GetTargetStats(const std::string& path, FileStats* out)
 
 Status LocalFileSystem::GetTargetStats(const Selector& select,
                                        std::vector<FileStats>* out) {
+  if (select.recursive && options_.listing_concurrency > 1) {
+    FileStatsIterator it;
+    RETURN_NOT_OK(GetTargetStatsBatches(select, &it));
+    return internal::CollectFileStats(std::move(it), out);
+  }
   PlatformFilename fn;
   RETURN_NOT_OK(PlatformFilename::FromString(select.base_dir, &fn));
   out->clear();
-  return StatSelector(fn, select, 0, out);
+  RETURN_NOT_OK(StatSelector(fn, select, 0, out));
+  internal::SortFileStats(out);
+  return Status::OK();
+}
+
+Status LocalFileSystem::GetTargetStatsBatches(const Selector& select,
+                                              FileStatsIterator* out) {
+  PlatformFilename fn;
+  RETURN_NOT_OK(PlatformFilename::FromString(select.base_dir, &fn));
+  auto list_dir = [select](const std::string& dir, int32_t nesting_depth,
+                           FileStatsVector* stats, std::vector<std::string>* subdirs) {
+    PlatformFilename dir_fn;
+    RETURN_NOT_OK(PlatformFilename::FromString(dir, &dir_fn));
+    std::vector<PlatformFilename> subdir_fns;
+    RETURN_NOT_OK(StatDirectory(dir_fn, select, nesting_depth, stats, &subdir_fns));
+    for (const auto& subdir_fn : subdir_fns) {
+      subdirs->push_back(subdir_fn.ToString());
+    }
+    return Status::OK();
+  };
+  return internal::MakeParallelListing({fn.ToString()}, std::move(list_dir),
+                                       options_.listing_concurrency, out);
 }
 
 Status LocalFileSystem::CreateDir(const std::string& path, bool recursive) {
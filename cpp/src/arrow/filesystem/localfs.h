@@ -32,6 +32,10 @@ struct ARROW_EXPORT LocalFileSystemOptions {
   /// or a regular one.
   bool use_mmap = false;
 
+  /// The maximum number of directories listed concurrently by recursive
+  /// GetTargetStats() and GetTargetStatsBatches() calls.
+  int listing_concurrency = 8;
+
   /// \brief Initialize with defaults
   static LocalFileSystemOptions Defaults();
 };
@@ -53,7 +57,9 @@ class ARROW_EXPORT LocalFileSystem : public FileSystem {
   using FileSystem::GetTargetStats;
   /// \endcond
   Status GetTargetStats(const std::string& path, FileStats* out) override;
+  /// Results are sorted by path, whatever the listing concurrency.
   Status GetTargetStats(const Selector& select, std::vector<FileStats>* out) override;
+  Status GetTargetStatsBatches(const Selector& select, FileStatsIterator* out) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
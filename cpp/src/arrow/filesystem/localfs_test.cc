@@ -30,6 +30,7 @@
 #include "arrow/filesystem/util_internal.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace fs {
@@ -97,6 +98,17 @@ class TestLocalFSGenericMMap : public TestLocalFSGeneric<CommonPathFormatter> {
 
 GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericMMap);
 
+class TestLocalFSGenericSerialListing : public TestLocalFSGeneric<CommonPathFormatter> {
+ protected:
+  LocalFileSystemOptions options() override {
+    auto options = LocalFileSystemOptions::Defaults();
+    options.listing_concurrency = 1;
+    return options;
+  }
+};
+
+GENERIC_FS_TEST_FUNCTIONS(TestLocalFSGenericSerialListing);
+
 ////////////////////////////////////////////////////////////////////////////
 // Concrete LocalFileSystem tests
 
@@ -198,6 +210,74 @@ TYPED_TEST(TestLocalFS, FileMTime) {
   AssertDurationBetween(t2 - stats[1].mtime(), -kTimeSlack, kTimeSlack);
 }
 
+TYPED_TEST(TestLocalFS, ParallelListing) {
+  // 3 levels of 4 subdirectories, each with 2 files
+  std::vector<std::string> dirs = {""};
+  for (int level = 0; level < 3; ++level) {
+    std::vector<std::string> subdirs;
+    for (const auto& dir : dirs) {
+      for (int i = 0; i < 4; ++i) {
+        subdirs.push_back(ConcatAbstractPath(dir, "d" + std::to_string(i)));
+        ASSERT_OK(this->fs_->CreateDir(subdirs.back()));
+        CreateFile(this->fs_.get(), subdirs.back() + "/f0", "data");
+        CreateFile(this->fs_.get(), subdirs.back() + "/f1", "data");
+      }
+    }
+    dirs = std::move(subdirs);
+  }
+
+  Selector selector;
+  selector.base_dir = this->local_path_;
+  selector.recursive = true;
+  auto options = LocalFileSystemOptions::Defaults();
+  options.listing_concurrency = 1;
+  std::vector<FileStats> expected, stats;
+  ASSERT_OK(LocalFileSystem(options).GetTargetStats(selector, &expected));
+  ASSERT_EQ(expected.size(), 84 * 3);
+
+  // Serial listings are sorted by path too
+  stats = expected;
+  SortStats(&stats);
+  ASSERT_EQ(stats, expected);
+
+  for (const int concurrency : {2, 8, 64}) {
+    options.listing_concurrency = concurrency;
+    LocalFileSystem fs(options);
+    // Sorted by path, whatever the order the directories were listed in
+    ASSERT_OK(fs.GetTargetStats(selector, &stats));
+    ASSERT_EQ(stats, expected);
+
+    // One batch per non-empty directory
+    FileStatsIterator it;
+    ASSERT_OK(fs.GetTargetStatsBatches(selector, &it));
+    int num_batches = 0;
+    for (auto maybe_batch : it) {
+      ASSERT_OK(maybe_batch.status());
+      ++num_batches;
+    }
+    ASSERT_EQ(num_batches, 85);
+
+    // Dropping the iterator before the end stops the listing
+    ASSERT_OK(fs.GetTargetStatsBatches(selector, &it));
+    FileStatsVector batch;
+    ASSERT_OK(it.Next(&batch));
+    ASSERT_FALSE(batch.empty());
+    it = FileStatsIterator();
+  }
+
+  // Listing from the only I/O thread doesn't wait for listing tasks queued
+  // behind it
+  const int io_capacity = GetIOThreadPoolCapacity();
+  ASSERT_OK(SetIOThreadPoolCapacity(1));
+  options.listing_concurrency = 8;
+  auto fut = ::arrow::internal::GetIOThreadPool()->Submit([&]() {
+    return LocalFileSystem(options).GetTargetStats(selector, &stats);
+  });
+  ASSERT_OK(fut.get());
+  ASSERT_EQ(stats, expected);
+  ASSERT_OK(SetIOThreadPoolCapacity(io_capacity));
+}
+
 // TODO Should we test backslash paths on Windows?
 // SubTreeFileSystem isn't compatible with them.
 
@@ -63,10 +63,13 @@
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/filesystem/s3_internal.h"
+#include "arrow/filesystem/util_internal.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
 #include "arrow/io/util_internal.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace fs {
@@ -262,8 +265,9 @@ Status GetObjectRange(Aws::S3::S3Client* client, const S3Path& path, int64_t sta
 // A RandomAccessFile that reads from a S3 object
 class ObjectInputFile : public io::RandomAccessFile {
  public:
-  ObjectInputFile(Aws::S3::S3Client* client, const S3Path& path)
-      : client_(client), path_(path) {}
+  ObjectInputFile(Aws::S3::S3Client* client, const S3Path& path,
+                  const S3Options& options)
+      : client_(client), path_(path), options_(options) {}
 
   Status Init() {
     // Issue a HEAD Object to get the content-length and ensure any
@@ -346,17 +350,12 @@ class ObjectInputFile : public io::RandomAccessFile {
       *bytes_read = 0;
       return Status::OK();
     }
-
-    // Read the desired range of bytes
-    S3Model::GetObjectResult result;
-    RETURN_NOT_OK(GetObjectRange(client_, path_, position, nbytes, &result));
-
-    auto& stream = result.GetBody();
-    stream.read(reinterpret_cast<char*>(out), nbytes);
-    // NOTE: the stream is a stringstream by default, there is no actual error
-    // to check for.  However, stream.fail() may return true if EOF is reached.
-    *bytes_read = stream.gcount();
-    return Status::OK();
+    if (nbytes > options_.parallel_read_threshold &&
+        options_.parallel_read_concurrency > 1 && options_.parallel_read_part_size > 0) {
+      return ReadRangeParallel(position, nbytes, bytes_read,
+                               reinterpret_cast<uint8_t*>(out));
+    }
+    return ReadRange(position, nbytes, bytes_read, out);
   }
 
   Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override {
@@ -378,6 +377,32 @@ class ObjectInputFile : public io::RandomAccessFile {
     return Status::OK();
   }
 
+  std::future<Result<std::shared_ptr<Buffer>>> ReadAsync(int64_t position,
+                                                         int64_t nbytes) override {
+    using io::internal::MakeReadyFuture;
+    // Validate and clamp the range on the caller thread, so that errors and
+    // reads past the end of the object don't occupy an I/O thread
+    Status st = CheckClosed();
+    if (st.ok()) {
+      st = CheckPosition(position, "read");
+    }
+    if (!st.ok()) {
+      return MakeReadyFuture(Result<std::shared_ptr<Buffer>>(st));
+    }
+    nbytes = std::min(nbytes, content_length_ - position);
+    if (nbytes == 0) {
+      return MakeReadyFuture(
+          Result<std::shared_ptr<Buffer>>(std::make_shared<Buffer>(nullptr, 0)));
+    }
+    // The GET request blocks on the network: issue it from the I/O pool
+    return ::arrow::internal::GetIOThreadPool()->Submit(
+        [this, position, nbytes]() -> Result<std::shared_ptr<Buffer>> {
+          std::shared_ptr<Buffer> out;
+          RETURN_NOT_OK(ReadAt(position, nbytes, &out));
+          return out;
+        });
+  }
+
   Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override {
     RETURN_NOT_OK(ReadAt(pos_, nbytes, bytes_read, out));
     pos_ += *bytes_read;
@@ -391,8 +416,108 @@ class ObjectInputFile : public io::RandomAccessFile {
   }
 
  protected:
+  // Read the desired range of bytes with a single GET
+  Status ReadRange(int64_t position, int64_t nbytes, int64_t* bytes_read, void* out) {
+    return ReadObjectRange(client_, path_, position, nbytes, bytes_read, out);
+  }
+
+  static Status ReadObjectRange(Aws::S3::S3Client* client, const S3Path& path,
+                                int64_t position, int64_t nbytes, int64_t* bytes_read,
+                                void* out) {
+    S3Model::GetObjectResult result;
+    RETURN_NOT_OK(GetObjectRange(client, path, position, nbytes, &result));
+
+    auto& stream = result.GetBody();
+    stream.read(reinterpret_cast<char*>(out), nbytes);
+    // NOTE: the stream is a stringstream by default, there is no actual error
+    // to check for.  However, stream.fail() may return true if EOF is reached.
+    *bytes_read = stream.gcount();
+    return Status::OK();
+  }
+
+  // The parts of a split read, claimed one by one by the reading threads.
+  // It holds everything they need, as the file may be gone by the time a
+  // late helper task runs
+  struct ParallelRead {
+    Aws::S3::S3Client* client;
+    S3Path path;
+    int64_t part_size;
+    int64_t num_parts;
+    std::atomic<int64_t> next_part{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+    int64_t parts_done = 0;
+    Status status;
+  };
+
+  // Read parts of a split read until none is left. Helper tasks starting
+  // after the read completed find no part to claim
+  static void ReadParts(const std::shared_ptr<ParallelRead>& state, int64_t position,
+                        int64_t nbytes, uint8_t* out) {
+    const int64_t part_size = state->part_size;
+    while (true) {
+      const int64_t part = state->next_part++;
+      if (part >= state->num_parts) {
+        return;
+      }
+      const int64_t offset = part * part_size;
+      const int64_t part_nbytes = std::min(part_size, nbytes - offset);
+      int64_t part_read = 0;
+      Status st = ReadObjectRange(state->client, state->path, position + offset,
+                                  part_nbytes, &part_read, out + offset);
+      if (st.ok() && part_read != part_nbytes) {
+        st = Status::IOError("Short read of ", part_read, " bytes instead of ",
+                             part_nbytes, " from key '", state->path.key,
+                             "' in bucket '", state->path.bucket, "'");
+      }
+      std::lock_guard<std::mutex> lock(state->mutex);
+      if (!st.ok()) {
+        state->status &= st;
+        // Parts not claimed yet are abandoned
+        const int64_t claimed = state->next_part.exchange(state->num_parts);
+        state->parts_done += std::max<int64_t>(state->num_parts - claimed, 0);
+      }
+      if (++state->parts_done == state->num_parts) {
+        state->cv.notify_all();
+      }
+    }
+  }
+
+  // Split a large read into concurrent ranged GETs on the I/O thread pool.
+  // The calling thread reads parts too, so that the read completes even when
+  // it is itself running on a saturated I/O pool.
+  Status ReadRangeParallel(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                           uint8_t* out) {
+    auto state = std::make_shared<ParallelRead>();
+    state->client = client_;
+    state->path = path_;
+    state->part_size = options_.parallel_read_part_size;
+    state->num_parts = (nbytes + state->part_size - 1) / state->part_size;
+
+    const int64_t num_helpers =
+        std::min<int64_t>(options_.parallel_read_concurrency, state->num_parts) - 1;
+    auto pool = ::arrow::internal::GetIOThreadPool();
+    for (int64_t i = 0; i < num_helpers; ++i) {
+      Status st = pool->Spawn([state, position, nbytes, out]() {
+        ReadParts(state, position, nbytes, out);
+      });
+      if (!st.ok()) {
+        // The remaining parts are read by fewer threads
+        break;
+      }
+    }
+    ReadParts(state, position, nbytes, out);
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait(lock, [&]() { return state->parts_done == state->num_parts; });
+    RETURN_NOT_OK(state->status);
+    *bytes_read = nbytes;
+    return Status::OK();
+  }
+
   Aws::S3::S3Client* client_;
   S3Path path_;
+  S3Options options_;
   bool closed_ = false;
   int64_t pos_ = 0;
   int64_t content_length_ = -1;
@@ -690,7 +815,7 @@ class ObjectOutputStream : public io::OutputStream {
  protected:
   Aws::S3::S3Client* client_;
   S3Path path_;
-  const S3Options& options_;
+  S3Options options_;
   Aws::String upload_id_;
   bool closed_ = true;
   int64_t pos_ = 0;
@@ -907,13 +1032,29 @@ class S3FileSystem::Impl {
 
   Status Walk(const Selector& select, const std::string& bucket, const std::string& key,
               int32_t nesting_depth, std::vector<FileStats>* out) {
+    std::vector<std::string> child_keys;
+    RETURN_NOT_OK(ListDirectory(select, bucket, key, nesting_depth, out, &child_keys));
+
+    // Recurse
+    for (const auto& child_key : child_keys) {
+      RETURN_NOT_OK(Walk(select, bucket, child_key, nesting_depth + 1, out));
+    }
+    return Status::OK();
+  }
+
+  // List a single "directory", appending the keys to recurse into (if any)
+  // to `child_keys`
+  Status ListDirectory(const Selector& select, const std::string& bucket,
+                       const std::string& key, int32_t nesting_depth,
+                       std::vector<FileStats>* out,
+                       std::vector<std::string>* child_keys) {
     if (nesting_depth >= kMaxNestingDepth) {
       return Status::IOError("S3 filesystem tree exceeds maximum nesting depth (",
                              kMaxNestingDepth, ")");
     }
 
     bool is_empty = true;
-    std::vector<std::string> child_keys;
+    const bool recurse = select.recursive && nesting_depth < select.max_recursion;
 
     auto handle_results = [&](const S3Model::ListObjectsV2Result& result) -> Status {
       // Walk "files"
@@ -942,8 +1083,8 @@ class S3FileSystem::Impl {
         st.set_path(ss.str());
         st.set_type(FileType::Directory);
         out->push_back(std::move(st));
-        if (select.recursive) {
-          child_keys.emplace_back(child_key);
+        if (recurse) {
+          child_keys->emplace_back(child_key);
         }
       }
       return Status::OK();
@@ -961,13 +1102,6 @@ class S3FileSystem::Impl {
     RETURN_NOT_OK(
         ListObjectsV2(bucket, key, std::move(handle_results), std::move(handle_error)));
 
-    // Recurse
-    if (select.recursive && nesting_depth < select.max_recursion) {
-      for (const auto& child_key : child_keys) {
-        RETURN_NOT_OK(Walk(select, bucket, child_key, nesting_depth + 1, out));
-      }
-    }
-
     // If no contents were found, perhaps it's an empty "directory",
     // or perhaps it's a non-existent entry.  Check.
     if (is_empty && !select.allow_non_existent) {
@@ -979,6 +1113,31 @@ class S3FileSystem::Impl {
     return Status::OK();
   }
 
+  // Concurrent workhorse for GetTargetStatsBatches(Selector...), walking
+  // the given buckets from their roots or a single bucket from the given key
+  Status WalkAsync(const Selector& select, const std::vector<std::string>& buckets,
+                   const std::string& key, FileStatsIterator* out) {
+    std::vector<std::string> roots;
+    for (const auto& bucket : buckets) {
+      roots.push_back(key.empty() ? bucket : bucket + kSep + key);
+    }
+    auto list_dir = [this, select](const std::string& dir, int32_t nesting_depth,
+                                   FileStatsVector* stats,
+                                   std::vector<std::string>* subdirs) {
+      S3Path path;
+      RETURN_NOT_OK(S3Path::FromString(dir, &path));
+      std::vector<std::string> child_keys;
+      RETURN_NOT_OK(ListDirectory(select, path.bucket, path.key, nesting_depth, stats,
+                                  &child_keys));
+      for (const auto& child_key : child_keys) {
+        subdirs->push_back(path.bucket + kSep + child_key);
+      }
+      return Status::OK();
+    };
+    return internal::MakeParallelListing(std::move(roots), std::move(list_dir),
+                                         options_.listing_concurrency, out);
+  }
+
   Status WalkForDeleteDir(const std::string& bucket, const std::string& key,
                           std::vector<std::string>* file_keys,
                           std::vector<std::string>* dir_keys) {
@@ -1190,6 +1349,12 @@ Status S3FileSystem::GetTargetStats(const std::string& s, FileStats* out) {
 }
 
 Status S3FileSystem::GetTargetStats(const Selector& select, std::vector<FileStats>* out) {
+  if (select.recursive && impl_->options_.listing_concurrency > 1) {
+    FileStatsIterator it;
+    RETURN_NOT_OK(GetTargetStatsBatches(select, &it));
+    return internal::CollectFileStats(std::move(it), out);
+  }
+
   S3Path base_path;
   RETURN_NOT_OK(S3Path::FromString(select.base_dir, &base_path));
   out->clear();
@@ -1214,6 +1379,41 @@ Status S3FileSystem::GetTargetStats(const Selector& select, std::vector<FileStat
   return impl_->Walk(select, base_path.bucket, base_path.key, out);
 }
 
+Status S3FileSystem::GetTargetStatsBatches(const Selector& select,
+                                           FileStatsIterator* out) {
+  S3Path base_path;
+  RETURN_NOT_OK(S3Path::FromString(select.base_dir, &base_path));
+
+  if (base_path.empty()) {
+    // List all buckets in a first batch, then walk them concurrently
+    std::vector<std::string> buckets;
+    RETURN_NOT_OK(impl_->ListBuckets(&buckets));
+    FileStatsVector bucket_stats;
+    for (const auto& bucket : buckets) {
+      FileStats st;
+      st.set_path(bucket);
+      st.set_type(FileType::Directory);
+      bucket_stats.push_back(std::move(st));
+    }
+    std::vector<FileStatsIterator> iterators;
+    if (!bucket_stats.empty()) {
+      std::vector<FileStatsVector> batches;
+      batches.push_back(std::move(bucket_stats));
+      iterators.push_back(MakeVectorIterator(std::move(batches)));
+    }
+    if (select.recursive) {
+      FileStatsIterator walk_it;
+      RETURN_NOT_OK(impl_->WalkAsync(select, buckets, "", &walk_it));
+      iterators.push_back(std::move(walk_it));
+    }
+    *out = MakeFlattenIterator(MakeVectorIterator(std::move(iterators)));
+    return Status::OK();
+  }
+
+  // Nominal case -> walk a single bucket
+  return impl_->WalkAsync(select, {base_path.bucket}, base_path.key, out);
+}
+
 Status S3FileSystem::CreateDir(const std::string& s, bool recursive) {
   S3Path path;
   RETURN_NOT_OK(S3Path::FromString(s, &path));
@@ -1357,7 +1557,8 @@ Status S3FileSystem::OpenInputStream(const std::string& s,
   RETURN_NOT_OK(S3Path::FromString(s, &path));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path);
+  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path,
+                                               impl_->options_);
   RETURN_NOT_OK(ptr->Init());
   *out = std::move(ptr);
   return Status::OK();
@@ -1369,7 +1570,8 @@ Status S3FileSystem::OpenInputFile(const std::string& s,
   RETURN_NOT_OK(S3Path::FromString(s, &path));
   RETURN_NOT_OK(ValidateFilePath(path));
 
-  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path);
+  auto ptr = std::make_shared<ObjectInputFile>(impl_->client_.get(), path,
+                                               impl_->options_);
   RETURN_NOT_OK(ptr->Init());
   *out = std::move(ptr);
   return Status::OK();
@@ -54,6 +54,19 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// Reads larger than this are split into ranged GETs issued concurrently
+  /// on the I/O thread pool.
+  int64_t parallel_read_threshold = 32 << 20;
+  /// Size of each ranged GET of a split read.
+  int64_t parallel_read_part_size = 8 << 20;
+  /// Maximum number of ranged GETs in flight for a single read (1 disables
+  /// splitting).
+  int parallel_read_concurrency = 8;
+
+  /// Maximum number of prefixes listed concurrently by recursive
+  /// GetTargetStats() and GetTargetStatsBatches() calls.
+  int listing_concurrency = 8;
+
   /// Configure with the default AWS credentials provider chain.
   void ConfigureDefaultCredentials();
 
@@ -84,6 +97,7 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   /// \endcond
   Status GetTargetStats(const std::string& path, FileStats* out) override;
   Status GetTargetStats(const Selector& select, std::vector<FileStats>* out) override;
+  Status GetTargetStatsBatches(const Selector& select, FileStatsIterator* out) override;
 
   Status CreateDir(const std::string& path, bool recursive = true) override;
 
@@ -99,8 +113,8 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   /// Create a sequential input stream for reading from a S3 object.
   ///
   /// NOTE: Reads from the stream will be synchronous and unbuffered.
-  /// You way want to wrap the stream in a BufferedInputStream or use
-  /// a custom readahead strategy to avoid idle waits.
+  /// You way want to wrap the stream in an io::ReadaheadInputStream to
+  /// avoid idle waits.
   Status OpenInputStream(const std::string& path,
                          std::shared_ptr<io::InputStream>* out) override;
 
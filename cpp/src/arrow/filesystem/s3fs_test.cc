@@ -16,6 +16,7 @@
 // under the License.
 
 #include <exception>
+#include <future>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -740,6 +741,52 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+TEST_F(TestS3FS, OpenInputFileParallelReads) {
+  options_.parallel_read_threshold = 100;
+  options_.parallel_read_part_size = 37;
+  options_.parallel_read_concurrency = 4;
+  MakeFileSystem();
+
+  std::string contents;
+  for (int i = 0; i < 1000; ++i) {
+    contents += static_cast<char>('a' + i % 26);
+  }
+  {
+    Aws::S3::Model::PutObjectRequest req;
+    req.SetBucket(ToAwsString("bucket"));
+    req.SetKey(ToAwsString("largefile"));
+    req.SetBody(std::make_shared<std::stringstream>(contents));
+    ASSERT_OK(OutcomeToStatus(client_->PutObject(req)));
+  }
+
+  std::shared_ptr<io::RandomAccessFile> file;
+  std::shared_ptr<Buffer> buf;
+  ASSERT_OK(fs_->OpenInputFile("bucket/largefile", &file));
+
+  // Below the threshold: a single GET
+  ASSERT_OK(file->ReadAt(10, 100, &buf));
+  AssertBufferEqual(*buf, contents.substr(10, 100));
+  // Split into parts, the last one shorter
+  ASSERT_OK(file->ReadAt(0, 1000, &buf));
+  AssertBufferEqual(*buf, contents);
+  ASSERT_OK(file->ReadAt(123, 500, &buf));
+  AssertBufferEqual(*buf, contents.substr(123, 500));
+  // Clamped to the end of the object
+  ASSERT_OK(file->ReadAt(800, 5000, &buf));
+  AssertBufferEqual(*buf, contents.substr(800));
+
+  // Split reads issued from the I/O thread pool itself
+  std::vector<std::future<Result<std::shared_ptr<Buffer>>>> futures;
+  for (int i = 0; i < 20; ++i) {
+    futures.push_back(file->ReadAsync(i * 10, 600));
+  }
+  for (int i = 0; i < 20; ++i) {
+    auto result = futures[i].get();
+    ASSERT_OK(result.status());
+    AssertBufferEqual(*result.ValueOrDie(), contents.substr(i * 10, 600));
+  }
+}
+
 TEST_F(TestS3FS, OpenOutputStreamBackgroundWrites) { TestOpenOutputStream(); }
 
 TEST_F(TestS3FS, OpenOutputStreamSyncWrites) {
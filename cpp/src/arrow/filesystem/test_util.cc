@@ -726,6 +726,59 @@ void GenericFileSystemTest::TestGetTargetStatsSelectorWithRecursion(FileSystem*
                          File("AA/AA.file")));
 }
 
+void GenericFileSystemTest::TestGetTargetStatsBatches(FileSystem* fs) {
+  ASSERT_OK(fs->CreateDir("01/02/03"));
+  ASSERT_OK(fs->CreateDir("AA"));
+  CreateFile(fs, "00.file", "00");
+  CreateFile(fs, "01/01.file", "01");
+  CreateFile(fs, "01/02/02.file", "02");
+  CreateFile(fs, "01/02/03/03.file", "03");
+  CreateFile(fs, "AA/AA.file", "aa");
+
+  auto collect = [&](const Selector& s, std::vector<FileStats>* out) -> Status {
+    FileStatsIterator it;
+    RETURN_NOT_OK(fs->GetTargetStatsBatches(s, &it));
+    out->clear();
+    for (auto maybe_batch : it) {
+      RETURN_NOT_OK(maybe_batch.status());
+      auto batch = std::move(maybe_batch).ValueOrDie();
+      EXPECT_FALSE(batch.empty());
+      out->insert(out->end(), batch.begin(), batch.end());
+    }
+    return Status::OK();
+  };
+
+  std::vector<FileStats> stats, expected;
+  Selector s;
+  for (const bool recursive : {false, true}) {
+    for (const std::string base_dir : {"", "01"}) {
+      s.base_dir = base_dir;
+      s.recursive = recursive;
+      ASSERT_OK(collect(s, &stats));
+      ASSERT_OK(fs->GetTargetStats(s, &expected));
+      SortStats(&stats);
+      SortStats(&expected);
+      ASSERT_EQ(stats, expected);
+    }
+  }
+  ASSERT_EQ(stats.size(), 5);
+
+  s.base_dir = "01";
+  s.max_recursion = 0;
+  ASSERT_OK(collect(s, &stats));
+  SortStats(&stats);
+  ASSERT_EQ(stats.size(), 2);
+  AssertFileStats(stats[0], "01/01.file", FileType::File, 2);
+  AssertFileStats(stats[1], "01/02", FileType::Directory);
+
+  // Doesn't exist
+  s.base_dir = "XX";
+  ASSERT_RAISES(IOError, collect(s, &stats));
+  s.allow_non_existent = true;
+  ASSERT_OK(collect(s, &stats));
+  ASSERT_EQ(stats.size(), 0);
+}
+
 void GenericFileSystemTest::TestOpenOutputStream(FileSystem* fs) {
   std::shared_ptr<io::OutputStream> stream;
   int64_t position = -1;
@@ -871,6 +924,7 @@ GENERIC_FS_TEST_DEFINE(TestGetTargetStatsSingle)
 GENERIC_FS_TEST_DEFINE(TestGetTargetStatsVector)
 GENERIC_FS_TEST_DEFINE(TestGetTargetStatsSelector)
 GENERIC_FS_TEST_DEFINE(TestGetTargetStatsSelectorWithRecursion)
+GENERIC_FS_TEST_DEFINE(TestGetTargetStatsBatches)
 GENERIC_FS_TEST_DEFINE(TestOpenOutputStream)
 GENERIC_FS_TEST_DEFINE(TestOpenAppendStream)
 GENERIC_FS_TEST_DEFINE(TestOpenInputStream)
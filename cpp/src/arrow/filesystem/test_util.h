@@ -112,6 +112,7 @@ class ARROW_EXPORT GenericFileSystemTest {
   void TestGetTargetStatsVector();
   void TestGetTargetStatsSelector();
   void TestGetTargetStatsSelectorWithRecursion();
+  void TestGetTargetStatsBatches();
   void TestOpenOutputStream();
   void TestOpenAppendStream();
   void TestOpenInputStream();
@@ -147,6 +148,7 @@ class ARROW_EXPORT GenericFileSystemTest {
   void TestGetTargetStatsVector(FileSystem* fs);
   void TestGetTargetStatsSelector(FileSystem* fs);
   void TestGetTargetStatsSelectorWithRecursion(FileSystem* fs);
+  void TestGetTargetStatsBatches(FileSystem* fs);
   void TestOpenOutputStream(FileSystem* fs);
   void TestOpenAppendStream(FileSystem* fs);
   void TestOpenInputStream(FileSystem* fs);
@@ -170,6 +172,7 @@ class ARROW_EXPORT GenericFileSystemTest {
   GENERIC_FS_TEST_FUNCTION(TEST_MACRO, TEST_CLASS, GetTargetStatsVector)                \
   GENERIC_FS_TEST_FUNCTION(TEST_MACRO, TEST_CLASS, GetTargetStatsSelector)              \
   GENERIC_FS_TEST_FUNCTION(TEST_MACRO, TEST_CLASS, GetTargetStatsSelectorWithRecursion) \
+  GENERIC_FS_TEST_FUNCTION(TEST_MACRO, TEST_CLASS, GetTargetStatsBatches)               \
   GENERIC_FS_TEST_FUNCTION(TEST_MACRO, TEST_CLASS, OpenOutputStream)                    \
   GENERIC_FS_TEST_FUNCTION(TEST_MACRO, TEST_CLASS, OpenAppendStream)                    \
   GENERIC_FS_TEST_FUNCTION(TEST_MACRO, TEST_CLASS, OpenInputStream)                     \
@@ -16,7 +16,16 @@
 // under the License.
 
 #include "arrow/filesystem/util_internal.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <utility>
+
 #include "arrow/buffer.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace fs {
@@ -46,6 +55,183 @@ Status CopyStream(const std::shared_ptr<io::InputStream>& src,
   return Status::OK();
 }
 
+namespace {
+
+// The state of a parallel listing, shared between the iterator and the
+// listing tasks.  Tasks are only spawned when there are pending directories
+// and idle capacity, and exit when no directory is pending, so that they never
+// block an I/O thread waiting for work.  Likewise, a consumer waiting for a
+// batch lists pending directories itself rather than waiting on the tasks,
+// which may be queued behind it if it runs on the I/O thread pool.
+class ParallelListing : public std::enable_shared_from_this<ParallelListing> {
+ public:
+  ParallelListing(ListDirFunction list_dir, int concurrency)
+      : list_dir_(std::move(list_dir)), concurrency_(std::max(1, concurrency)) {}
+
+  Status Start(std::vector<std::string> roots) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& root : roots) {
+      pending_.emplace_back(std::move(root), 0);
+    }
+    SpawnTasksUnlocked();
+    return status_;
+  }
+
+  Status Next(FileStatsVector* out) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    // Spawned tasks which aren't listing a directory won't produce any batch
+    while (batches_.empty() && status_.ok() && (listing_ > 0 || !pending_.empty())) {
+      if (pending_.empty()) {
+        cv_.wait(lock);
+      } else {
+        ListPending(&lock, /*in_task=*/false);
+      }
+    }
+    RETURN_NOT_OK(status_);
+    if (batches_.empty()) {
+      *out = IterationTraits<FileStatsVector>::End();
+    } else {
+      *out = std::move(batches_.front());
+      batches_.pop_front();
+    }
+    return Status::OK();
+  }
+
+  void Cancel() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cancelled_ = true;
+  }
+
+ protected:
+  void SpawnTasksUnlocked() {
+    auto pool = ::arrow::internal::GetIOThreadPool();
+    while (running_ < concurrency_ &&
+           static_cast<size_t>(running_ - listing_) < pending_.size()) {
+      auto self = shared_from_this();
+      Status st = pool->Spawn([self]() { self->RunTask(); });
+      if (!st.ok()) {
+        status_ = st;
+        return;
+      }
+      ++running_;
+    }
+  }
+
+  void RunTask() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!pending_.empty() && status_.ok() && !cancelled_) {
+      ListPending(&lock, /*in_task=*/true);
+    }
+    --running_;
+    cv_.notify_all();
+  }
+
+  // List the first pending directory, releasing the lock meanwhile
+  void ListPending(std::unique_lock<std::mutex>* lock, bool in_task) {
+    auto dir = std::move(pending_.front());
+    pending_.pop_front();
+    if (in_task) {
+      ++listing_;
+    }
+    lock->unlock();
+
+    FileStatsVector batch;
+    std::vector<std::string> subdirs;
+    Status st = list_dir_(dir.first, dir.second, &batch, &subdirs);
+
+    lock->lock();
+    if (in_task) {
+      --listing_;
+    }
+    if (!st.ok()) {
+      if (status_.ok()) {
+        status_ = st;
+      }
+    } else {
+      if (!batch.empty()) {
+        batches_.push_back(std::move(batch));
+      }
+      for (auto& subdir : subdirs) {
+        pending_.emplace_back(std::move(subdir), dir.second + 1);
+      }
+      SpawnTasksUnlocked();
+    }
+    cv_.notify_all();
+  }
+
+  const ListDirFunction list_dir_;
+  const int concurrency_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  // Directories to list, with their nesting depth
+  std::deque<std::pair<std::string, int32_t>> pending_;
+  std::deque<FileStatsVector> batches_;
+  // The number of spawned tasks, and of directories being listed by them
+  // (not counting those listed by the consumer)
+  int running_ = 0;
+  int listing_ = 0;
+  bool cancelled_ = false;
+  Status status_;
+};
+
+class ParallelListingIterator {
+ public:
+  explicit ParallelListingIterator(std::shared_ptr<ParallelListing> listing)
+      : listing_(std::move(listing)) {}
+
+  ParallelListingIterator(ParallelListingIterator&&) = default;
+  ParallelListingIterator& operator=(ParallelListingIterator&&) = default;
+
+  ~ParallelListingIterator() {
+    // Stop listing if the iterator is dropped before the end
+    if (listing_) {
+      listing_->Cancel();
+    }
+  }
+
+  Status Next(FileStatsVector* out) { return listing_->Next(out); }
+
+ protected:
+  std::shared_ptr<ParallelListing> listing_;
+};
+
+}  // namespace
+
+Status MakeParallelListing(std::vector<std::string> roots, ListDirFunction list_dir,
+                           int concurrency, FileStatsIterator* out) {
+  auto listing = std::make_shared<ParallelListing>(std::move(list_dir), concurrency);
+  RETURN_NOT_OK(listing->Start(std::move(roots)));
+  *out = FileStatsIterator(ParallelListingIterator(std::move(listing)));
+  return Status::OK();
+}
+
+Status CollectFileStats(FileStatsIterator it, FileStatsVector* out) {
+  out->clear();
+  while (true) {
+    FileStatsVector batch;
+    RETURN_NOT_OK(it.Next(&batch));
+    if (batch.empty()) {
+      break;
+    }
+    if (out->empty()) {
+      *out = std::move(batch);
+    } else {
+      out->insert(out->end(), std::make_move_iterator(batch.begin()),
+                  std::make_move_iterator(batch.end()));
+    }
+  }
+  SortFileStats(out);
+  return Status::OK();
+}
+
+void SortFileStats(FileStatsVector* stats) {
+  std::sort(stats->begin(), stats->end(),
+            [](const FileStats& left, const FileStats& right) {
+              return left.path() < right.path();
+            });
+}
+
 }  // namespace internal
 }  // namespace fs
 }  // namespace arrow
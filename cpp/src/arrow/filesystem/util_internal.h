@@ -17,7 +17,10 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/io/interfaces.h"
@@ -35,6 +38,30 @@ ARROW_EXPORT
 Status CopyStream(const std::shared_ptr<io::InputStream>& src,
                   const std::shared_ptr<io::OutputStream>& dest, int64_t chunk_size);
 
+// List a single directory, at the given nesting depth below the listing root.
+// Entries are appended to `out`, and the directories to recurse into (if any)
+// to `subdirs`.
+using ListDirFunction =
+    std::function<Status(const std::string& dir, int32_t nesting_depth,
+                         FileStatsVector* out, std::vector<std::string>* subdirs)>;
+
+// Walk directory trees from the given roots, listing up to `concurrency`
+// directories at a time on the I/O thread pool.  The returned iterator yields
+// one batch per non-empty directory, as soon as it is listed.  `list_dir` is
+// called concurrently and must be thread-safe.
+ARROW_EXPORT
+Status MakeParallelListing(std::vector<std::string> roots, ListDirFunction list_dir,
+                           int concurrency, FileStatsIterator* out);
+
+// Concatenate all batches of a FileStats iterator, sorted by path so that
+// the result doesn't depend on the order the batches were produced in
+ARROW_EXPORT
+Status CollectFileStats(FileStatsIterator it, FileStatsVector* out);
+
+// Sort FileStats by path
+ARROW_EXPORT
+void SortFileStats(FileStatsVector* stats);
+
 }  // namespace internal
 }  // namespace fs
 }  // namespace arrow
@@ -18,15 +18,20 @@
 #include "arrow/io/buffered.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
 
@@ -96,10 +101,26 @@ class BufferedOutputStream::Impl : public BufferedBase {
   explicit Impl(std::shared_ptr<OutputStream> raw, MemoryPool* pool)
       : BufferedBase(pool), raw_(std::move(raw)) {}
 
+  ~Impl() { StopWriter(); }
+
+  // Start writing filled buffers on a background thread
+  Status StartWriteBehind(int32_t max_pending_buffers) {
+    if (max_pending_buffers <= 0) {
+      return Status::Invalid("Number of pending buffers should be positive");
+    }
+    max_pending_buffers_ = max_pending_buffers;
+    writer_ = std::thread([this]() { WriterLoop(); });
+    return Status::OK();
+  }
+
   Status Close() {
     std::lock_guard<std::mutex> guard(lock_);
     if (is_open_) {
       Status st = FlushUnlocked();
+      if (st.ok()) {
+        st = WaitPendingWrites();
+      }
+      StopWriter();
       is_open_ = false;
       RETURN_NOT_OK(raw_->Close());
       return st;
@@ -111,6 +132,8 @@ class BufferedOutputStream::Impl : public BufferedBase {
     std::lock_guard<std::mutex> guard(lock_);
     if (is_open_) {
       is_open_ = false;
+      DiscardPendingWrites();
+      StopWriter();
       return raw_->Abort();
     }
     return Status::OK();
@@ -119,6 +142,8 @@ class BufferedOutputStream::Impl : public BufferedBase {
   Status Tell(int64_t* position) const {
     std::lock_guard<std::mutex> guard(lock_);
     if (raw_pos_ == -1) {
+      // The raw stream can only be queried once idle
+      RETURN_NOT_OK(WaitPendingWrites());
       RETURN_NOT_OK(raw_->Tell(&raw_pos_));
       DCHECK_GE(raw_pos_, 0);
     }
@@ -141,11 +166,23 @@ class BufferedOutputStream::Impl : public BufferedBase {
     if (nbytes == 0) {
       return Status::OK();
     }
+    if (write_behind()) {
+      RETURN_NOT_OK(CheckWriteError());
+    }
     if (nbytes + buffer_pos_ >= buffer_size_) {
       RETURN_NOT_OK(FlushUnlocked());
       DCHECK_EQ(buffer_pos_, 0);
       if (nbytes >= buffer_size_) {
         // Direct write
+        if (write_behind()) {
+          if (buffer) {
+            return EnqueueWrite(buffer, /*recycle=*/false);
+          }
+          // Don't copy large writes, write them once the background writes
+          // are done
+          RETURN_NOT_OK(WaitPendingWrites());
+          raw_pos_ = -1;
+        }
         if (buffer) {
           return raw_->Write(buffer);
         } else {
@@ -159,6 +196,16 @@ class BufferedOutputStream::Impl : public BufferedBase {
 
   Status FlushUnlocked() {
     if (buffer_pos_ > 0) {
+      if (write_behind()) {
+        // Hand the filled buffer to the background thread and continue with
+        // another one
+        RETURN_NOT_OK(buffer_->Resize(buffer_pos_, /*shrink_to_fit=*/false));
+        auto filled = std::move(buffer_);
+        buffer_pos_ = 0;
+        RETURN_NOT_OK(EnqueueWrite(filled, /*recycle=*/true));
+        buffer_ = TakeRecycledBuffer();
+        return ResetBuffer();
+      }
       // Invalidate cached raw pos
       raw_pos_ = -1;
       RETURN_NOT_OK(raw_->Write(buffer_data_, buffer_pos_));
@@ -169,12 +216,15 @@ class BufferedOutputStream::Impl : public BufferedBase {
 
   Status Flush() {
     std::lock_guard<std::mutex> guard(lock_);
-    return FlushUnlocked();
+    RETURN_NOT_OK(FlushUnlocked());
+    return WaitPendingWrites();
   }
 
   Status Detach(std::shared_ptr<OutputStream>* raw) {
     std::lock_guard<std::mutex> guard(lock_);
     RETURN_NOT_OK(FlushUnlocked());
+    RETURN_NOT_OK(WaitPendingWrites());
+    StopWriter();
     *raw = std::move(raw_);
     is_open_ = false;
     return Status::OK();
@@ -195,7 +245,118 @@ class BufferedOutputStream::Impl : public BufferedBase {
   std::shared_ptr<OutputStream> raw() const { return raw_; }
 
  private:
+  struct PendingWrite {
+    std::shared_ptr<Buffer> buffer;
+    // Whether the buffer is one of ours, to be reused once written
+    bool recycle;
+  };
+
+  bool write_behind() const { return max_pending_buffers_ > 0; }
+
+  // Queue a buffer for the background thread, waiting for room if needed
+  Status EnqueueWrite(std::shared_ptr<Buffer> buffer, bool recycle) {
+    std::unique_lock<std::mutex> lock(writer_mutex_);
+    writer_cv_.wait(lock, [this] {
+      return !write_error_.ok() ||
+             static_cast<int32_t>(pending_.size()) + writing_ < max_pending_buffers_;
+    });
+    RETURN_NOT_OK(write_error_);
+    if (raw_pos_ != -1) {
+      raw_pos_ += buffer->size();
+    }
+    pending_.push_back({std::move(buffer), recycle});
+    writer_cv_.notify_all();
+    return Status::OK();
+  }
+
+  // Wait for the background thread to write all pending buffers and
+  // return the first error it encountered, if any
+  Status WaitPendingWrites() const {
+    if (!write_behind()) {
+      return Status::OK();
+    }
+    std::unique_lock<std::mutex> lock(writer_mutex_);
+    writer_cv_.wait(lock, [this] { return pending_.empty() && writing_ == 0; });
+    return write_error_;
+  }
+
+  Status CheckWriteError() const {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    return write_error_;
+  }
+
+  void DiscardPendingWrites() {
+    std::unique_lock<std::mutex> lock(writer_mutex_);
+    pending_.clear();
+    writer_cv_.wait(lock, [this] { return writing_ == 0; });
+  }
+
+  std::shared_ptr<ResizableBuffer> TakeRecycledBuffer() {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    if (recycled_.empty()) {
+      return nullptr;
+    }
+    auto buffer = std::move(recycled_.back());
+    recycled_.pop_back();
+    return buffer;
+  }
+
+  void StopWriter() {
+    if (!writer_.joinable()) {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(writer_mutex_);
+      stop_writer_ = true;
+      writer_cv_.notify_all();
+    }
+    writer_.join();
+  }
+
+  void WriterLoop() {
+    std::unique_lock<std::mutex> lock(writer_mutex_);
+    while (true) {
+      writer_cv_.wait(lock, [this] { return stop_writer_ || !pending_.empty(); });
+      if (pending_.empty()) {
+        // Stop requested
+        break;
+      }
+      PendingWrite write = std::move(pending_.front());
+      pending_.pop_front();
+      // After an error, pending buffers are dropped
+      const bool failed = !write_error_.ok();
+      writing_ = 1;
+      lock.unlock();
+
+      Status st = failed ? Status::OK() : raw_->Write(write.buffer);
+
+      lock.lock();
+      writing_ = 0;
+      if (!st.ok()) {
+        write_error_ = st;
+      }
+      // Only reuse the buffer if the raw stream didn't keep a reference to it
+      if (write.recycle && write.buffer.use_count() == 1 && recycled_.empty()) {
+        recycled_.push_back(std::static_pointer_cast<ResizableBuffer>(write.buffer));
+      }
+      writer_cv_.notify_all();
+    }
+  }
+
   std::shared_ptr<OutputStream> raw_;
+
+  // Write-behind state, guarded by writer_mutex_
+  int32_t max_pending_buffers_ = 0;
+  std::thread writer_;
+  mutable std::mutex writer_mutex_;
+  mutable std::condition_variable writer_cv_;
+  std::deque<PendingWrite> pending_;
+  // 1 while the background thread is writing a buffer
+  int32_t writing_ = 0;
+  bool stop_writer_ = false;
+  Status write_error_;
+  // A written buffer kept for reuse
+  std::vector<std::shared_ptr<ResizableBuffer>> recycled_;
 };
 
 BufferedOutputStream::BufferedOutputStream(std::shared_ptr<OutputStream> raw,
@@ -213,6 +374,17 @@ Status BufferedOutputStream::Create(int64_t buffer_size, MemoryPool* pool,
   return Status::OK();
 }
 
+Status BufferedOutputStream::CreateWriteBehind(
+    int64_t buffer_size, int32_t max_pending_buffers, MemoryPool* pool,
+    std::shared_ptr<OutputStream> raw, std::shared_ptr<BufferedOutputStream>* out) {
+  auto result = std::shared_ptr<BufferedOutputStream>(
+      new BufferedOutputStream(std::move(raw), pool));
+  RETURN_NOT_OK(result->SetBufferSize(buffer_size));
+  RETURN_NOT_OK(result->impl_->StartWriteBehind(max_pending_buffers));
+  *out = std::move(result);
+  return Status::OK();
+}
+
 BufferedOutputStream::~BufferedOutputStream() { internal::CloseFromDestructor(this); }
 
 Status BufferedOutputStream::SetBufferSize(int64_t new_buffer_size) {
@@ -490,5 +662,211 @@ Status BufferedInputStream::DoRead(int64_t nbytes, std::shared_ptr<Buffer>* out)
   return impl_->Read(nbytes, out);
 }
 
+// ----------------------------------------------------------------------
+// ReadaheadInputStream implementation
+
+class ReadaheadInputStream::Impl {
+ public:
+  Impl(int64_t block_size, int32_t num_blocks, MemoryPool* pool,
+       std::shared_ptr<InputStream> raw)
+      : block_size_(block_size),
+        num_blocks_(num_blocks),
+        pool_(pool),
+        raw_(std::move(raw)) {}
+
+  Status Init() {
+    if (block_size_ <= 0) {
+      return Status::Invalid("Block size should be positive");
+    }
+    if (num_blocks_ <= 0) {
+      return Status::Invalid("Number of readahead blocks should be positive");
+    }
+    RETURN_NOT_OK(raw_->Tell(&position_));
+    Iterator<std::shared_ptr<Buffer>> blocks;
+    RETURN_NOT_OK(MakeInputStreamIterator(raw_, block_size_, &blocks));
+    return MakeReadaheadIterator(std::move(blocks), num_blocks_, &blocks_);
+  }
+
+  Status Close() {
+    if (is_open_) {
+      is_open_ = false;
+      // Stop the background thread before closing the stream it reads from
+      StopReadahead();
+      return raw_->Close();
+    }
+    return Status::OK();
+  }
+
+  Status Abort() {
+    if (is_open_) {
+      is_open_ = false;
+      StopReadahead();
+      return raw_->Abort();
+    }
+    return Status::OK();
+  }
+
+  bool closed() const { return !is_open_; }
+
+  Status Tell(int64_t* position) const {
+    RETURN_NOT_OK(CheckClosed());
+    *position = position_;
+    return Status::OK();
+  }
+
+  Status Peek(int64_t nbytes, util::string_view* out) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(EnsureBlock());
+    const int64_t available = BlockRemaining();
+    if (available == 0) {
+      *out = util::string_view();
+    } else {
+      *out = util::string_view(reinterpret_cast<const char*>(block_->data() + block_pos_),
+                               static_cast<size_t>(std::min(nbytes, available)));
+    }
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    RETURN_NOT_OK(CheckClosed());
+    auto dest = reinterpret_cast<uint8_t*>(out);
+    *bytes_read = 0;
+    while (*bytes_read < nbytes) {
+      RETURN_NOT_OK(EnsureBlock());
+      const int64_t chunk = std::min(nbytes - *bytes_read, BlockRemaining());
+      if (chunk == 0) {
+        // EOF
+        break;
+      }
+      std::memcpy(dest + *bytes_read, block_->data() + block_pos_, chunk);
+      Consume(chunk);
+      *bytes_read += chunk;
+    }
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(EnsureBlock());
+    if (nbytes <= BlockRemaining()) {
+      // Zero-copy slice of the current block
+      *out = SliceBuffer(block_, block_pos_, nbytes);
+      Consume(nbytes);
+      return Status::OK();
+    }
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
+    int64_t bytes_read;
+    RETURN_NOT_OK(Read(nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+      buffer->ZeroPadding();
+    }
+    *out = std::move(buffer);
+    return Status::OK();
+  }
+
+  int64_t block_size() const { return block_size_; }
+
+  int32_t num_blocks() const { return num_blocks_; }
+
+  std::shared_ptr<InputStream> raw() const { return raw_; }
+
+ private:
+  Status CheckClosed() const {
+    if (!is_open_) {
+      return Status::Invalid("Operation forbidden on closed ReadaheadInputStream");
+    }
+    return Status::OK();
+  }
+
+  int64_t BlockRemaining() const {
+    return block_ == nullptr ? 0 : block_->size() - block_pos_;
+  }
+
+  // Fetch the next block if the current one is exhausted
+  Status EnsureBlock() {
+    if (BlockRemaining() > 0 || eof_) {
+      return Status::OK();
+    }
+    block_pos_ = 0;
+    RETURN_NOT_OK(blocks_.Next(&block_));
+    if (block_ == nullptr) {
+      eof_ = true;
+    }
+    return Status::OK();
+  }
+
+  void Consume(int64_t nbytes) {
+    block_pos_ += nbytes;
+    position_ += nbytes;
+  }
+
+  void StopReadahead() {
+    // Destroying the readahead iterator joins its thread
+    blocks_ = Iterator<std::shared_ptr<Buffer>>();
+    block_.reset();
+  }
+
+  const int64_t block_size_;
+  const int32_t num_blocks_;
+  MemoryPool* pool_;
+  std::shared_ptr<InputStream> raw_;
+  bool is_open_ = true;
+
+  Iterator<std::shared_ptr<Buffer>> blocks_;
+  std::shared_ptr<Buffer> block_;
+  int64_t block_pos_ = 0;
+  bool eof_ = false;
+  int64_t position_ = 0;
+};
+
+ReadaheadInputStream::ReadaheadInputStream(int64_t block_size, int32_t num_blocks,
+                                           MemoryPool* pool,
+                                           std::shared_ptr<InputStream> raw)
+    : impl_(new Impl(block_size, num_blocks, pool, std::move(raw))) {}
+
+ReadaheadInputStream::~ReadaheadInputStream() { internal::CloseFromDestructor(this); }
+
+Status ReadaheadInputStream::Create(int64_t block_size, int32_t num_blocks,
+                                    MemoryPool* pool, std::shared_ptr<InputStream> raw,
+                                    std::shared_ptr<ReadaheadInputStream>* out) {
+  auto result = std::shared_ptr<ReadaheadInputStream>(
+      new ReadaheadInputStream(block_size, num_blocks, pool, std::move(raw)));
+  RETURN_NOT_OK(result->impl_->Init());
+  *out = std::move(result);
+  return Status::OK();
+}
+
+int64_t ReadaheadInputStream::block_size() const { return impl_->block_size(); }
+
+int32_t ReadaheadInputStream::num_blocks() const { return impl_->num_blocks(); }
+
+std::shared_ptr<InputStream> ReadaheadInputStream::raw() const { return impl_->raw(); }
+
+bool ReadaheadInputStream::closed() const { return impl_->closed(); }
+
+bool ReadaheadInputStream::supports_zero_copy() const { return true; }
+
+Status ReadaheadInputStream::DoClose() { return impl_->Close(); }
+
+Status ReadaheadInputStream::DoAbort() { return impl_->Abort(); }
+
+Status ReadaheadInputStream::DoTell(int64_t* position) const {
+  return impl_->Tell(position);
+}
+
+Status ReadaheadInputStream::DoPeek(int64_t nbytes, util::string_view* out) {
+  return impl_->Peek(nbytes, out);
+}
+
+Status ReadaheadInputStream::DoRead(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status ReadaheadInputStream::DoRead(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
 }  // namespace io
 }  // namespace arrow
@@ -50,6 +50,25 @@ class ARROW_EXPORT BufferedOutputStream : public OutputStream {
                        std::shared_ptr<OutputStream> raw,
                        std::shared_ptr<BufferedOutputStream>* out);
 
+  /// \brief Create a buffered output stream writing filled buffers to the
+  /// raw stream on a background thread ("write-behind").
+  ///
+  /// Write() only blocks when max_pending_buffers buffers are already being
+  /// written.  An error from the raw stream is returned by the next Write(),
+  /// Flush() or Close() call.  Flush() waits for all pending writes.  Since
+  /// the raw stream is written concurrently, it must not be used directly
+  /// once wrapped.
+  /// \param[in] buffer_size the size of the temporary write buffer
+  /// \param[in] max_pending_buffers the maximum number of filled buffers
+  /// handed to the background thread and not yet written
+  /// \param[in] pool a MemoryPool to use for allocations
+  /// \param[in] raw another OutputStream
+  /// \param[out] out the created BufferedOutputStream
+  /// \return Status
+  static Status CreateWriteBehind(int64_t buffer_size, int32_t max_pending_buffers,
+                                  MemoryPool* pool, std::shared_ptr<OutputStream> raw,
+                                  std::shared_ptr<BufferedOutputStream>* out);
+
   /// \brief Resize internal buffer
   /// \param[in] new_buffer_size the new buffer size
   /// \return Status
@@ -166,6 +185,63 @@ class ARROW_EXPORT BufferedInputStream
   std::unique_ptr<Impl> impl_;
 };
 
+/// \class ReadaheadInputStream
+/// \brief An InputStream reading blocks of a raw InputStream ahead of time on
+/// a background thread, which hides the latency of slow (e.g. remote) streams
+///
+/// Reads falling within a block return zero-copy slices of it. Since the raw
+/// stream is read concurrently, it must not be used directly once wrapped.
+class ARROW_EXPORT ReadaheadInputStream
+    : public internal::InputStreamConcurrencyWrapper<ReadaheadInputStream> {
+ public:
+  ~ReadaheadInputStream() override;
+
+  /// \brief Create a ReadaheadInputStream from a raw InputStream
+  /// \param[in] block_size the size of each read issued to the raw stream
+  /// \param[in] num_blocks the maximum number of blocks read in advance
+  /// \param[in] pool a MemoryPool for reads spanning several blocks
+  /// \param[in] raw a raw InputStream
+  /// \param[out] out the created ReadaheadInputStream
+  static Status Create(int64_t block_size, int32_t num_blocks, MemoryPool* pool,
+                       std::shared_ptr<InputStream> raw,
+                       std::shared_ptr<ReadaheadInputStream>* out);
+
+  int64_t block_size() const;
+
+  int32_t num_blocks() const;
+
+  /// \brief Return the raw InputStream
+  std::shared_ptr<InputStream> raw() const;
+
+  // InputStream APIs
+
+  bool closed() const override;
+
+  bool supports_zero_copy() const override;
+
+ private:
+  friend InputStreamConcurrencyWrapper<ReadaheadInputStream>;
+
+  ReadaheadInputStream(int64_t block_size, int32_t num_blocks, MemoryPool* pool,
+                       std::shared_ptr<InputStream> raw);
+
+  Status DoClose();
+  Status DoAbort() override;
+  Status DoTell(int64_t* position) const;
+  Status DoRead(int64_t nbytes, int64_t* bytes_read, void* out);
+
+  /// \brief Read into buffer. If the read falls within a block, then this
+  /// will return a slice of the block
+  Status DoRead(int64_t nbytes, std::shared_ptr<Buffer>* out);
+
+  /// \brief Return a zero-copy string view of the data remaining in the
+  /// current block, at most nbytes, without advancing the stream
+  Status DoPeek(int64_t nbytes, util::string_view* out) override;
+
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace io
 }  // namespace arrow
 
@@ -90,7 +90,10 @@ class FileTestFixture : public ::testing::Test {
 
 constexpr int64_t kDefaultBufferSize = 4096;
 
-class TestBufferedOutputStream : public FileTestFixture<BufferedOutputStream> {
+// The parameter is the number of pending buffers in write-behind mode,
+// or 0 for synchronous writes
+class TestBufferedOutputStream : public FileTestFixture<BufferedOutputStream>,
+                                 public ::testing::WithParamInterface<int32_t> {
  public:
   void OpenBuffered(int64_t buffer_size = kDefaultBufferSize, bool append = false) {
     // So that any open file is closed
@@ -107,8 +110,13 @@ class TestBufferedOutputStream : public FileTestFixture<BufferedOutputStream> {
       lseek(fd_, 0, SEEK_END);
 #endif
     }
-    ASSERT_OK(BufferedOutputStream::Create(buffer_size, default_memory_pool(), file,
-                                           &buffered_));
+    if (GetParam() > 0) {
+      ASSERT_OK(BufferedOutputStream::CreateWriteBehind(
+          buffer_size, GetParam(), default_memory_pool(), file, &buffered_));
+    } else {
+      ASSERT_OK(BufferedOutputStream::Create(buffer_size, default_memory_pool(), file,
+                                             &buffered_));
+    }
   }
 
   void WriteChunkwise(const std::string& datastr, const std::valarray<int64_t>& sizes) {
@@ -133,14 +141,14 @@ class TestBufferedOutputStream : public FileTestFixture<BufferedOutputStream> {
   }
 };
 
-TEST_F(TestBufferedOutputStream, DestructorClosesFile) {
+TEST_P(TestBufferedOutputStream, DestructorClosesFile) {
   OpenBuffered();
   ASSERT_FALSE(FileIsClosed(fd_));
   buffered_.reset();
   ASSERT_TRUE(FileIsClosed(fd_));
 }
 
-TEST_F(TestBufferedOutputStream, Detach) {
+TEST_P(TestBufferedOutputStream, Detach) {
   OpenBuffered();
   const std::string datastr = "1234568790";
 
@@ -159,7 +167,7 @@ TEST_F(TestBufferedOutputStream, Detach) {
   AssertFileContents(path_, datastr);
 }
 
-TEST_F(TestBufferedOutputStream, ExplicitCloseClosesFile) {
+TEST_P(TestBufferedOutputStream, ExplicitCloseClosesFile) {
   OpenBuffered();
   ASSERT_FALSE(buffered_->closed());
   ASSERT_FALSE(FileIsClosed(fd_));
@@ -172,14 +180,14 @@ TEST_F(TestBufferedOutputStream, ExplicitCloseClosesFile) {
   ASSERT_TRUE(FileIsClosed(fd_));
 }
 
-TEST_F(TestBufferedOutputStream, InvalidWrites) {
+TEST_P(TestBufferedOutputStream, InvalidWrites) {
   OpenBuffered();
 
   const char* data = "";
   ASSERT_RAISES(Invalid, buffered_->Write(data, -1));
 }
 
-TEST_F(TestBufferedOutputStream, TinyWrites) {
+TEST_P(TestBufferedOutputStream, TinyWrites) {
   OpenBuffered();
 
   const std::string datastr = "1234568790";
@@ -192,7 +200,7 @@ TEST_F(TestBufferedOutputStream, TinyWrites) {
   AssertFileContents(path_, datastr.substr(0, 8));
 }
 
-TEST_F(TestBufferedOutputStream, SmallWrites) {
+TEST_P(TestBufferedOutputStream, SmallWrites) {
   OpenBuffered();
 
   // Data here should be larger than BufferedOutputStream's buffer size
@@ -205,7 +213,7 @@ TEST_F(TestBufferedOutputStream, SmallWrites) {
   AssertFileContents(path_, data);
 }
 
-TEST_F(TestBufferedOutputStream, MixedWrites) {
+TEST_P(TestBufferedOutputStream, MixedWrites) {
   OpenBuffered();
 
   const std::string data = GenerateRandomData(300000);
@@ -217,7 +225,7 @@ TEST_F(TestBufferedOutputStream, MixedWrites) {
   AssertFileContents(path_, data);
 }
 
-TEST_F(TestBufferedOutputStream, LargeWrites) {
+TEST_P(TestBufferedOutputStream, LargeWrites) {
   OpenBuffered();
 
   const std::string data = GenerateRandomData(800000);
@@ -229,7 +237,7 @@ TEST_F(TestBufferedOutputStream, LargeWrites) {
   AssertFileContents(path_, data);
 }
 
-TEST_F(TestBufferedOutputStream, Flush) {
+TEST_P(TestBufferedOutputStream, Flush) {
   OpenBuffered();
 
   const std::string datastr = "1234568790";
@@ -243,7 +251,7 @@ TEST_F(TestBufferedOutputStream, Flush) {
   ASSERT_OK(buffered_->Close());
 }
 
-TEST_F(TestBufferedOutputStream, SetBufferSize) {
+TEST_P(TestBufferedOutputStream, SetBufferSize) {
   OpenBuffered(20);
 
   ASSERT_EQ(20, buffered_->buffer_size());
@@ -271,7 +279,7 @@ TEST_F(TestBufferedOutputStream, SetBufferSize) {
   ASSERT_OK(buffered_->Close());
 }
 
-TEST_F(TestBufferedOutputStream, Tell) {
+TEST_P(TestBufferedOutputStream, Tell) {
   OpenBuffered();
 
   AssertTell(0);
@@ -294,7 +302,7 @@ TEST_F(TestBufferedOutputStream, Tell) {
   AssertTell(0);
 }
 
-TEST_F(TestBufferedOutputStream, TruncatesFile) {
+TEST_P(TestBufferedOutputStream, TruncatesFile) {
   OpenBuffered();
 
   const std::string datastr = "1234568790";
@@ -307,6 +315,66 @@ TEST_F(TestBufferedOutputStream, TruncatesFile) {
   AssertFileContents(path_, "");
 }
 
+TEST_P(TestBufferedOutputStream, WriteBuffers) {
+  OpenBuffered(100);
+
+  const std::string data = GenerateRandomData(1000);
+  for (int64_t offset = 0; offset < 1000; offset += 250) {
+    // Alternate buffered and direct writes
+    ASSERT_OK(buffered_->Write(data.data() + offset, 50));
+    ASSERT_OK(buffered_->Write(Buffer::FromString(data.substr(offset + 50, 200))));
+  }
+  AssertTell(1000);
+  ASSERT_OK(buffered_->Close());
+
+  AssertFileContents(path_, data);
+}
+
+INSTANTIATE_TEST_CASE_P(Synchronous, TestBufferedOutputStream, ::testing::Values(0));
+INSTANTIATE_TEST_CASE_P(WriteBehind, TestBufferedOutputStream, ::testing::Values(1, 3));
+
+TEST(TestWriteBehindOutputStream, InvalidArguments) {
+  auto sink = std::make_shared<MockOutputStream>();
+  std::shared_ptr<BufferedOutputStream> stream;
+  ASSERT_RAISES(Invalid, BufferedOutputStream::CreateWriteBehind(
+                             100, 0, default_memory_pool(), sink, &stream));
+  ASSERT_RAISES(Invalid, BufferedOutputStream::CreateWriteBehind(
+                             0, 2, default_memory_pool(), sink, &stream));
+}
+
+TEST(TestWriteBehindOutputStream, WriteErrors) {
+  std::shared_ptr<BufferOutputStream> sink;
+  ASSERT_OK(BufferOutputStream::Create(64, default_memory_pool(), &sink));
+  std::shared_ptr<BufferedOutputStream> stream;
+  ASSERT_OK(BufferedOutputStream::CreateWriteBehind(10, 2, default_memory_pool(), sink,
+                                                    &stream));
+  const std::string data = "0123456789abcdef";
+  ASSERT_OK(stream->Write(data.data(), data.size()));
+  ASSERT_OK(stream->Flush());
+
+  // Make the raw stream fail: the background write error is reported by
+  // a subsequent call
+  ASSERT_OK(sink->Close());
+  ASSERT_OK(stream->Write(data.data(), 6));
+  ASSERT_OK(stream->Write(data.data(), 6));
+  ASSERT_RAISES(IOError, stream->Flush());
+  ASSERT_RAISES(IOError, stream->Write(data.data(), 1));
+  ASSERT_RAISES(IOError, stream->Close());
+  ASSERT_TRUE(stream->closed());
+}
+
+TEST(TestWriteBehindOutputStream, Abort) {
+  auto sink = std::make_shared<MockOutputStream>();
+  std::shared_ptr<BufferedOutputStream> stream;
+  ASSERT_OK(BufferedOutputStream::CreateWriteBehind(10, 2, default_memory_pool(), sink,
+                                                    &stream));
+  const std::string data = "0123456789abcdef";
+  ASSERT_OK(stream->Write(data.data(), data.size()));
+  ASSERT_OK(stream->Abort());
+  ASSERT_TRUE(stream->closed());
+  ASSERT_TRUE(sink->closed());
+}
+
 // ----------------------------------------------------------------------
 // BufferedInputStream tests
 
@@ -668,5 +736,114 @@ TEST_F(TestBufferedInputStreamBound, BufferExactlyExhausted) {
   }
 }
 
+// ----------------------------------------------------------------------
+// Readahead input stream tests
+
+class TestReadaheadInputStream : public ::testing::Test {
+ public:
+  void SetUp() {
+    data_ = GenerateRandomData(1000);
+    source_ = std::make_shared<BufferReader>(std::make_shared<Buffer>(data_));
+    // Start reading from a non-zero position
+    ASSERT_OK(source_->Advance(stream_offset_));
+  }
+
+  void MakeStream(int64_t block_size = 64, int32_t num_blocks = 4) {
+    ASSERT_OK(ReadaheadInputStream::Create(block_size, num_blocks, default_memory_pool(),
+                                           source_, &stream_));
+  }
+
+  void AssertReadsBack(int64_t position, int64_t nbytes,
+                       const std::shared_ptr<Buffer>& buffer) {
+    ASSERT_EQ(data_.substr(position, nbytes), buffer->ToString());
+  }
+
+ protected:
+  std::string data_;
+  int64_t stream_offset_ = 10;
+  std::shared_ptr<InputStream> source_;
+  std::shared_ptr<ReadaheadInputStream> stream_;
+};
+
+TEST_F(TestReadaheadInputStream, BasicOperation) {
+  MakeStream();
+  ASSERT_TRUE(stream_->supports_zero_copy());
+  ASSERT_EQ(64, stream_->block_size());
+  ASSERT_EQ(4, stream_->num_blocks());
+
+  int64_t position;
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(stream_offset_, position);
+
+  std::shared_ptr<Buffer> buffer, next;
+  ASSERT_OK(stream_->Read(20, &buffer));
+  AssertReadsBack(10, 20, buffer);
+  // Reads within a block are zero-copy slices
+  ASSERT_OK(stream_->Read(30, &next));
+  AssertReadsBack(30, 30, next);
+  ASSERT_EQ(buffer->data() + 20, next->data());
+
+  // A read spanning blocks
+  ASSERT_OK(stream_->Read(200, &buffer));
+  AssertReadsBack(60, 200, buffer);
+
+  std::string out(100, '\0');
+  int64_t bytes_read;
+  ASSERT_OK(stream_->Read(100, &bytes_read, &out[0]));
+  ASSERT_EQ(100, bytes_read);
+  ASSERT_EQ(data_.substr(260, 100), out);
+
+  util::string_view view;
+  ASSERT_OK(stream_->Peek(10, &view));
+  ASSERT_EQ(data_.substr(360, 10), view.to_string());
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(360, position);
+
+  // Read to the end
+  ASSERT_OK(stream_->Read(10000, &buffer));
+  AssertReadsBack(360, 640, buffer);
+  ASSERT_OK(stream_->Read(10, &buffer));
+  ASSERT_EQ(0, buffer->size());
+  ASSERT_OK(stream_->Peek(10, &view));
+  ASSERT_EQ(0, view.size());
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(1000, position);
+}
+
+TEST_F(TestReadaheadInputStream, SmallReads) {
+  MakeStream(/*block_size=*/7, /*num_blocks=*/2);
+  std::string result;
+  std::shared_ptr<Buffer> buffer;
+  do {
+    ASSERT_OK(stream_->Read(3, &buffer));
+    result += buffer->ToString();
+  } while (buffer->size() > 0);
+  ASSERT_EQ(data_.substr(10), result);
+}
+
+TEST_F(TestReadaheadInputStream, Close) {
+  MakeStream();
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream_->Read(10, &buffer));
+  ASSERT_FALSE(stream_->closed());
+  ASSERT_OK(stream_->Close());
+  ASSERT_TRUE(stream_->closed());
+  ASSERT_TRUE(source_->closed());
+  // Buffers already read remain valid
+  AssertReadsBack(10, 10, buffer);
+  ASSERT_RAISES(Invalid, stream_->Read(10, &buffer));
+  ASSERT_OK(stream_->Close());
+}
+
+TEST_F(TestReadaheadInputStream, InvalidArguments) {
+  ASSERT_RAISES(Invalid, ReadaheadInputStream::Create(0, 4, default_memory_pool(),
+                                                      source_, &stream_));
+  ASSERT_RAISES(Invalid, ReadaheadInputStream::Create(64, 0, default_memory_pool(),
+                                                      source_, &stream_));
+  ASSERT_OK(source_->Close());
+  ASSERT_RAISES(Invalid, ReadaheadInputStream::Create(64, 4, default_memory_pool(),
+                                                      source_, &stream_));
+}
+
 }  // namespace io
 }  // namespace arrow
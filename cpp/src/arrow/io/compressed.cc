@@ -18,7 +18,12 @@
 #include "arrow/io/compressed.h"
 
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
+#include <deque>
+#include <functional>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -30,15 +35,457 @@
 #include "arrow/status.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
+using internal::ThreadPool;
 using util::Codec;
 using util::Compressor;
 using util::Decompressor;
 
 namespace io {
 
+// ----------------------------------------------------------------------
+// Helpers for parallel (de)compression of independent frames
+
+namespace {
+
+uint32_t LoadLE16(const uint8_t* p) { return p[0] | (p[1] << 8); }
+
+uint32_t LoadLE32(const uint8_t* p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+void StoreLE16(uint32_t value, uint8_t* p) {
+  p[0] = static_cast<uint8_t>(value);
+  p[1] = static_cast<uint8_t>(value >> 8);
+}
+
+void StoreLE32(uint32_t value, uint8_t* p) {
+  StoreLE16(value, p);
+  StoreLE16(value >> 16, p + 2);
+}
+
+// gzip member header (RFC 1952)
+constexpr uint8_t kGZipId1 = 0x1f;
+constexpr uint8_t kGZipId2 = 0x8b;
+constexpr uint8_t kGZipFlagExtra = 0x04;
+constexpr int64_t kGZipHeaderSize = 10;
+// Size of the extra field recording the member size in members we write:
+// XLEN (2 bytes), then a subfield with ID "AR", SLEN (2 bytes) and the
+// total member size (4 bytes)
+constexpr int64_t kGZipSizeFieldLength = 10;
+
+// Frame magic numbers, in little-endian order
+constexpr uint32_t kZstdFrameMagic = 0xFD2FB528;
+constexpr uint32_t kLz4FrameMagic = 0x184D2204;
+// Skippable frames (shared by zstd and LZ4) use 16 consecutive magic numbers
+constexpr uint32_t kSkippableFrameMagic = 0x184D2A50;
+constexpr uint32_t kSkippableFrameMask = 0xFFFFFFF0;
+
+// Returned by the Find*End functions when a frame can't be delimited
+// without decompressing it
+constexpr int64_t kUnknownFrame = -1;
+
+// The Find*End functions return the size of the frame starting at `data`,
+// or 0 if more than `size` bytes are needed (a lower bound of the number of
+// bytes needed is then stored in `*needed`), or kUnknownFrame.
+
+int64_t FindGZipMemberEnd(const uint8_t* data, int64_t size, int64_t* needed) {
+  if (size < kGZipHeaderSize + 2) {
+    *needed = kGZipHeaderSize + 2;
+    return 0;
+  }
+  if ((data[3] & kGZipFlagExtra) == 0) {
+    return kUnknownFrame;
+  }
+  const int64_t extra_length = LoadLE16(data + kGZipHeaderSize);
+  const int64_t header_size = kGZipHeaderSize + 2 + extra_length;
+  if (size < header_size) {
+    *needed = header_size;
+    return 0;
+  }
+  const uint8_t* field = data + kGZipHeaderSize + 2;
+  const uint8_t* fields_end = data + header_size;
+  while (fields_end - field >= 4) {
+    const int64_t field_length = LoadLE16(field + 2);
+    if (fields_end - field - 4 < field_length) {
+      break;
+    }
+    int64_t member_size = 0;
+    if (field[0] == 'B' && field[1] == 'C' && field_length == 2) {
+      // bgzip block size, minus one
+      member_size = LoadLE16(field + 4) + 1;
+    } else if (field[0] == 'A' && field[1] == 'R' && field_length == 4) {
+      member_size = LoadLE32(field + 4);
+    }
+    if (member_size > 0) {
+      if (member_size < header_size) {
+        return kUnknownFrame;
+      }
+      if (size < member_size) {
+        *needed = member_size;
+        return 0;
+      }
+      return member_size;
+    }
+    field += 4 + field_length;
+  }
+  return kUnknownFrame;
+}
+
+int64_t FindZstdFrameEnd(const uint8_t* data, int64_t size, int64_t* needed) {
+  static const int kDictionaryIdSizes[] = {0, 1, 2, 4};
+  static const int kContentSizeSizes[] = {0, 2, 4, 8};
+  if (size < 5) {
+    *needed = 5;
+    return 0;
+  }
+  const uint8_t descriptor = data[4];
+  const int content_size_flag = descriptor >> 6;
+  const bool single_segment = (descriptor >> 5) & 1;
+  int64_t pos = 5 + (single_segment ? 0 : 1) + kDictionaryIdSizes[descriptor & 3];
+  if (single_segment && content_size_flag == 0) {
+    pos += 1;
+  } else {
+    pos += kContentSizeSizes[content_size_flag];
+  }
+  // Walk the block headers
+  while (true) {
+    if (size < pos + 3) {
+      *needed = pos + 3;
+      return 0;
+    }
+    const uint32_t block_header = LoadLE16(data + pos) | (data[pos + 2] << 16);
+    const bool last_block = block_header & 1;
+    const int block_type = (block_header >> 1) & 3;
+    if (block_type == 3) {
+      // Reserved block type
+      return kUnknownFrame;
+    }
+    // RLE blocks store a single byte
+    pos += 3 + (block_type == 1 ? 1 : (block_header >> 3));
+    if (last_block) {
+      break;
+    }
+  }
+  if (descriptor & 0x04) {
+    // Content checksum
+    pos += 4;
+  }
+  if (size < pos) {
+    *needed = pos;
+    return 0;
+  }
+  return pos;
+}
+
+int64_t FindLz4FrameEnd(const uint8_t* data, int64_t size, int64_t* needed) {
+  if (size < 7) {
+    *needed = 7;
+    return 0;
+  }
+  const uint8_t flags = data[4];
+  if ((flags >> 6) != 1) {
+    // Unsupported version
+    return kUnknownFrame;
+  }
+  // Magic, FLG and BD bytes, optional content size and dictionary id,
+  // then the header checksum
+  int64_t pos = 6 + ((flags & 0x08) ? 8 : 0) + ((flags & 0x01) ? 4 : 0) + 1;
+  // Walk the blocks up to the end mark
+  while (true) {
+    if (size < pos + 4) {
+      *needed = pos + 4;
+      return 0;
+    }
+    const uint32_t block_size = LoadLE32(data + pos) & 0x7FFFFFFF;
+    pos += 4;
+    if (block_size == 0) {
+      break;
+    }
+    pos += block_size + ((flags & 0x10) ? 4 : 0);
+  }
+  if (flags & 0x04) {
+    // Content checksum
+    pos += 4;
+  }
+  if (size < pos) {
+    *needed = pos;
+    return 0;
+  }
+  return pos;
+}
+
+// The frame formats that can be delimited without decompressing
+enum class FrameFormat { kNone, kGZip, kZstd, kLz4 };
+
+FrameFormat GetFrameFormat(const Codec& codec) {
+  if (std::strcmp(codec.name(), "gzip") == 0) {
+    return FrameFormat::kGZip;
+  }
+  if (std::strcmp(codec.name(), "zstd") == 0) {
+    return FrameFormat::kZstd;
+  }
+  if (std::strcmp(codec.name(), "lz4") == 0) {
+    return FrameFormat::kLz4;
+  }
+  return FrameFormat::kNone;
+}
+
+// Only frames of the codec's own format are delimited: data that merely
+// looks like another format's frame is left to the serial decompressor,
+// which reports it as corrupt.
+int64_t FindFrameEnd(FrameFormat format, const uint8_t* data, int64_t size,
+                     int64_t* needed) {
+  if (size < 8) {
+    *needed = 8;
+    return 0;
+  }
+  if (format == FrameFormat::kGZip) {
+    if (data[0] == kGZipId1 && data[1] == kGZipId2) {
+      return FindGZipMemberEnd(data, size, needed);
+    }
+    return kUnknownFrame;
+  }
+  if (format == FrameFormat::kNone) {
+    return kUnknownFrame;
+  }
+  const uint32_t magic = LoadLE32(data);
+  if (format == FrameFormat::kZstd && magic == kZstdFrameMagic) {
+    return FindZstdFrameEnd(data, size, needed);
+  }
+  if (format == FrameFormat::kLz4 && magic == kLz4FrameMagic) {
+    return FindLz4FrameEnd(data, size, needed);
+  }
+  if ((magic & kSkippableFrameMask) == kSkippableFrameMagic) {
+    const int64_t frame_size = 8 + static_cast<int64_t>(LoadLE32(data + 4));
+    if (size < frame_size) {
+      *needed = frame_size;
+      return 0;
+    }
+    return frame_size;
+  }
+  return kUnknownFrame;
+}
+
+// Compress a frame as a complete compressed stream
+Status CompressFrame(MemoryPool* pool, Codec* codec, const Buffer& frame,
+                     std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<Compressor> compressor;
+  RETURN_NOT_OK(codec->MakeCompressor(&compressor));
+
+  // For gzip, leave room for inserting the size field after the member header
+  const bool is_gzip = std::strcmp(codec->name(), "gzip") == 0;
+  const int64_t offset = is_gzip ? kGZipSizeFieldLength : 0;
+  std::shared_ptr<ResizableBuffer> compressed;
+  RETURN_NOT_OK(AllocateResizableBuffer(pool, offset + frame.size() / 2 + 1024,
+                                        &compressed));
+
+  int64_t pos = offset;
+  const uint8_t* input = frame.data();
+  int64_t input_len = frame.size();
+  while (input_len > 0) {
+    int64_t bytes_read, bytes_written;
+    RETURN_NOT_OK(compressor->Compress(input_len, input, compressed->size() - pos,
+                                       compressed->mutable_data() + pos, &bytes_read,
+                                       &bytes_written));
+    input += bytes_read;
+    input_len -= bytes_read;
+    pos += bytes_written;
+    if (bytes_read == 0 || pos == compressed->size()) {
+      RETURN_NOT_OK(compressed->Resize(compressed->size() * 2));
+    }
+  }
+  while (true) {
+    int64_t bytes_written;
+    bool should_retry;
+    RETURN_NOT_OK(compressor->End(compressed->size() - pos,
+                                  compressed->mutable_data() + pos, &bytes_written,
+                                  &should_retry));
+    pos += bytes_written;
+    if (!should_retry) {
+      break;
+    }
+    RETURN_NOT_OK(compressed->Resize(compressed->size() * 2));
+  }
+  RETURN_NOT_OK(compressed->Resize(pos));
+
+  uint8_t* data = compressed->mutable_data();
+  const uint8_t* header = data + offset;
+  if (is_gzip && pos - offset >= kGZipHeaderSize && header[0] == kGZipId1 &&
+      header[1] == kGZipId2 && header[3] == 0 &&
+      pos <= std::numeric_limits<uint32_t>::max()) {
+    // Move the member header to the front and record the member size
+    // in an extra field
+    memcpy(data, header, kGZipHeaderSize);
+    data[3] = kGZipFlagExtra;
+    uint8_t* field = data + kGZipHeaderSize;
+    StoreLE16(kGZipSizeFieldLength - 2, field);
+    field[2] = 'A';
+    field[3] = 'R';
+    StoreLE16(4, field + 4);
+    StoreLE32(static_cast<uint32_t>(pos), field + 6);
+    *out = compressed;
+  } else {
+    *out = SliceBuffer(compressed, offset);
+  }
+  return Status::OK();
+}
+
+// Decompress a frame holding a complete compressed stream
+Status DecompressFrame(MemoryPool* pool, Codec* codec, const Buffer& frame,
+                       std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<Decompressor> decompressor;
+  RETURN_NOT_OK(codec->MakeDecompressor(&decompressor));
+
+  int64_t output_size = std::max<int64_t>(64 * 1024, frame.size() * 4);
+  if (frame.size() >= 18 && frame.data()[0] == kGZipId1 && frame.data()[1] == kGZipId2) {
+    // gzip members end with the uncompressed size modulo 2^32.  Trust it
+    // only if it is plausible given the maximum deflate compression ratio.
+    const int64_t member_output_size = LoadLE32(frame.data() + frame.size() - 4);
+    if (member_output_size > 0 && member_output_size <= frame.size() * 1032) {
+      output_size = member_output_size;
+    }
+  }
+  std::shared_ptr<ResizableBuffer> decompressed;
+  RETURN_NOT_OK(AllocateResizableBuffer(pool, output_size, &decompressed));
+
+  int64_t pos = 0;
+  const uint8_t* input = frame.data();
+  int64_t input_len = frame.size();
+  while (!decompressor->IsFinished()) {
+    if (pos == decompressed->size()) {
+      RETURN_NOT_OK(decompressed->Resize(decompressed->size() * 2));
+    }
+    bool need_more_output;
+    int64_t bytes_read, bytes_written;
+    RETURN_NOT_OK(decompressor->Decompress(
+        input_len, input, decompressed->size() - pos, decompressed->mutable_data() + pos,
+        &bytes_read, &bytes_written, &need_more_output));
+    input += bytes_read;
+    input_len -= bytes_read;
+    pos += bytes_written;
+    if (bytes_read == 0 && bytes_written == 0) {
+      // No progress possible despite available output space
+      return Status::IOError("Truncated compressed stream");
+    }
+    if (need_more_output) {
+      RETURN_NOT_OK(decompressed->Resize(decompressed->size() * 2));
+    }
+  }
+  if (input_len > 0) {
+    return Status::IOError("Corrupt compressed stream: ", input_len,
+                           " unexpected bytes after the end of a frame");
+  }
+  RETURN_NOT_OK(decompressed->Resize(pos));
+  *out = decompressed;
+  return Status::OK();
+}
+
+// A frame (de)compression task.  It is run either by a thread pool worker or,
+// if none has picked it up yet, by the thread waiting for its result, which
+// avoids deadlocks when the waiting thread is itself a pool worker.
+class FrameTask {
+ public:
+  using Function = std::function<Status(std::shared_ptr<Buffer>*)>;
+
+  explicit FrameTask(Function func) : func_(std::move(func)) {}
+
+  void Run() {
+    if (started_.exchange(true)) {
+      return;
+    }
+    std::shared_ptr<Buffer> result;
+    Status st = func_(&result);
+    Finish(std::move(st), std::move(result));
+  }
+
+  // Prevent the task from running if it hasn't started yet
+  void Cancel() {
+    if (!started_.exchange(true)) {
+      Finish(Status::Invalid("Frame task cancelled"), nullptr);
+    }
+  }
+
+  Status Wait(std::shared_ptr<Buffer>* out) {
+    Run();
+    WaitFinished();
+    RETURN_NOT_OK(status_);
+    *out = std::move(result_);
+    return Status::OK();
+  }
+
+  void WaitFinished() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return finished_; });
+  }
+
+ private:
+  void Finish(Status st, std::shared_ptr<Buffer> result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    status_ = std::move(st);
+    result_ = std::move(result);
+    finished_ = true;
+    cv_.notify_all();
+  }
+
+  Function func_;
+  std::atomic<bool> started_{false};
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  bool finished_ = false;
+  Status status_;
+  std::shared_ptr<Buffer> result_;
+};
+
+// An ordered queue of frame tasks running on a thread pool
+class FrameQueue {
+ public:
+  void Init(const ParallelCompressionOptions& options) {
+    executor_ =
+        options.executor ? options.executor : ::arrow::internal::GetCpuThreadPool();
+    concurrency_ = options.concurrency > 0 ? options.concurrency
+                                           : std::max(executor_->GetCapacity(), 1);
+  }
+
+  bool empty() const { return tasks_.empty(); }
+  bool full() const { return static_cast<int>(tasks_.size()) >= concurrency_; }
+
+  Status Push(FrameTask::Function func) {
+    auto task = std::make_shared<FrameTask>(std::move(func));
+    tasks_.push_back(task);
+    return executor_->Spawn([task]() { task->Run(); });
+  }
+
+  // Wait for the result of the oldest task
+  Status Pop(std::shared_ptr<Buffer>* out) {
+    DCHECK(!tasks_.empty());
+    auto task = std::move(tasks_.front());
+    tasks_.pop_front();
+    return task->Wait(out);
+  }
+
+  // Cancel pending tasks and wait for running ones
+  void Clear() {
+    for (const auto& task : tasks_) {
+      task->Cancel();
+    }
+    for (const auto& task : tasks_) {
+      task->WaitFinished();
+    }
+    tasks_.clear();
+  }
+
+ private:
+  ThreadPool* executor_ = nullptr;
+  int concurrency_ = 1;
+  std::deque<std::shared_ptr<FrameTask>> tasks_;
+};
+
+}  // namespace
+
 // ----------------------------------------------------------------------
 // CompressedOutputStream implementation
 
@@ -55,6 +502,18 @@ class CompressedOutputStream::Impl {
     return Status::OK();
   }
 
+  Status Init(Codec* codec, const ParallelCompressionOptions& options) {
+    if (options.frame_size <= 0) {
+      return Status::Invalid("Compression frame size must be strictly positive");
+    }
+    RETURN_NOT_OK(Init(codec));
+    codec_ = codec;
+    frame_size_ = options.frame_size;
+    frames_.Init(options);
+    parallel_ = true;
+    return Status::OK();
+  }
+
   Status Tell(int64_t* position) const {
     std::lock_guard<std::mutex> guard(lock_);
     *position = total_pos_;
@@ -75,6 +534,9 @@ class CompressedOutputStream::Impl {
     std::lock_guard<std::mutex> guard(lock_);
 
     auto input = reinterpret_cast<const uint8_t*>(data);
+    if (parallel_) {
+      return WriteFrames(input, nbytes);
+    }
     while (nbytes > 0) {
       int64_t bytes_read, bytes_written;
       int64_t input_len = nbytes;
@@ -113,6 +575,11 @@ class CompressedOutputStream::Impl {
   Status Flush() {
     std::lock_guard<std::mutex> guard(lock_);
 
+    if (parallel_) {
+      // Cut the current frame short
+      RETURN_NOT_OK(SubmitFrame());
+      return WriteCompressedFrames(/*wait_all=*/true);
+    }
     while (true) {
       // Flush compressor
       int64_t bytes_written;
@@ -165,7 +632,18 @@ class CompressedOutputStream::Impl {
 
     if (is_open_) {
       is_open_ = false;
-      RETURN_NOT_OK(FinalizeCompression());
+      if (parallel_) {
+        Status st = SubmitFrame();
+        if (st.ok()) {
+          st = WriteCompressedFrames(/*wait_all=*/true);
+        }
+        if (!st.ok()) {
+          frames_.Clear();
+          return st;
+        }
+      } else {
+        RETURN_NOT_OK(FinalizeCompression());
+      }
       return raw_->Close();
     } else {
       return Status::OK();
@@ -177,6 +655,7 @@ class CompressedOutputStream::Impl {
 
     if (is_open_) {
       is_open_ = false;
+      frames_.Clear();
       return raw_->Abort();
     } else {
       return Status::OK();
@@ -189,6 +668,55 @@ class CompressedOutputStream::Impl {
   }
 
  private:
+  // Parallel mode: accumulate data into the current frame, submitting it
+  // for compression once full
+  Status WriteFrames(const uint8_t* input, int64_t nbytes) {
+    while (nbytes > 0) {
+      if (!frame_) {
+        RETURN_NOT_OK(AllocateResizableBuffer(pool_, frame_size_, &frame_));
+        frame_pos_ = 0;
+      }
+      const int64_t chunk_size = std::min(nbytes, frame_size_ - frame_pos_);
+      memcpy(frame_->mutable_data() + frame_pos_, input, chunk_size);
+      frame_pos_ += chunk_size;
+      input += chunk_size;
+      nbytes -= chunk_size;
+      total_pos_ += chunk_size;
+      if (frame_pos_ == frame_size_) {
+        RETURN_NOT_OK(SubmitFrame());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status SubmitFrame() {
+    if (!frame_ || frame_pos_ == 0) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(frame_->Resize(frame_pos_, /*shrink_to_fit=*/false));
+    std::shared_ptr<Buffer> frame = std::move(frame_);
+    frame_pos_ = 0;
+    // Bound the number of frames in flight
+    RETURN_NOT_OK(WriteCompressedFrames(/*wait_all=*/false));
+
+    auto pool = pool_;
+    auto codec = codec_;
+    return frames_.Push([pool, codec, frame](std::shared_ptr<Buffer>* out) {
+      return CompressFrame(pool, codec, *frame, out);
+    });
+  }
+
+  // Write out compressed frames in order, either until a new frame can be
+  // submitted or until all are written
+  Status WriteCompressedFrames(bool wait_all) {
+    while (!frames_.empty() && (wait_all || frames_.full())) {
+      std::shared_ptr<Buffer> compressed;
+      RETURN_NOT_OK(frames_.Pop(&compressed));
+      RETURN_NOT_OK(raw_->Write(compressed));
+    }
+    return Status::OK();
+  }
+
   // Write 64 KB compressed data at a time
   static const int64_t kChunkSize = 64 * 1024;
 
@@ -201,6 +729,16 @@ class CompressedOutputStream::Impl {
   // Total number of bytes compressed
   int64_t total_pos_;
 
+  // Parallel mode state
+  bool parallel_ = false;
+  Codec* codec_ = nullptr;
+  int64_t frame_size_ = 0;
+  // The frame being filled
+  std::shared_ptr<ResizableBuffer> frame_;
+  int64_t frame_pos_ = 0;
+  // The frames being compressed, in output order
+  FrameQueue frames_;
+
   mutable std::mutex lock_;
 };
 
@@ -221,6 +759,18 @@ Status CompressedOutputStream::Make(MemoryPool* pool, util::Codec* codec,
   return Status::OK();
 }
 
+Status CompressedOutputStream::Make(MemoryPool* pool, util::Codec* codec,
+                                    const std::shared_ptr<OutputStream>& raw,
+                                    const ParallelCompressionOptions& options,
+                                    std::shared_ptr<CompressedOutputStream>* out) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<CompressedOutputStream> res(new CompressedOutputStream);
+  res->impl_.reset(new Impl(pool, std::move(raw)));
+  RETURN_NOT_OK(res->impl_->Init(codec, options));
+  *out = res;
+  return Status::OK();
+}
+
 CompressedOutputStream::~CompressedOutputStream() { internal::CloseFromDestructor(this); }
 
 Status CompressedOutputStream::Close() { return impl_->Close(); }
@@ -260,9 +810,20 @@ class CompressedInputStream::Impl {
     return Status::OK();
   }
 
+  Status Init(Codec* codec, const ParallelCompressionOptions& options) {
+    RETURN_NOT_OK(Init(codec));
+    codec_ = codec;
+    frame_format_ = GetFrameFormat(*codec);
+    frames_.Init(options);
+    // Streams of other codecs can't be split into frames
+    parallel_ = frame_format_ != FrameFormat::kNone;
+    return Status::OK();
+  }
+
   Status Close() {
     if (is_open_) {
       is_open_ = false;
+      frames_.Clear();
       return raw_->Close();
     } else {
       return Status::OK();
@@ -272,6 +833,7 @@ class CompressedInputStream::Impl {
   Status Abort() {
     if (is_open_) {
       is_open_ = false;
+      frames_.Clear();
       return raw_->Abort();
     } else {
       return Status::OK();
@@ -302,15 +864,17 @@ class CompressedInputStream::Impl {
     int64_t decompress_size = kDecompressSize;
 
     while (true) {
-      RETURN_NOT_OK(AllocateResizableBuffer(pool_, decompress_size, &decompressed_));
+      std::shared_ptr<ResizableBuffer> decompressed;
+      RETURN_NOT_OK(AllocateResizableBuffer(pool_, decompress_size, &decompressed));
+      decompressed_ = decompressed;
       decompressed_pos_ = 0;
 
       bool need_more_output;
       int64_t bytes_read, bytes_written;
       int64_t input_len = compressed_->size() - compressed_pos_;
       const uint8_t* input = compressed_->data() + compressed_pos_;
-      int64_t output_len = decompressed_->size();
-      uint8_t* output = decompressed_->mutable_data();
+      int64_t output_len = decompressed->size();
+      uint8_t* output = decompressed->mutable_data();
 
       RETURN_NOT_OK(decompressor_->Decompress(input_len, input, output_len, output,
                                               &bytes_read, &bytes_written,
@@ -320,7 +884,7 @@ class CompressedInputStream::Impl {
         fresh_decompressor_ = false;
       }
       if (bytes_written > 0 || !need_more_output || input_len == 0) {
-        RETURN_NOT_OK(decompressed_->Resize(bytes_written));
+        RETURN_NOT_OK(decompressed->Resize(bytes_written));
         break;
       }
       DCHECK_EQ(bytes_written, 0);
@@ -348,8 +912,97 @@ class CompressedInputStream::Impl {
     return read_bytes;
   }
 
+  // Parallel mode: delimit the next frame in the compressed data and
+  // schedule its decompression.  If no frame can be delimited, either the
+  // input is exhausted or the remaining data is handed to the serial
+  // decompressor.
+  Status ScheduleFrame(bool* scheduled) {
+    *scheduled = false;
+    while (true) {
+      const int64_t available = pending_ ? pending_->size() - pending_pos_ : 0;
+      if (available == 0 && raw_eof_) {
+        return Status::OK();
+      }
+      int64_t needed = 0;
+      int64_t frame_size = 0;
+      if (available > 0) {
+        frame_size = FindFrameEnd(frame_format_, pending_->data() + pending_pos_,
+                                  available, &needed);
+      }
+      if (frame_size > 0) {
+        auto frame = SliceBuffer(pending_, pending_pos_, frame_size);
+        pending_pos_ += frame_size;
+        auto pool = pool_;
+        auto codec = codec_;
+        *scheduled = true;
+        return frames_.Push([pool, codec, frame](std::shared_ptr<Buffer>* out) {
+          return DecompressFrame(pool, codec, *frame, out);
+        });
+      }
+      if (frame_size == kUnknownFrame || raw_eof_) {
+        // Unsupported or truncated frame: let the serial decompressor
+        // handle the remaining data
+        compressed_ = SliceBuffer(pending_, pending_pos_);
+        compressed_pos_ = 0;
+        pending_.reset();
+        parallel_ = false;
+        return Status::OK();
+      }
+      RETURN_NOT_OK(ReadPending(std::max(needed - available, available)));
+    }
+  }
+
+  // Append at least `nbytes` of raw data to the pending compressed data
+  Status ReadPending(int64_t nbytes) {
+    std::shared_ptr<Buffer> chunk;
+    RETURN_NOT_OK(raw_->Read(std::max(nbytes, kChunkSize), &chunk));
+    if (chunk->size() == 0) {
+      raw_eof_ = true;
+      return Status::OK();
+    }
+    if (pending_ && pending_pos_ < pending_->size()) {
+      RETURN_NOT_OK(ConcatenateBuffers({SliceBuffer(pending_, pending_pos_), chunk},
+                                       pool_, &pending_));
+    } else {
+      pending_ = std::move(chunk);
+    }
+    pending_pos_ = 0;
+    return Status::OK();
+  }
+
+  // Parallel mode: take the decompressed data of the next frame, keeping
+  // as many frames in flight as allowed
+  Status RefillFromFrames(bool* has_data) {
+    while (true) {
+      bool scheduled = true;
+      while (parallel_ && scheduled && !frames_.full()) {
+        RETURN_NOT_OK(ScheduleFrame(&scheduled));
+      }
+      if (frames_.empty()) {
+        *has_data = false;
+        return Status::OK();
+      }
+      std::shared_ptr<Buffer> decompressed;
+      RETURN_NOT_OK(frames_.Pop(&decompressed));
+      // Skip empty frames (such as bgzip's end-of-file marker)
+      if (decompressed->size() > 0) {
+        decompressed_ = std::move(decompressed);
+        decompressed_pos_ = 0;
+        *has_data = true;
+        return Status::OK();
+      }
+    }
+  }
+
   // Try to feed more data into the decompressed_ buffer.
   Status RefillDecompressed(bool* has_data) {
+    if (parallel_ || !frames_.empty()) {
+      RETURN_NOT_OK(RefillFromFrames(has_data));
+      if (*has_data || parallel_) {
+        return Status::OK();
+      }
+      // Fall back to serial decompression of the remaining data
+    }
     // First try to read data from the decompressor
     if (compressed_) {
       if (decompressor_->IsFinished()) {
@@ -424,13 +1077,24 @@ class CompressedInputStream::Impl {
   std::shared_ptr<Buffer> compressed_;
   // Position in compressed buffer
   int64_t compressed_pos_;
-  std::shared_ptr<ResizableBuffer> decompressed_;
+  std::shared_ptr<Buffer> decompressed_;
   // Position in decompressed buffer
   int64_t decompressed_pos_;
   // True if the decompressor hasn't read any data yet.
   bool fresh_decompressor_;
   // Total number of bytes decompressed
   int64_t total_pos_;
+
+  // Parallel mode state
+  bool parallel_ = false;
+  Codec* codec_ = nullptr;
+  FrameFormat frame_format_ = FrameFormat::kNone;
+  // Compressed data not yet assigned to a frame
+  std::shared_ptr<Buffer> pending_;
+  int64_t pending_pos_ = 0;
+  bool raw_eof_ = false;
+  // The frames being decompressed, in input order
+  FrameQueue frames_;
 };
 
 Status CompressedInputStream::Make(Codec* codec, const std::shared_ptr<InputStream>& raw,
@@ -449,6 +1113,18 @@ Status CompressedInputStream::Make(MemoryPool* pool, Codec* codec,
   return Status::OK();
 }
 
+Status CompressedInputStream::Make(MemoryPool* pool, Codec* codec,
+                                   const std::shared_ptr<InputStream>& raw,
+                                   const ParallelCompressionOptions& options,
+                                   std::shared_ptr<CompressedInputStream>* out) {
+  // CAUTION: codec is not owned
+  std::shared_ptr<CompressedInputStream> res(new CompressedInputStream);
+  res->impl_.reset(new Impl(pool, std::move(raw)));
+  RETURN_NOT_OK(res->impl_->Init(codec, options));
+  *out = res;
+  return Status::OK();
+}
+
 CompressedInputStream::~CompressedInputStream() { internal::CloseFromDestructor(this); }
 
 Status CompressedInputStream::DoClose() { return impl_->Close(); }
@@ -20,6 +20,7 @@
 #ifndef ARROW_IO_COMPRESSED_H
 #define ARROW_IO_COMPRESSED_H
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -32,6 +33,12 @@ namespace arrow {
 class MemoryPool;
 class Status;
 
+namespace internal {
+
+class ThreadPool;
+
+}  // namespace internal
+
 namespace util {
 
 class Codec;
@@ -40,6 +47,20 @@ class Codec;
 
 namespace io {
 
+/// \brief EXPERIMENTAL: options for compressing or decompressing independent
+/// frames in parallel
+struct ARROW_EXPORT ParallelCompressionOptions {
+  /// The thread pool running the (de)compression tasks.
+  /// If null, the global CPU thread pool is used.
+  ::arrow::internal::ThreadPool* executor = NULLPTR;
+  /// The maximum number of frames being (de)compressed at once.
+  /// If 0, the capacity of the thread pool is used.
+  int concurrency = 0;
+  /// The number of uncompressed bytes in each frame written by
+  /// CompressedOutputStream.
+  int64_t frame_size = 1 << 20;
+};
+
 class ARROW_EXPORT CompressedOutputStream : public OutputStream {
  public:
   ~CompressedOutputStream() override;
@@ -51,6 +72,19 @@ class ARROW_EXPORT CompressedOutputStream : public OutputStream {
                      const std::shared_ptr<OutputStream>& raw,
                      std::shared_ptr<CompressedOutputStream>* out);
 
+  /// \brief Create a compressed output stream compressing frames in parallel.
+  ///
+  /// The data is cut into frames of options.frame_size bytes, which are
+  /// compressed independently on the thread pool and written out in order.
+  /// The result is a concatenation of complete compressed streams, readable
+  /// by any decompressor supporting concatenated streams.  gzip members
+  /// additionally record their size in an extra header field, so that
+  /// CompressedInputStream can decompress them in parallel.
+  static Status Make(MemoryPool* pool, util::Codec* codec,
+                     const std::shared_ptr<OutputStream>& raw,
+                     const ParallelCompressionOptions& options,
+                     std::shared_ptr<CompressedOutputStream>* out);
+
   // OutputStream interface
 
   /// \brief Close the compressed output stream.  This implicitly closes the
@@ -91,6 +125,19 @@ class ARROW_EXPORT CompressedInputStream
                      const std::shared_ptr<InputStream>& raw,
                      std::shared_ptr<CompressedInputStream>* out);
 
+  /// \brief Create a compressed input stream decompressing frames in parallel.
+  ///
+  /// Independent frames are delimited without being decompressed, then
+  /// decompressed concurrently on the thread pool; the output is yielded in
+  /// order.  This is supported for zstd frames, LZ4 frames and gzip members
+  /// recording their size in an extra header field (as written by bgzip or
+  /// a parallel CompressedOutputStream).  Only frames of the codec's own
+  /// format are delimited; other data is decompressed serially.
+  static Status Make(MemoryPool* pool, util::Codec* codec,
+                     const std::shared_ptr<InputStream>& raw,
+                     const ParallelCompressionOptions& options,
+                     std::shared_ptr<CompressedInputStream>* out);
+
   // InputStream interface
 
   bool closed() const override;
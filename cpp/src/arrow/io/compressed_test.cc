@@ -33,10 +33,12 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/compression.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
 
+using ::arrow::internal::ThreadPool;
 using ::arrow::util::Codec;
 
 #ifdef ARROW_VALGRIND
@@ -80,13 +82,8 @@ std::shared_ptr<Buffer> CompressDataOneShot(Codec* codec,
   return std::move(compressed);
 }
 
-Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
-                                int64_t* stream_pos, std::vector<uint8_t>* out) {
-  // Create compressed input stream
-  auto buffer_reader = std::make_shared<BufferReader>(compressed);
-  std::shared_ptr<CompressedInputStream> stream;
-  RETURN_NOT_OK(CompressedInputStream::Make(codec, buffer_reader, &stream));
-
+Status ReadCompressedInputStream(CompressedInputStream* stream, int64_t* stream_pos,
+                                 std::vector<uint8_t>* out) {
   std::vector<uint8_t> decompressed;
   int64_t decompressed_size = 0;
   const int64_t chunk_size = 1111;
@@ -108,11 +105,79 @@ Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed
   return Status::OK();
 }
 
+Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
+                                int64_t* stream_pos, std::vector<uint8_t>* out) {
+  // Create compressed input stream
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  std::shared_ptr<CompressedInputStream> stream;
+  RETURN_NOT_OK(CompressedInputStream::Make(codec, buffer_reader, &stream));
+  return ReadCompressedInputStream(stream.get(), stream_pos, out);
+}
+
 Status RunCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
                                 std::vector<uint8_t>* out) {
   return RunCompressedInputStream(codec, compressed, nullptr, out);
 }
 
+ParallelCompressionOptions MakeParallelOptions() {
+  static std::shared_ptr<ThreadPool> pool = [] {
+    std::shared_ptr<ThreadPool> pool;
+    ABORT_NOT_OK(ThreadPool::Make(3, &pool));
+    return pool;
+  }();
+  ParallelCompressionOptions options;
+  options.executor = pool.get();
+  options.concurrency = 4;
+  options.frame_size = 100 * 1024;
+  return options;
+}
+
+Status RunParallelCompressedInputStream(Codec* codec, std::shared_ptr<Buffer> compressed,
+                                        std::vector<uint8_t>* out) {
+  auto buffer_reader = std::make_shared<BufferReader>(compressed);
+  std::shared_ptr<CompressedInputStream> stream;
+  RETURN_NOT_OK(CompressedInputStream::Make(default_memory_pool(), codec, buffer_reader,
+                                            MakeParallelOptions(), &stream));
+  int64_t stream_pos = -1;
+  RETURN_NOT_OK(ReadCompressedInputStream(stream.get(), &stream_pos, out));
+  if (stream_pos != static_cast<int64_t>(out->size())) {
+    return Status::Invalid("Unexpected stream position ", stream_pos);
+  }
+  return Status::OK();
+}
+
+// Compress data with a parallel CompressedOutputStream
+std::shared_ptr<Buffer> CompressDataParallel(Codec* codec,
+                                             const std::vector<uint8_t>& data,
+                                             int flush_interval = 0) {
+  std::shared_ptr<BufferOutputStream> buffer_writer;
+  ABORT_NOT_OK(BufferOutputStream::Create(1024, default_memory_pool(), &buffer_writer));
+  std::shared_ptr<CompressedOutputStream> stream;
+  ABORT_NOT_OK(CompressedOutputStream::Make(default_memory_pool(), codec, buffer_writer,
+                                            MakeParallelOptions(), &stream));
+
+  const uint8_t* input = data.data();
+  int64_t input_len = data.size();
+  const int64_t chunk_size = 1111;
+  for (int i = 1; input_len > 0; ++i) {
+    int64_t nbytes = std::min(chunk_size, input_len);
+    ABORT_NOT_OK(stream->Write(input, nbytes));
+    input += nbytes;
+    input_len -= nbytes;
+    if (flush_interval > 0 && i % flush_interval == 0) {
+      ABORT_NOT_OK(stream->Flush());
+    }
+  }
+  int64_t pos = -1;
+  ABORT_NOT_OK(stream->Tell(&pos));
+  ARROW_CHECK_EQ(pos, static_cast<int64_t>(data.size()));
+  ABORT_NOT_OK(stream->Close());
+
+  std::shared_ptr<Buffer> compressed;
+  ABORT_NOT_OK(buffer_writer->Finish(&compressed));
+  return compressed;
+}
+
 void CheckCompressedInputStream(Codec* codec, const std::vector<uint8_t>& data) {
   // Create compressed data
   auto compressed = CompressDataOneShot(codec, data);
@@ -162,6 +227,26 @@ void CheckCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
   ASSERT_EQ(decompressed, data);
 }
 
+void CheckParallelCompressedInputStream(Codec* codec, const std::vector<uint8_t>& data) {
+  // Data compressed as a single stream is decompressed serially
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunParallelCompressedInputStream(codec, CompressDataOneShot(codec, data),
+                                             &decompressed));
+  ASSERT_EQ(decompressed, data);
+}
+
+void CheckParallelCompressedOutputStream(Codec* codec, const std::vector<uint8_t>& data,
+                                         int flush_interval) {
+  auto compressed = CompressDataParallel(codec, data, flush_interval);
+
+  // The concatenated frames can be decompressed both serially and in parallel
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunCompressedInputStream(codec, compressed, &decompressed));
+  ASSERT_EQ(decompressed, data);
+  ASSERT_OK(RunParallelCompressedInputStream(codec, compressed, &decompressed));
+  ASSERT_EQ(decompressed, data);
+}
+
 class CompressedInputStreamTest : public ::testing::TestWithParam<Compression::type> {
  protected:
   Compression::type GetCompression() { return GetParam(); }
@@ -241,6 +326,22 @@ TEST_P(CompressedInputStreamTest, ConcatenatedStreams) {
   ASSERT_EQ(decompressed, expected);
 }
 
+TEST_P(CompressedInputStreamTest, Parallel) {
+  auto codec = MakeCodec();
+
+  CheckParallelCompressedInputStream(codec.get(),
+                                     MakeCompressibleData(COMPRESSIBLE_DATA_SIZE));
+  CheckParallelCompressedInputStream(codec.get(), MakeRandomData(RANDOM_DATA_SIZE));
+
+  auto data = MakeRandomData(10000);
+  auto compressed = CompressDataOneShot(codec.get(), data);
+  std::vector<uint8_t> decompressed;
+  ASSERT_RAISES(IOError,
+                RunParallelCompressedInputStream(
+                    codec.get(), SliceBuffer(compressed, 0, compressed->size() - 3),
+                    &decompressed));
+}
+
 TEST_P(CompressedOutputStreamTest, CompressibleData) {
   auto codec = MakeCodec();
   auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
@@ -257,6 +358,84 @@ TEST_P(CompressedOutputStreamTest, RandomData) {
   CheckCompressedOutputStream(codec.get(), data, true /* do_flush */);
 }
 
+TEST_P(CompressedOutputStreamTest, Parallel) {
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+
+  CheckParallelCompressedOutputStream(codec.get(), data, 0 /* flush_interval */);
+  CheckParallelCompressedOutputStream(codec.get(), data, 50 /* flush_interval */);
+
+  data = MakeRandomData(RANDOM_DATA_SIZE);
+  CheckParallelCompressedOutputStream(codec.get(), data, 0 /* flush_interval */);
+
+  // Empty data
+  CheckParallelCompressedOutputStream(codec.get(), {}, 0 /* flush_interval */);
+}
+
+// Tests for the codecs whose streams can be split into independent frames
+class CompressedFramesTest : public ::testing::TestWithParam<Compression::type> {
+ protected:
+  std::unique_ptr<Codec> MakeCodec() {
+    std::unique_ptr<Codec> codec;
+    ABORT_NOT_OK(Codec::Create(GetParam(), &codec));
+    return codec;
+  }
+
+  // A well-formed empty frame of a format other than the codec's
+  std::shared_ptr<Buffer> MakeForeignFrame() {
+    if (GetParam() == Compression::GZIP) {
+      // LZ4 frame: magic, FLG, BD and header checksum, then the end mark
+      return std::make_shared<Buffer>(
+          std::string("\x04\x22\x4d\x18\x40\x40\xc0\x00\x00\x00\x00", 11));
+    }
+    // gzip member header with an "AR" subfield recording a 30 byte member
+    return std::make_shared<Buffer>(
+        std::string("\x1f\x8b\x08\x04\x00\x00\x00\x00\x00\xff\x08\x00"
+                    "AR\x04\x00\x1e\x00\x00\x00\x03\x00\x00\x00\x00\x00"
+                    "\x00\x00\x00\x00",
+                    30));
+  }
+};
+
+TEST_P(CompressedFramesTest, ConcatenatedFrames) {
+  auto codec = MakeCodec();
+  // Each stream is cut into several frames
+  std::vector<uint8_t> expected;
+  std::vector<std::shared_ptr<Buffer>> streams;
+  for (const auto& data :
+       {MakeCompressibleData(250 * 1024), MakeRandomData(150 * 1024),
+        MakeCompressibleData(1000)}) {
+    streams.push_back(CompressDataParallel(codec.get(), data));
+    std::copy(data.begin(), data.end(), std::back_inserter(expected));
+  }
+  std::shared_ptr<Buffer> concatenated;
+  ASSERT_OK(ConcatenateBuffers(streams, default_memory_pool(), &concatenated));
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunParallelCompressedInputStream(codec.get(), concatenated, &decompressed));
+  ASSERT_EQ(decompressed, expected);
+  ASSERT_OK(RunCompressedInputStream(codec.get(), concatenated, &decompressed));
+  ASSERT_EQ(decompressed, expected);
+}
+
+TEST_P(CompressedFramesTest, ForeignFrames) {
+  // Frames of other formats are not delimited, but left to the serial
+  // decompressor which rejects them
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(1000);
+  std::shared_ptr<Buffer> concatenated;
+  ASSERT_OK(ConcatenateBuffers({CompressDataParallel(codec.get(), data),
+                                MakeForeignFrame()},
+                               default_memory_pool(), &concatenated));
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_RAISES(IOError, RunParallelCompressedInputStream(codec.get(), concatenated,
+                                                          &decompressed));
+  ASSERT_RAISES(IOError, RunParallelCompressedInputStream(codec.get(),
+                                                          MakeForeignFrame(),
+                                                          &decompressed));
+}
+
 // NOTES:
 // - Snappy doesn't support streaming decompression
 // - BZ2 doesn't support one-shot compression
@@ -284,10 +463,81 @@ TEST(TestSnappyOutputStream, NotImplemented) {
 #endif
 
 #ifdef ARROW_WITH_ZLIB
+class TestGZipParallelStreams : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    ASSERT_OK(Codec::Create(Compression::GZIP, &codec_));
+    data_ = MakeCompressibleData(1000 * 1000);
+    compressed_ = CompressDataParallel(codec_.get(), data_);
+  }
+
+  // Return the size of the gzip member starting at `offset`
+  int64_t MemberSize(int64_t offset) {
+    const uint8_t* header = compressed_->data() + offset;
+    // FEXTRA flag, XLEN and the "AR" subfield holding the member size
+    EXPECT_EQ(0x04, header[3]);
+    EXPECT_EQ(8, header[10]);
+    EXPECT_EQ('A', header[12]);
+    EXPECT_EQ('R', header[13]);
+    return header[16] | (header[17] << 8) | (header[18] << 16) | (header[19] << 24);
+  }
+
+  std::unique_ptr<Codec> codec_;
+  std::vector<uint8_t> data_;
+  std::shared_ptr<Buffer> compressed_;
+};
+
+TEST_F(TestGZipParallelStreams, MemberSizes) {
+  int64_t offset = 0;
+  int num_members = 0;
+  while (offset < compressed_->size()) {
+    offset += MemberSize(offset);
+    ++num_members;
+  }
+  ASSERT_EQ(offset, compressed_->size());
+  ASSERT_EQ(num_members, 10);
+}
+
+TEST_F(TestGZipParallelStreams, BGZipEndOfFile) {
+  // The empty block terminating bgzip files
+  const std::string eof_marker(
+      "\x1f\x8b\x08\x04\x00\x00\x00\x00\x00\xff\x06\x00\x42\x43\x02\x00\x1b\x00"
+      "\x03\x00\x00\x00\x00\x00\x00\x00\x00\x00",
+      28);
+  std::shared_ptr<Buffer> concatenated;
+  ASSERT_OK(ConcatenateBuffers({compressed_, std::make_shared<Buffer>(eof_marker)},
+                               default_memory_pool(), &concatenated));
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_OK(RunParallelCompressedInputStream(codec_.get(), concatenated, &decompressed));
+  ASSERT_EQ(decompressed, data_);
+}
+
+TEST_F(TestGZipParallelStreams, CorruptMember) {
+  // Corrupt the CRC of the second member
+  std::shared_ptr<Buffer> corrupt;
+  ASSERT_OK(compressed_->Copy(0, compressed_->size(), &corrupt));
+  const int64_t second_member_end = MemberSize(0) + MemberSize(MemberSize(0));
+  corrupt->mutable_data()[second_member_end - 8] ^= 0xff;
+
+  std::vector<uint8_t> decompressed;
+  ASSERT_RAISES(IOError,
+                RunParallelCompressedInputStream(codec_.get(), corrupt, &decompressed));
+}
+
+TEST_F(TestGZipParallelStreams, Truncated) {
+  auto truncated = SliceBuffer(compressed_, 0, compressed_->size() - 3);
+  std::vector<uint8_t> decompressed;
+  ASSERT_RAISES(IOError,
+                RunParallelCompressedInputStream(codec_.get(), truncated, &decompressed));
+}
+
 INSTANTIATE_TEST_CASE_P(TestGZipInputStream, CompressedInputStreamTest,
                         ::testing::Values(Compression::GZIP));
 INSTANTIATE_TEST_CASE_P(TestGZipOutputStream, CompressedOutputStreamTest,
                         ::testing::Values(Compression::GZIP));
+INSTANTIATE_TEST_CASE_P(TestGZipFrames, CompressedFramesTest,
+                        ::testing::Values(Compression::GZIP));
 #endif
 
 #ifdef ARROW_WITH_BROTLI
@@ -302,6 +552,13 @@ INSTANTIATE_TEST_CASE_P(TestZSTDInputStream, CompressedInputStreamTest,
                         ::testing::Values(Compression::ZSTD));
 INSTANTIATE_TEST_CASE_P(TestZSTDOutputStream, CompressedOutputStreamTest,
                         ::testing::Values(Compression::ZSTD));
+INSTANTIATE_TEST_CASE_P(TestZSTDFrames, CompressedFramesTest,
+                        ::testing::Values(Compression::ZSTD));
+#endif
+
+#ifdef ARROW_WITH_LZ4
+INSTANTIATE_TEST_CASE_P(TestLZ4Frames, CompressedFramesTest,
+                        ::testing::Values(Compression::LZ4));
 #endif
 
 }  // namespace io
@@ -26,6 +26,7 @@
 #undef Realloc
 #undef Free
 #else
+#include <fcntl.h>
 #include <sys/mman.h>
 #include <unistd.h>  // IWYU pragma: keep
 #endif
@@ -33,12 +34,14 @@
 #include <algorithm>
 #include <atomic>
 #include <cerrno>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <vector>
 
 // ----------------------------------------------------------------------
 // Other Arrow includes
@@ -52,10 +55,118 @@
 #include "arrow/status.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
 
+using ::arrow::internal::ErrnoMessage;
+
+namespace {
+
+// Enable or disable direct I/O on an open file
+Status SetDirectIO(int fd, bool enable) {
+#if defined(O_DIRECT)
+  int flags = fcntl(fd, F_GETFL);
+  if (flags != -1) {
+    flags = enable ? (flags | O_DIRECT) : (flags & ~O_DIRECT);
+    flags = fcntl(fd, F_SETFL, flags);
+  }
+  if (flags == -1) {
+    return Status::IOError("Failed to set direct I/O on file: ", ErrnoMessage(errno));
+  }
+  return Status::OK();
+#elif defined(F_NOCACHE)
+  if (fcntl(fd, F_NOCACHE, enable ? 1 : 0) == -1) {
+    return Status::IOError("Failed to set direct I/O on file: ", ErrnoMessage(errno));
+  }
+  return Status::OK();
+#else
+  return Status::NotImplemented("Direct I/O is not supported on this platform");
+#endif
+}
+
+// Best-effort hints to the page cache; errors are ignored
+void AdviseAccess(int fd, FileAccessHint::type hint) {
+#if defined(POSIX_FADV_NORMAL)
+  int advice = POSIX_FADV_NORMAL;
+  if (hint == FileAccessHint::SEQUENTIAL) {
+    advice = POSIX_FADV_SEQUENTIAL;
+  } else if (hint == FileAccessHint::RANDOM) {
+    advice = POSIX_FADV_RANDOM;
+  }
+  ARROW_UNUSED(posix_fadvise(fd, 0, 0, advice));
+#else
+  ARROW_UNUSED(fd);
+  ARROW_UNUSED(hint);
+#endif
+}
+
+// A length of 0 means the end of the file
+void AdviseDontNeed(int fd, int64_t offset, int64_t nbytes) {
+#if defined(POSIX_FADV_DONTNEED)
+  ARROW_UNUSED(posix_fadvise(fd, offset, nbytes, POSIX_FADV_DONTNEED));
+#else
+  ARROW_UNUSED(fd);
+  ARROW_UNUSED(offset);
+  ARROW_UNUSED(nbytes);
+#endif
+}
+
+Status SyncFile(int fd) {
+#ifdef _WIN32
+  ARROW_UNUSED(fd);
+#elif defined(__linux__)
+  if (fdatasync(fd) == -1) {
+    return Status::IOError("Failed to sync file: ", ErrnoMessage(errno));
+  }
+#else
+  if (fsync(fd) == -1) {
+    return Status::IOError("Failed to sync file: ", ErrnoMessage(errno));
+  }
+#endif
+  return Status::OK();
+}
+
+// Positional read of an aligned range with direct I/O.  Unlike
+// FileReadAt(), this stops at the first short read, which leaves the
+// position unaligned and can only happen at the end of the file.
+Status DirectFileReadAt(int fd, uint8_t* out, int64_t position, int64_t nbytes,
+                        int64_t alignment, int64_t* bytes_read) {
+  *bytes_read = 0;
+#ifdef _WIN32
+  return Status::NotImplemented("Direct I/O is not supported on this platform");
+#else
+  while (*bytes_read < nbytes) {
+    const int64_t chunk_size = std::min<int64_t>(nbytes - *bytes_read, 1 << 30);
+    const auto ret = pread(fd, out + *bytes_read, static_cast<size_t>(chunk_size),
+                           static_cast<off_t>(position + *bytes_read));
+    if (ret == -1) {
+      return Status::IOError("Error reading bytes from file: ", ErrnoMessage(errno));
+    }
+    *bytes_read += ret;
+    if (ret == 0 || ret % alignment != 0) {
+      break;
+    }
+  }
+  return Status::OK();
+#endif
+}
+
+// Allocate a mutable buffer whose address is a multiple of `alignment`
+Status AllocateAlignedBuffer(MemoryPool* pool, int64_t size, int64_t alignment,
+                             std::shared_ptr<Buffer>* out) {
+  std::shared_ptr<ResizableBuffer> buffer;
+  RETURN_NOT_OK(AllocateResizableBuffer(pool, size + alignment, &buffer));
+  const auto address = reinterpret_cast<uintptr_t>(buffer->data());
+  const auto misalignment = static_cast<int64_t>(address % alignment);
+  const int64_t offset = misalignment == 0 ? 0 : alignment - misalignment;
+  *out = SliceMutableBuffer(buffer, offset, size);
+  return Status::OK();
+}
+
+}  // namespace
+
 class OSFile {
  public:
   OSFile() : fd_(-1), is_open_(false), size_(-1), need_seeking_(false) {}
@@ -179,6 +290,47 @@ class OSFile {
                                         length);
   }
 
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& data) {
+    RETURN_NOT_OK(CheckClosed());
+
+    std::vector<util::string_view> pieces;
+    pieces.reserve(data.size());
+    for (const auto& buffer : data) {
+      pieces.emplace_back(reinterpret_cast<const char*>(buffer->data()),
+                          static_cast<size_t>(buffer->size()));
+    }
+
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckPositioned());
+    return ::arrow::internal::FileWritev(fd_, pieces);
+  }
+
+  // Apply page cache options to the freshly opened file
+  Status ApplyOptions(const FileOptions& options) {
+    options_ = options;
+    if (options.direct_io) {
+      const int64_t alignment = options.direct_io_alignment;
+      if (alignment <= 0 || (alignment & (alignment - 1)) != 0) {
+        return Status::Invalid("Direct I/O alignment must be a power of two, got ",
+                               alignment);
+      }
+      RETURN_NOT_OK(SetDirectIO(fd_, true));
+    }
+    if (options.access_hint != FileAccessHint::NORMAL) {
+      AdviseAccess(fd_, options.access_hint);
+    }
+    return Status::OK();
+  }
+
+  bool direct_io() const { return options_.direct_io; }
+
+  // Drop a range of the file just read from the page cache, if requested
+  void DropCache(int64_t offset, int64_t nbytes) {
+    if (options_.drop_cache && nbytes > 0) {
+      AdviseDontNeed(fd_, offset, nbytes);
+    }
+  }
+
   int fd() const { return fd_; }
 
   bool is_open() const { return is_open_; }
@@ -221,6 +373,8 @@ class OSFile {
   int64_t size_;
   // Whether ReadAt made the file position non-deterministic.
   std::atomic<bool> need_seeking_;
+
+  FileOptions options_;
 };
 
 // ----------------------------------------------------------------------
@@ -233,7 +387,94 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   Status Open(const std::string& path) { return OpenReadable(path); }
   Status Open(int fd) { return OpenReadable(fd); }
 
+  Status Open(const std::string& path, const FileOptions& options) {
+    RETURN_NOT_OK(OpenReadable(path));
+    return ApplyOptions(options);
+  }
+
+  // Wait for the asynchronous reads in flight, so that their file
+  // descriptor isn't closed (and possibly reused) under them
+  Status Close() {
+    std::unique_lock<std::mutex> lock(async_mutex_);
+    async_cv_.wait(lock, [this]() { return async_reads_ == 0; });
+    return OSFile::Close();
+  }
+
+  // Body of a ReadAsync() task, which may run after the file was closed
+  Status AsyncReadBufferAt(int64_t position, int64_t nbytes,
+                           std::shared_ptr<Buffer>* out) {
+    {
+      std::lock_guard<std::mutex> lock(async_mutex_);
+      RETURN_NOT_OK(CheckClosed());
+      ++async_reads_;
+    }
+    Status st = ReadBufferAt(position, nbytes, out);
+    {
+      std::lock_guard<std::mutex> lock(async_mutex_);
+      --async_reads_;
+    }
+    async_cv_.notify_all();
+    return st;
+  }
+
+  // With direct I/O, the file position is tracked here rather than by the
+  // OS, since reads are widened to aligned ranges
+
+  Status Tell(int64_t* pos) const {
+    if (direct_io()) {
+      RETURN_NOT_OK(CheckClosed());
+      *pos = direct_pos_;
+      return Status::OK();
+    }
+    return OSFile::Tell(pos);
+  }
+
+  Status Seek(int64_t pos) {
+    if (direct_io()) {
+      RETURN_NOT_OK(CheckClosed());
+      if (pos < 0) {
+        return Status::Invalid("Invalid position");
+      }
+      direct_pos_ = pos;
+      return Status::OK();
+    }
+    return OSFile::Seek(pos);
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    if (direct_io()) {
+      RETURN_NOT_OK(ReadAt(direct_pos_, nbytes, bytes_read, out));
+      direct_pos_ += *bytes_read;
+      return Status::OK();
+    }
+    RETURN_NOT_OK(OSFile::Read(nbytes, bytes_read, out));
+    if (options_.drop_cache && *bytes_read > 0) {
+      int64_t pos;
+      RETURN_NOT_OK(OSFile::Tell(&pos));
+      DropCache(pos - *bytes_read, *bytes_read);
+    }
+    return Status::OK();
+  }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* out) {
+    if (direct_io()) {
+      std::shared_ptr<Buffer> buffer;
+      RETURN_NOT_OK(DirectReadBufferAt(position, nbytes, &buffer));
+      std::memcpy(out, buffer->data(), static_cast<size_t>(buffer->size()));
+      *bytes_read = buffer->size();
+      return Status::OK();
+    }
+    RETURN_NOT_OK(OSFile::ReadAt(position, nbytes, bytes_read, out));
+    DropCache(position, *bytes_read);
+    return Status::OK();
+  }
+
   Status ReadBuffer(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    if (direct_io()) {
+      RETURN_NOT_OK(DirectReadBufferAt(direct_pos_, nbytes, out));
+      direct_pos_ += (*out)->size();
+      return Status::OK();
+    }
     std::shared_ptr<ResizableBuffer> buffer;
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
 
@@ -248,6 +489,9 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
   Status ReadBufferAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    if (direct_io()) {
+      return DirectReadBufferAt(position, nbytes, out);
+    }
     std::shared_ptr<ResizableBuffer> buffer;
     RETURN_NOT_OK(AllocateResizableBuffer(pool_, nbytes, &buffer));
 
@@ -262,7 +506,36 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
  private:
+  // Read the aligned range covering the requested one into an aligned
+  // buffer, and return the requested slice of it
+  Status DirectReadBufferAt(int64_t position, int64_t nbytes,
+                            std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0 || nbytes < 0) {
+      return Status::Invalid("Invalid read (position = ", position,
+                             ", nbytes = ", nbytes, ")");
+    }
+    const int64_t alignment = options_.direct_io_alignment;
+    const int64_t start = position & ~(alignment - 1);
+    const int64_t end = (position + nbytes + alignment - 1) & ~(alignment - 1);
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(AllocateAlignedBuffer(pool_, end - start, alignment, &buffer));
+    int64_t bytes_read;
+    RETURN_NOT_OK(DirectFileReadAt(fd_, buffer->mutable_data(), start, end - start,
+                                   alignment, &bytes_read));
+    const int64_t offset = std::min(position - start, bytes_read);
+    *out = SliceBuffer(buffer, offset, std::min(nbytes, bytes_read - offset));
+    return Status::OK();
+  }
+
   MemoryPool* pool_;
+  // The file position with direct I/O
+  int64_t direct_pos_ = 0;
+
+  // Guards closing against the start of asynchronous reads
+  std::mutex async_mutex_;
+  std::condition_variable async_cv_;
+  int async_reads_ = 0;
 };
 
 ReadableFile::ReadableFile(MemoryPool* pool) { impl_.reset(new ReadableFileImpl(pool)); }
@@ -289,6 +562,12 @@ Status ReadableFile::Open(int fd, std::shared_ptr<ReadableFile>* file) {
   return Open(fd, default_memory_pool(), file);
 }
 
+Status ReadableFile::Open(const std::string& path, const FileOptions& options,
+                          MemoryPool* pool, std::shared_ptr<ReadableFile>* file) {
+  *file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
+  return (*file)->impl_->Open(path, options);
+}
+
 Status ReadableFile::DoClose() { return impl_->Close(); }
 
 bool ReadableFile::closed() const { return !impl_->is_open(); }
@@ -309,6 +588,24 @@ Status ReadableFile::DoReadAt(int64_t position, int64_t nbytes,
   return impl_->ReadBufferAt(position, nbytes, out);
 }
 
+std::future<Result<std::shared_ptr<Buffer>>> ReadableFile::ReadAsync(int64_t position,
+                                                                     int64_t nbytes) {
+  Status st = impl_->CheckClosed();
+  if (!st.ok()) {
+    return internal::MakeReadyFuture(Result<std::shared_ptr<Buffer>>(st));
+  }
+  // pread() is positional: the I/O thread needs no lock on the file.
+  // The task keeps the implementation alive, and checks again that the
+  // file wasn't closed in the meantime
+  std::shared_ptr<ReadableFileImpl> impl = impl_;
+  return ::arrow::internal::GetIOThreadPool()->Submit(
+      [impl, position, nbytes]() -> Result<std::shared_ptr<Buffer>> {
+        std::shared_ptr<Buffer> out;
+        RETURN_NOT_OK(impl->AsyncReadBufferAt(position, nbytes, &out));
+        return out;
+      });
+}
+
 Status ReadableFile::DoRead(int64_t nbytes, std::shared_ptr<Buffer>* out) {
   return impl_->ReadBuffer(nbytes, out);
 }
@@ -332,6 +629,118 @@ class FileOutputStream::FileOutputStreamImpl : public OSFile {
     return OpenWritable(path, truncate, append, true /* write_only */);
   }
   Status Open(int fd) { return OpenWritable(fd); }
+
+  Status Open(const std::string& path, bool append, const FileOptions& options,
+              MemoryPool* pool) {
+    RETURN_NOT_OK(Open(path, append));
+    RETURN_NOT_OK(ApplyOptions(options));
+    if (direct_io()) {
+      const int64_t alignment = options.direct_io_alignment;
+      direct_pos_ = append ? size_ : 0;
+      if (direct_pos_ % alignment != 0) {
+        return Status::Invalid("Cannot append with direct I/O to a file whose size (",
+                               direct_pos_, ") is not a multiple of ", alignment);
+      }
+      const int64_t buffer_size =
+          std::max<int64_t>(options.direct_io_buffer_size + alignment - 1, alignment) &
+          ~(alignment - 1);
+      RETURN_NOT_OK(AllocateAlignedBuffer(pool, buffer_size, alignment, &staging_));
+    }
+    return Status::OK();
+  }
+
+  Status Close() {
+    if (!is_open()) {
+      return Status::OK();
+    }
+    Status st;
+    if (direct_io()) {
+      std::lock_guard<std::mutex> guard(lock_);
+      st = WriteStaged(/*final=*/true);
+      staging_.reset();
+    }
+    if (st.ok() && options_.drop_cache) {
+      st = SyncFile(fd_);
+      AdviseDontNeed(fd_, 0, 0);
+    }
+    RETURN_NOT_OK(OSFile::Close());
+    return st;
+  }
+
+  Status Tell(int64_t* pos) const {
+    if (direct_io()) {
+      RETURN_NOT_OK(CheckClosed());
+      *pos = direct_pos_ + staged_;
+      return Status::OK();
+    }
+    return OSFile::Tell(pos);
+  }
+
+  Status Write(const void* data, int64_t length) {
+    if (!direct_io()) {
+      return OSFile::Write(data, length);
+    }
+    RETURN_NOT_OK(CheckClosed());
+    if (length < 0) {
+      return Status::IOError("Length must be non-negative");
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    return StageData(reinterpret_cast<const uint8_t*>(data), length);
+  }
+
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& data) {
+    if (!direct_io()) {
+      return OSFile::Writev(data);
+    }
+    RETURN_NOT_OK(CheckClosed());
+    std::lock_guard<std::mutex> guard(lock_);
+    for (const auto& buffer : data) {
+      RETURN_NOT_OK(StageData(buffer->data(), buffer->size()));
+    }
+    return Status::OK();
+  }
+
+ private:
+  // Copy data to the aligned staging buffer, writing it out whenever full
+  Status StageData(const uint8_t* data, int64_t length) {
+    while (length > 0) {
+      const int64_t chunk_size = std::min(length, staging_->size() - staged_);
+      std::memcpy(staging_->mutable_data() + staged_, data, chunk_size);
+      staged_ += chunk_size;
+      data += chunk_size;
+      length -= chunk_size;
+      if (staged_ == staging_->size()) {
+        RETURN_NOT_OK(WriteStaged(/*final=*/false));
+      }
+    }
+    return Status::OK();
+  }
+
+  // Write out the staged data.  Direct I/O can only write whole aligned
+  // blocks, so a final partial block is written through the page cache.
+  Status WriteStaged(bool final) {
+    if (staged_ == 0) {
+      return Status::OK();
+    }
+    const int64_t aligned_size = staged_ & ~(options_.direct_io_alignment - 1);
+    DCHECK(final || aligned_size == staged_);
+    RETURN_NOT_OK(
+        ::arrow::internal::FileWrite(fd_, staging_->data(), aligned_size));
+    if (aligned_size < staged_) {
+      RETURN_NOT_OK(SetDirectIO(fd_, false));
+      RETURN_NOT_OK(::arrow::internal::FileWrite(
+          fd_, staging_->data() + aligned_size, staged_ - aligned_size));
+    }
+    direct_pos_ += staged_;
+    staged_ = 0;
+    return Status::OK();
+  }
+
+  // With direct I/O: the aligned staging buffer, the number of bytes staged
+  // in it and the file position where they will be written
+  std::shared_ptr<Buffer> staging_;
+  int64_t staged_ = 0;
+  int64_t direct_pos_ = 0;
 };
 
 FileOutputStream::FileOutputStream() { impl_.reset(new FileOutputStreamImpl()); }
@@ -371,6 +780,19 @@ Status FileOutputStream::Open(int fd, std::shared_ptr<FileOutputStream>* file) {
   return (*file)->impl_->Open(fd);
 }
 
+Status FileOutputStream::Open(const std::string& path, bool append,
+                              const FileOptions& options,
+                              std::shared_ptr<FileOutputStream>* file) {
+  return Open(path, append, options, default_memory_pool(), file);
+}
+
+Status FileOutputStream::Open(const std::string& path, bool append,
+                              const FileOptions& options, MemoryPool* pool,
+                              std::shared_ptr<FileOutputStream>* file) {
+  *file = std::shared_ptr<FileOutputStream>(new FileOutputStream());
+  return (*file)->impl_->Open(path, append, options, pool);
+}
+
 Status FileOutputStream::Close() { return impl_->Close(); }
 
 bool FileOutputStream::closed() const { return !impl_->is_open(); }
@@ -381,6 +803,10 @@ Status FileOutputStream::Write(const void* data, int64_t length) {
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::Writev(const std::vector<std::shared_ptr<Buffer>>& data) {
+  return impl_->Writev(data);
+}
+
 int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
@@ -680,6 +1106,17 @@ Status MemoryMappedFile::ReadAt(int64_t position, int64_t nbytes,
   return memory_map_->Slice(position, nbytes, out);
 }
 
+std::future<Result<std::shared_ptr<Buffer>>> MemoryMappedFile::ReadAsync(
+    int64_t position, int64_t nbytes) {
+  // Slicing the mapping never blocks
+  std::shared_ptr<Buffer> out;
+  Status st = ReadAt(position, nbytes, &out);
+  if (!st.ok()) {
+    return internal::MakeReadyFuture(Result<std::shared_ptr<Buffer>>(st));
+  }
+  return internal::MakeReadyFuture(Result<std::shared_ptr<Buffer>>(std::move(out)));
+}
+
 Status MemoryMappedFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
                                 void* out) {
   RETURN_NOT_OK(memory_map_->CheckClosed());
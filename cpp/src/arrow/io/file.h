@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
@@ -36,6 +37,44 @@ class Status;
 
 namespace io {
 
+/// \brief Hint about how a local file will be accessed
+struct FileAccessHint {
+  enum type {
+    /// No particular access pattern
+    NORMAL,
+    /// Sequential access: the kernel reads ahead more aggressively
+    SEQUENTIAL,
+    /// Random access: the kernel disables read-ahead
+    RANDOM
+  };
+};
+
+/// \brief Options controlling how local files interact with the OS page cache
+///
+/// These are mostly useful for large scans that would otherwise evict the
+/// working set of other processes from the page cache.
+struct ARROW_EXPORT FileOptions {
+  /// \brief The expected access pattern, given to the kernel with
+  /// posix_fadvise() where available
+  FileAccessHint::type access_hint = FileAccessHint::NORMAL;
+  /// \brief Drop data from the page cache once read (POSIX_FADV_DONTNEED).
+  /// Output streams sync the file to disk and drop it on Close().
+  bool drop_cache = false;
+  /// \brief Bypass the page cache with direct I/O (O_DIRECT on Linux,
+  /// F_NOCACHE on macOS)
+  ///
+  /// Reads are widened to aligned ranges read into aligned buffers from the
+  /// MemoryPool.  Output streams stage writes in an aligned buffer of
+  /// direct_io_buffer_size bytes, written when full and on Close().
+  bool direct_io = false;
+  /// \brief The alignment of file offsets, sizes and memory addresses
+  /// required by direct I/O.  Must be a power of two.
+  int64_t direct_io_alignment = 4096;
+  /// \brief The size of the aligned buffer output streams write from with
+  /// direct I/O
+  int64_t direct_io_buffer_size = 1 << 20;
+};
+
 /// \brief An operating system file open in write-only mode.
 class ARROW_EXPORT FileOutputStream : public OutputStream {
  public:
@@ -89,6 +128,23 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   /// on Close() or destruction.
   static Status Open(int fd, std::shared_ptr<FileOutputStream>* out);
 
+  /// \brief Open a local file for writing with the given page cache options
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] append append to existing file, otherwise truncate to 0 bytes
+  /// \param[in] options page cache and direct I/O options
+  /// \param[out] file a FileOutputStream instance
+  static Status Open(const std::string& path, bool append, const FileOptions& options,
+                     std::shared_ptr<FileOutputStream>* file);
+
+  /// \brief Open a local file for writing with the given page cache options
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] append append to existing file, otherwise truncate to 0 bytes
+  /// \param[in] options page cache and direct I/O options
+  /// \param[in] pool a MemoryPool for the direct I/O staging buffer
+  /// \param[out] file a FileOutputStream instance
+  static Status Open(const std::string& path, bool append, const FileOptions& options,
+                     MemoryPool* pool, std::shared_ptr<FileOutputStream>* file);
+
   // OutputStream interface
   Status Close() override;
   bool closed() const override;
@@ -100,6 +156,9 @@ class ARROW_EXPORT FileOutputStream : public OutputStream {
   using Writable::Write;
   /// \endcond
 
+  // Write several buffers with as few writev() calls as possible. Thread-safe
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& data) override;
+
   int file_descriptor() const;
 
  private:
@@ -152,10 +211,26 @@ class ARROW_EXPORT ReadableFile
   /// on Close() or destruction.
   static Status Open(int fd, MemoryPool* pool, std::shared_ptr<ReadableFile>* file);
 
+  /// \brief Open a local file for reading with the given page cache options
+  /// \param[in] path with UTF8 encoding
+  /// \param[in] options page cache and direct I/O options
+  /// \param[in] pool a MemoryPool for memory allocations
+  /// \param[out] file ReadableFile instance
+  ///
+  /// With direct I/O, reads returning a Buffer are zero-copy slices of an
+  /// aligned buffer covering the requested range.
+  static Status Open(const std::string& path, const FileOptions& options,
+                     MemoryPool* pool, std::shared_ptr<ReadableFile>* file);
+
   bool closed() const override;
 
   int file_descriptor() const;
 
+  /// \brief Read with pread() on the I/O thread pool, bypassing the stream
+  /// position and its lock
+  std::future<Result<std::shared_ptr<Buffer>>> ReadAsync(int64_t position,
+                                                         int64_t nbytes) override;
+
  private:
   friend RandomAccessFileConcurrencyWrapper<ReadableFile>;
 
@@ -176,7 +251,8 @@ class ARROW_EXPORT ReadableFile
   Status DoSeek(int64_t position);
 
   class ARROW_NO_EXPORT ReadableFileImpl;
-  std::unique_ptr<ReadableFileImpl> impl_;
+  // Shared with pending ReadAsync() tasks
+  std::shared_ptr<ReadableFileImpl> impl_;
 };
 
 /// \brief A file interface that uses memory-mapped files for memory interactions
@@ -228,6 +304,10 @@ class ARROW_EXPORT MemoryMappedFile : public ReadWriteFileInterface {
 
   bool supports_zero_copy() const override;
 
+  /// Zero-copy read returning a ready future
+  std::future<Result<std::shared_ptr<Buffer>>> ReadAsync(int64_t position,
+                                                         int64_t nbytes) override;
+
   /// Write data at the current position in the file. Thread-safe
   Status Write(const void* data, int64_t nbytes) override;
   /// \cond FALSE
@@ -18,6 +18,7 @@
 #include "arrow/api.h"
 #include "arrow/io/buffered.h"
 #include "arrow/io/file.h"
+#include "arrow/io/uring.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
@@ -28,9 +29,14 @@
 #include <algorithm>
 #include <atomic>
 #include <cstdlib>
+#include <deque>
+#include <future>
 #include <iostream>
+#include <random>
+#include <string>
 #include <thread>
 #include <valarray>
+#include <vector>
 
 #ifdef _WIN32
 
@@ -296,6 +302,156 @@ static void BufferedOutputStreamLargeWritesToPipe(
   BenchmarkStreamingWrites(state, large_sizes, buffered_stream.get(), reader.get());
 }
 
+// Benchmark random reads of a local file
+//
+// Compares one positional read at a time (pread) with reads queued to an
+// io_uring, the kernel working on up to state.range(0) of them at once.
+
+constexpr int64_t kRandomReadFileSize = 64 << 20;
+constexpr int64_t kRandomReadSize = 64 << 10;
+
+class RandomReadFile {
+ public:
+  RandomReadFile() {
+    ABORT_NOT_OK(internal::TemporaryDir::Make("file-benchmark-", &temp_dir_));
+    path_ = temp_dir_->path().ToString() + "data";
+    std::shared_ptr<io::FileOutputStream> stream;
+    ABORT_NOT_OK(io::FileOutputStream::Open(path_, &stream));
+    const std::string chunk(1 << 20, 'x');
+    for (int64_t i = 0; i < kRandomReadFileSize; i += chunk.size()) {
+      ABORT_NOT_OK(stream->Write(chunk));
+    }
+    ABORT_NOT_OK(stream->Close());
+
+    std::default_random_engine engine(42);
+    std::uniform_int_distribution<int64_t> dist(
+        0, kRandomReadFileSize / kRandomReadSize - 1);
+    for (int i = 0; i < 1024; ++i) {
+      positions_.push_back(dist(engine) * kRandomReadSize);
+    }
+  }
+
+  const std::string& path() const { return path_; }
+  const std::vector<int64_t>& positions() const { return positions_; }
+
+ private:
+  std::unique_ptr<internal::TemporaryDir> temp_dir_;
+  std::string path_;
+  std::vector<int64_t> positions_;
+};
+
+static void ReadableFileRandomReads(
+    benchmark::State& state) {  // NOLINT non-const reference
+  RandomReadFile data;
+  std::shared_ptr<io::ReadableFile> file;
+  ABORT_NOT_OK(io::ReadableFile::Open(data.path(), &file));
+
+  for (auto _ : state) {
+    for (int64_t position : data.positions()) {
+      std::shared_ptr<Buffer> buffer;
+      ABORT_NOT_OK(file->ReadAt(position, kRandomReadSize, &buffer));
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * data.positions().size() *
+                          kRandomReadSize);
+}
+
+static void UringReadableFileRandomReads(
+    benchmark::State& state) {  // NOLINT non-const reference
+  RandomReadFile data;
+  io::UringOptions options;
+  options.queue_depth = static_cast<int>(state.range(0));
+  std::shared_ptr<io::RandomAccessFile> file;
+  ABORT_NOT_OK(io::UringReadableFile::Open(data.path(), options, &file));
+  if (!io::UringReadableFile::IsAvailable()) {
+    state.SkipWithError("io_uring is not available");
+    return;
+  }
+
+  for (auto _ : state) {
+    // Keep up to queue_depth reads in flight
+    std::deque<std::future<Result<std::shared_ptr<Buffer>>>> in_flight;
+    for (int64_t position : data.positions()) {
+      if (static_cast<int64_t>(in_flight.size()) == state.range(0)) {
+        ABORT_NOT_OK(in_flight.front().get().status());
+        in_flight.pop_front();
+      }
+      in_flight.push_back(file->ReadAsync(position, kRandomReadSize));
+    }
+    for (auto& fut : in_flight) {
+      ABORT_NOT_OK(fut.get().status());
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * data.positions().size() *
+                          kRandomReadSize);
+}
+
+// Benchmark sequential scans of a local file with the page cache options
+//
+// state.range(0) selects the options: 0 = defaults, 1 = sequential access
+// hint, 2 = sequential access hint and dropping read data from the page
+// cache, 3 = direct I/O.
+
+constexpr int64_t kScanChunkSize = 1 << 20;
+
+static io::FileOptions ScanFileOptions(int64_t mode) {
+  io::FileOptions options;
+  if (mode >= 1 && mode <= 2) {
+    options.access_hint = io::FileAccessHint::SEQUENTIAL;
+  }
+  options.drop_cache = mode == 2;
+  options.direct_io = mode == 3;
+  return options;
+}
+
+static void ReadableFileSequentialScan(
+    benchmark::State& state) {  // NOLINT non-const reference
+  RandomReadFile data;
+  const auto options = ScanFileOptions(state.range(0));
+
+  for (auto _ : state) {
+    std::shared_ptr<io::ReadableFile> file;
+    auto st = io::ReadableFile::Open(data.path(), options, default_memory_pool(), &file);
+    if (!st.ok()) {
+      state.SkipWithError(st.ToString().c_str());
+      return;
+    }
+    std::shared_ptr<Buffer> buffer;
+    do {
+      ABORT_NOT_OK(file->Read(kScanChunkSize, &buffer));
+    } while (buffer->size() > 0);
+    ABORT_NOT_OK(file->Close());
+  }
+  state.SetBytesProcessed(state.iterations() * kRandomReadFileSize);
+}
+
+// state.range(0) selects the options: 0 = defaults, 1 = direct I/O,
+// 2 = dropping written data from the page cache
+static void FileOutputStreamSequentialWrites(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::unique_ptr<internal::TemporaryDir> temp_dir;
+  ABORT_NOT_OK(internal::TemporaryDir::Make("file-benchmark-", &temp_dir));
+  const std::string path = temp_dir->path().ToString() + "data";
+  io::FileOptions options;
+  options.direct_io = state.range(0) == 1;
+  options.drop_cache = state.range(0) == 2;
+  const std::string chunk(kScanChunkSize, 'x');
+
+  for (auto _ : state) {
+    std::shared_ptr<io::FileOutputStream> stream;
+    auto st = io::FileOutputStream::Open(path, false, options, &stream);
+    if (!st.ok()) {
+      state.SkipWithError(st.ToString().c_str());
+      return;
+    }
+    for (int64_t i = 0; i < kRandomReadFileSize; i += kScanChunkSize) {
+      ABORT_NOT_OK(stream->Write(chunk.data(), kScanChunkSize));
+    }
+    ABORT_NOT_OK(stream->Close());
+  }
+  state.SetBytesProcessed(state.iterations() * kRandomReadFileSize);
+}
+
 // We use real time as we don't want to count CPU time spent in the
 // BackgroundReader thread
 
@@ -307,4 +463,10 @@ BENCHMARK(BufferedOutputStreamSmallWritesToNull)->UseRealTime();
 BENCHMARK(BufferedOutputStreamSmallWritesToPipe)->UseRealTime();
 BENCHMARK(BufferedOutputStreamLargeWritesToPipe)->UseRealTime();
 
+BENCHMARK(ReadableFileRandomReads)->UseRealTime();
+BENCHMARK(UringReadableFileRandomReads)->Arg(1)->Arg(8)->Arg(32)->UseRealTime();
+
+BENCHMARK(ReadableFileSequentialScan)->DenseRange(0, 3)->UseRealTime();
+BENCHMARK(FileOutputStreamSequentialWrites)->DenseRange(0, 2)->UseRealTime();
+
 }  // namespace arrow
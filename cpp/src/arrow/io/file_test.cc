@@ -21,11 +21,13 @@
 #endif
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <future>
 #include <memory>
 #include <string>
 #include <thread>
@@ -42,6 +44,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -232,6 +235,26 @@ TEST_F(TestFileOutputStream, Tell) {
   ASSERT_EQ(8, position);
 }
 
+TEST_F(TestFileOutputStream, Writev) {
+  OpenFile();
+
+  std::vector<std::shared_ptr<Buffer>> pieces = {
+      Buffer::FromString("test"), std::make_shared<Buffer>(""),
+      Buffer::FromString("data"), Buffer::FromString(std::string(100, 'x'))};
+  ASSERT_OK(stream_->Writev(pieces));
+  ASSERT_OK(stream_->Writev({}));
+
+  int64_t position;
+  ASSERT_OK(stream_->Tell(&position));
+  ASSERT_EQ(108, position);
+
+  ASSERT_OK(stream_->Write("!", 1));
+  ASSERT_OK(stream_->Close());
+  ASSERT_RAISES(Invalid, stream_->Writev(pieces));
+
+  AssertFileContents(path_, "testdata" + std::string(100, 'x') + "!");
+}
+
 TEST_F(TestFileOutputStream, TruncatesNewFile) {
   ASSERT_OK(FileOutputStream::Open(path_, &file_));
 
@@ -455,6 +478,53 @@ TEST_F(TestReadableFile, ReadAt) {
   ASSERT_RAISES(Invalid, file_->ReadAt(0, 1, &buffer2));
 }
 
+TEST_F(TestReadableFile, ReadAsync) {
+  MakeTestFile();
+  OpenFile();
+
+  std::vector<std::future<Result<std::shared_ptr<Buffer>>>> futures;
+  for (int i = 0; i < 8; ++i) {
+    futures.push_back(file_->ReadAsync(i, 4));
+  }
+  const std::string test_data = "testdata";
+  for (int i = 0; i < 8; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buffer, futures[i].get());
+    AssertBufferEqual(*buffer, test_data.substr(i, 4));
+  }
+  // ReadAsync doesn't move the stream position
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(0, position);
+
+  ASSERT_OK(file_->Close());
+  ASSERT_RAISES(Invalid, file_->ReadAsync(0, 1).get().status());
+}
+
+TEST_F(TestReadableFile, ReadAsyncAfterClose) {
+  MakeTestFile();
+  OpenFile();
+
+  // Keep all I/O threads busy so that the read only runs after the file
+  // is destroyed
+  auto pool = ::arrow::internal::GetIOThreadPool();
+  std::atomic<bool> release(false);
+  std::vector<std::future<void>> blockers;
+  for (int i = 0; i < GetIOThreadPoolCapacity(); ++i) {
+    blockers.push_back(pool->Submit([&release]() {
+      while (!release) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }));
+  }
+  auto future = file_->ReadAsync(0, 4);
+  file_.reset();
+  release = true;
+  ASSERT_RAISES(Invalid, future.get().status());
+  for (auto& blocker : blockers) {
+    blocker.get();
+  }
+}
+
 TEST_F(TestReadableFile, SeekingRequired) {
   std::shared_ptr<Buffer> buffer;
 
@@ -559,6 +629,133 @@ TEST_F(TestReadableFile, ThreadSafety) {
   ASSERT_EQ(niter * 2, correct_count);
 }
 
+TEST_F(TestReadableFile, AccessHints) {
+  MakeTestFile();
+
+  for (auto hint :
+       {FileAccessHint::NORMAL, FileAccessHint::SEQUENTIAL, FileAccessHint::RANDOM}) {
+    FileOptions options;
+    options.access_hint = hint;
+    options.drop_cache = true;
+    ASSERT_OK(ReadableFile::Open(path_, options, default_memory_pool(), &file_));
+
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(file_->Read(4, &buffer));
+    AssertBufferEqual(*buffer, "test");
+    ASSERT_OK(file_->ReadAt(2, 100, &buffer));
+    AssertBufferEqual(*buffer, "stdata");
+    ASSERT_OK(file_->Seek(4));
+    ASSERT_OK(file_->Read(100, &buffer));
+    AssertBufferEqual(*buffer, "data");
+    ASSERT_OK(file_->Close());
+  }
+}
+
+// Direct I/O isn't supported by all platforms and filesystems (e.g. tmpfs)
+#define SKIP_IF_NO_DIRECT_IO(status)                 \
+  do {                                               \
+    auto _st = (status);                             \
+    if (_st.IsIOError() || _st.IsNotImplemented()) { \
+      return;                                        \
+    }                                                \
+    ASSERT_OK(_st);                                  \
+  } while (false)
+
+TEST_F(TestReadableFile, DirectIO) {
+  std::string data(10000, '\0');
+  random_bytes(10000, 42, reinterpret_cast<uint8_t*>(&data[0]));
+  {
+    std::ofstream stream(path_.c_str(), std::ios::binary);
+    stream << data;
+  }
+
+  FileOptions options;
+  options.direct_io = true;
+  options.direct_io_alignment = 4096;
+  SKIP_IF_NO_DIRECT_IO(ReadableFile::Open(path_, options, default_memory_pool(), &file_));
+
+  int64_t size, position;
+  ASSERT_OK(file_->GetSize(&size));
+  ASSERT_EQ(10000, size);
+
+  // Sequential reads, not aligned
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->Read(3000, &buffer));
+  AssertBufferEqual(*buffer, Buffer(data.substr(0, 3000)));
+  ASSERT_OK(file_->Read(3000, &buffer));
+  AssertBufferEqual(*buffer, Buffer(data.substr(3000, 3000)));
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(6000, position);
+  ASSERT_OK(file_->Read(5000, &buffer));
+  AssertBufferEqual(*buffer, Buffer(data.substr(6000)));
+  ASSERT_OK(file_->Read(10, &buffer));
+  ASSERT_EQ(0, buffer->size());
+
+  // Random reads, including past the end of the file
+  ASSERT_OK(file_->ReadAt(4095, 2, &buffer));
+  AssertBufferEqual(*buffer, Buffer(data.substr(4095, 2)));
+  ASSERT_OK(file_->ReadAt(9000, 2000, &buffer));
+  AssertBufferEqual(*buffer, Buffer(data.substr(9000)));
+  ASSERT_OK(file_->ReadAt(12000, 10, &buffer));
+  ASSERT_EQ(0, buffer->size());
+  std::vector<char> out(100);
+  int64_t bytes_read;
+  ASSERT_OK(file_->ReadAt(123, 100, &bytes_read, out.data()));
+  ASSERT_EQ(100, bytes_read);
+  ASSERT_EQ(data.substr(123, 100), std::string(out.data(), 100));
+
+  ASSERT_OK(file_->Seek(9990));
+  ASSERT_OK(file_->Read(100, &bytes_read, out.data()));
+  ASSERT_EQ(10, bytes_read);
+  ASSERT_EQ(data.substr(9990), std::string(out.data(), 10));
+  ASSERT_OK(file_->Close());
+
+  options.direct_io_alignment = 1000;
+  ASSERT_RAISES(Invalid,
+                ReadableFile::Open(path_, options, default_memory_pool(), &file_));
+}
+
+TEST_F(TestFileOutputStream, DirectIO) {
+  std::string data(20000, '\0');
+  random_bytes(20000, 42, reinterpret_cast<uint8_t*>(&data[0]));
+
+  FileOptions options;
+  options.direct_io = true;
+  options.direct_io_alignment = 4096;
+  options.direct_io_buffer_size = 8192;
+  options.drop_cache = true;
+  ProxyMemoryPool pool(default_memory_pool());
+  SKIP_IF_NO_DIRECT_IO(FileOutputStream::Open(path_, false, options, &pool, &file_));
+  // The staging buffer comes from the given pool
+  ASSERT_GE(pool.bytes_allocated(), 8192);
+
+  // Writes of all sizes go through the aligned staging buffer
+  ASSERT_OK(file_->Write(data.data(), 10));
+  ASSERT_OK(file_->Write(data.data() + 10, 9000));
+  ASSERT_OK(file_->Writev({SliceBuffer(std::make_shared<Buffer>(data), 9010, 5),
+                           SliceBuffer(std::make_shared<Buffer>(data), 9015, 985)}));
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(10000, position);
+  ASSERT_OK(file_->Write(data.data() + 10000, 10000));
+  ASSERT_OK(file_->Close());
+  ASSERT_EQ(0, pool.bytes_allocated());
+  AssertFileContents(path_, data);
+
+  // Appending requires an aligned file size
+  ASSERT_RAISES(Invalid, FileOutputStream::Open(path_, true, options, &file_));
+
+  ASSERT_OK(FileOutputStream::Open(path_, false, options, &file_));
+  ASSERT_OK(file_->Write(data.data(), 8192));
+  ASSERT_OK(file_->Close());
+  ASSERT_OK(FileOutputStream::Open(path_, true, options, &file_));
+  ASSERT_OK(file_->Write(data.data() + 8192, 100));
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(8292, position);
+  ASSERT_OK(file_->Close());
+  AssertFileContents(path_, data.substr(0, 8292));
+}
+
 // ----------------------------------------------------------------------
 // Pipe I/O tests using FileOutputStream
 // (cannot test using ReadableFile as it currently requires seeking)
@@ -724,6 +921,23 @@ TEST_F(TestMemoryMappedFile, WriteRead) {
   }
 }
 
+TEST_F(TestMemoryMappedFile, ReadAsync) {
+  const int64_t buffer_size = 1024;
+  std::vector<uint8_t> buffer(buffer_size);
+  random_bytes(1024, 0, buffer.data());
+
+  std::string path = "io-memory-map-read-async-test";
+  std::shared_ptr<MemoryMappedFile> result;
+  ASSERT_OK(InitMemoryMap(buffer_size, path, &result));
+  ASSERT_OK(result->Write(buffer.data(), buffer_size));
+
+  auto fut = result->ReadAsync(100, 200);
+  ASSERT_EQ(std::future_status::ready, fut.wait_for(std::chrono::seconds(0)));
+  ASSERT_OK_AND_ASSIGN(auto out_buffer, fut.get());
+  ASSERT_EQ(200, out_buffer->size());
+  ASSERT_EQ(0, memcmp(out_buffer->data(), buffer.data() + 100, 200));
+}
+
 TEST_F(TestMemoryMappedFile, WriteResizeRead) {
   const int64_t buffer_size = 1024;
   const int reps = 5;
@@ -0,0 +1,417 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/instrumented.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+
+const char* IOOperationName(IOOperation op) {
+  switch (op) {
+    case IOOperation::GetTargetStats:
+      return "GetTargetStats";
+    case IOOperation::ListDir:
+      return "ListDir";
+    case IOOperation::CreateDir:
+      return "CreateDir";
+    case IOOperation::DeleteDir:
+      return "DeleteDir";
+    case IOOperation::DeleteFile:
+      return "DeleteFile";
+    case IOOperation::Move:
+      return "Move";
+    case IOOperation::CopyFile:
+      return "CopyFile";
+    case IOOperation::OpenInputStream:
+      return "OpenInputStream";
+    case IOOperation::OpenInputFile:
+      return "OpenInputFile";
+    case IOOperation::OpenOutputStream:
+      return "OpenOutputStream";
+    case IOOperation::Read:
+      return "Read";
+    case IOOperation::Write:
+      return "Write";
+    case IOOperation::Flush:
+      return "Flush";
+    case IOOperation::Close:
+      return "Close";
+  }
+  return "<unknown>";
+}
+
+//////////////////////////////////////////////////////////////////////////
+// IOHistogram implementation
+
+constexpr int IOHistogram::kNumBuckets;
+
+int IOHistogram::BucketIndex(int64_t value) {
+  if (value <= 1) {
+    return 0;
+  }
+  return std::min(BitUtil::Log2(static_cast<uint64_t>(value)), kNumBuckets - 1);
+}
+
+int64_t IOHistogram::BucketUpperBound(int bucket) {
+  DCHECK_LT(bucket, kNumBuckets);
+  if (bucket == kNumBuckets - 1) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  return int64_t(1) << bucket;
+}
+
+double IOHistogram::mean() const {
+  return count == 0 ? 0.0 : static_cast<double>(sum) / static_cast<double>(count);
+}
+
+int64_t IOHistogram::Quantile(double q) const {
+  if (count == 0) {
+    return 0;
+  }
+  // The rank of the quantile, in [1, count]
+  const auto rank = std::max<int64_t>(
+      1, static_cast<int64_t>(std::ceil(q * static_cast<double>(count))));
+  int64_t seen = 0;
+  for (int i = 0; i < kNumBuckets; ++i) {
+    seen += buckets[i];
+    if (seen >= rank) {
+      return BucketUpperBound(i);
+    }
+  }
+  return BucketUpperBound(kNumBuckets - 1);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// IOMetricsSnapshot implementation
+
+double IOMetricsSnapshot::total_time() const {
+  int64_t total_us = 0;
+  for (const auto& op : operations) {
+    total_us += op.latency_us.sum;
+  }
+  return static_cast<double>(total_us) * 1e-6;
+}
+
+std::string IOMetricsSnapshot::ToString() const {
+  std::stringstream ss;
+  for (int i = 0; i < kNumIOOperations; ++i) {
+    const auto& op = operations[i];
+    if (op.count == 0) {
+      continue;
+    }
+    ss << IOOperationName(static_cast<IOOperation>(i)) << ": count=" << op.count
+       << " errors=" << op.errors << " total_us=" << op.latency_us.sum
+       << " mean_us=" << op.latency_us.mean()
+       << " p50_us<=" << op.latency_us.Quantile(0.5)
+       << " p99_us<=" << op.latency_us.Quantile(0.99) << "\n";
+  }
+  if (read_sizes.count > 0) {
+    ss << "bytes_read=" << bytes_read << " mean_read_size=" << read_sizes.mean()
+       << " p50_read_size<=" << read_sizes.Quantile(0.5) << "\n";
+  }
+  if (bytes_written > 0) {
+    ss << "bytes_written=" << bytes_written << "\n";
+  }
+  return ss.str();
+}
+
+//////////////////////////////////////////////////////////////////////////
+// IOMetrics implementation
+
+namespace {
+
+struct AtomicHistogram {
+  std::atomic<int64_t> buckets[IOHistogram::kNumBuckets];
+  std::atomic<int64_t> count;
+  std::atomic<int64_t> sum;
+
+  AtomicHistogram() { Reset(); }
+
+  void Add(int64_t value) {
+    buckets[IOHistogram::BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  void Reset() {
+    for (auto& bucket : buckets) {
+      bucket.store(0);
+    }
+    count.store(0);
+    sum.store(0);
+  }
+
+  IOHistogram Snapshot() const {
+    IOHistogram out;
+    for (int i = 0; i < IOHistogram::kNumBuckets; ++i) {
+      out.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+    }
+    out.count = count.load(std::memory_order_relaxed);
+    out.sum = sum.load(std::memory_order_relaxed);
+    return out;
+  }
+};
+
+struct AtomicOperationMetrics {
+  std::atomic<int64_t> errors{0};
+  AtomicHistogram latency_us;
+};
+
+}  // namespace
+
+class IOMetrics::Impl {
+ public:
+  Impl() : bytes_read_(0), bytes_written_(0) {}
+
+  void Record(IOOperation op, int64_t nanos, const Status& st) {
+    auto& metrics = operations_[static_cast<int>(op)];
+    metrics.latency_us.Add(nanos / 1000);
+    if (!st.ok()) {
+      metrics.errors.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  void RecordRead(int64_t nbytes, int64_t bytes_read) {
+    read_sizes_.Add(nbytes);
+    bytes_read_.fetch_add(bytes_read, std::memory_order_relaxed);
+  }
+
+  void RecordWrite(int64_t nbytes) {
+    bytes_written_.fetch_add(nbytes, std::memory_order_relaxed);
+  }
+
+  IOMetricsSnapshot Snapshot() const {
+    IOMetricsSnapshot out;
+    for (int i = 0; i < kNumIOOperations; ++i) {
+      auto& op = out.operations[i];
+      op.latency_us = operations_[i].latency_us.Snapshot();
+      op.count = op.latency_us.count;
+      op.errors = operations_[i].errors.load(std::memory_order_relaxed);
+    }
+    out.bytes_read = bytes_read_.load(std::memory_order_relaxed);
+    out.bytes_written = bytes_written_.load(std::memory_order_relaxed);
+    out.read_sizes = read_sizes_.Snapshot();
+    return out;
+  }
+
+  void Reset() {
+    for (auto& op : operations_) {
+      op.errors.store(0);
+      op.latency_us.Reset();
+    }
+    bytes_read_.store(0);
+    bytes_written_.store(0);
+    read_sizes_.Reset();
+  }
+
+ protected:
+  AtomicOperationMetrics operations_[kNumIOOperations];
+  std::atomic<int64_t> bytes_read_;
+  std::atomic<int64_t> bytes_written_;
+  AtomicHistogram read_sizes_;
+};
+
+IOMetrics::IOMetrics() : impl_(new Impl()) {}
+
+IOMetrics::~IOMetrics() {}
+
+void IOMetrics::Record(IOOperation op, int64_t nanos, const Status& st) {
+  impl_->Record(op, nanos, st);
+}
+
+void IOMetrics::RecordRead(int64_t nbytes, int64_t bytes_read) {
+  impl_->RecordRead(nbytes, bytes_read);
+}
+
+void IOMetrics::RecordWrite(int64_t nbytes) { impl_->RecordWrite(nbytes); }
+
+IOMetricsSnapshot IOMetrics::Snapshot() const { return impl_->Snapshot(); }
+
+void IOMetrics::Reset() { impl_->Reset(); }
+
+//////////////////////////////////////////////////////////////////////////
+// Instrumented stream implementations
+
+namespace {
+
+template <typename ReadFunc>
+Status TimedRead(IOMetrics* metrics, int64_t nbytes, std::shared_ptr<Buffer>* out,
+                 ReadFunc&& read) {
+  RETURN_NOT_OK(metrics->Time(IOOperation::Read, [&]() { return read(); }));
+  metrics->RecordRead(nbytes, (*out)->size());
+  return Status::OK();
+}
+
+template <typename ReadFunc>
+Status TimedRead(IOMetrics* metrics, int64_t nbytes, int64_t* bytes_read,
+                 ReadFunc&& read) {
+  RETURN_NOT_OK(metrics->Time(IOOperation::Read, [&]() { return read(); }));
+  metrics->RecordRead(nbytes, *bytes_read);
+  return Status::OK();
+}
+
+}  // namespace
+
+InstrumentedInputStream::~InstrumentedInputStream() {
+  internal::CloseFromDestructor(this);
+}
+
+Status InstrumentedInputStream::Close() {
+  return metrics_->Time(IOOperation::Close, [&]() { return stream_->Close(); });
+}
+
+Status InstrumentedInputStream::Abort() { return stream_->Abort(); }
+
+bool InstrumentedInputStream::closed() const { return stream_->closed(); }
+
+Status InstrumentedInputStream::Tell(int64_t* position) const {
+  return stream_->Tell(position);
+}
+
+Status InstrumentedInputStream::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  return TimedRead(metrics_.get(), nbytes, bytes_read,
+                   [&]() { return stream_->Read(nbytes, bytes_read, out); });
+}
+
+Status InstrumentedInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return TimedRead(metrics_.get(), nbytes, out,
+                   [&]() { return stream_->Read(nbytes, out); });
+}
+
+Status InstrumentedInputStream::Peek(int64_t nbytes, util::string_view* out) {
+  return stream_->Peek(nbytes, out);
+}
+
+bool InstrumentedInputStream::supports_zero_copy() const {
+  return stream_->supports_zero_copy();
+}
+
+InstrumentedRandomAccessFile::~InstrumentedRandomAccessFile() {
+  internal::CloseFromDestructor(this);
+}
+
+Status InstrumentedRandomAccessFile::Close() {
+  return metrics_->Time(IOOperation::Close, [&]() { return stream_->Close(); });
+}
+
+Status InstrumentedRandomAccessFile::Abort() { return stream_->Abort(); }
+
+bool InstrumentedRandomAccessFile::closed() const { return stream_->closed(); }
+
+Status InstrumentedRandomAccessFile::GetSize(int64_t* size) {
+  return stream_->GetSize(size);
+}
+
+Status InstrumentedRandomAccessFile::Seek(int64_t position) {
+  return stream_->Seek(position);
+}
+
+Status InstrumentedRandomAccessFile::Tell(int64_t* position) const {
+  return stream_->Tell(position);
+}
+
+Status InstrumentedRandomAccessFile::Read(int64_t nbytes, int64_t* bytes_read,
+                                          void* out) {
+  return TimedRead(metrics_.get(), nbytes, bytes_read,
+                   [&]() { return stream_->Read(nbytes, bytes_read, out); });
+}
+
+Status InstrumentedRandomAccessFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return TimedRead(metrics_.get(), nbytes, out,
+                   [&]() { return stream_->Read(nbytes, out); });
+}
+
+Status InstrumentedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                            int64_t* bytes_read, void* out) {
+  return TimedRead(metrics_.get(), nbytes, bytes_read, [&]() {
+    return stream_->ReadAt(position, nbytes, bytes_read, out);
+  });
+}
+
+Status InstrumentedRandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
+                                            std::shared_ptr<Buffer>* out) {
+  return TimedRead(metrics_.get(), nbytes, out,
+                   [&]() { return stream_->ReadAt(position, nbytes, out); });
+}
+
+Status InstrumentedRandomAccessFile::Peek(int64_t nbytes, util::string_view* out) {
+  return stream_->Peek(nbytes, out);
+}
+
+bool InstrumentedRandomAccessFile::supports_zero_copy() const {
+  return stream_->supports_zero_copy();
+}
+
+InstrumentedOutputStream::~InstrumentedOutputStream() {
+  internal::CloseFromDestructor(this);
+}
+
+Status InstrumentedOutputStream::Close() {
+  return metrics_->Time(IOOperation::Close, [&]() { return stream_->Close(); });
+}
+
+Status InstrumentedOutputStream::Abort() { return stream_->Abort(); }
+
+bool InstrumentedOutputStream::closed() const { return stream_->closed(); }
+
+Status InstrumentedOutputStream::Tell(int64_t* position) const {
+  return stream_->Tell(position);
+}
+
+Status InstrumentedOutputStream::Write(const void* data, int64_t nbytes) {
+  RETURN_NOT_OK(metrics_->Time(IOOperation::Write,
+                               [&]() { return stream_->Write(data, nbytes); }));
+  metrics_->RecordWrite(nbytes);
+  return Status::OK();
+}
+
+Status InstrumentedOutputStream::Write(const std::shared_ptr<Buffer>& data) {
+  RETURN_NOT_OK(
+      metrics_->Time(IOOperation::Write, [&]() { return stream_->Write(data); }));
+  metrics_->RecordWrite(data->size());
+  return Status::OK();
+}
+
+Status InstrumentedOutputStream::Writev(
+    const std::vector<std::shared_ptr<Buffer>>& data) {
+  RETURN_NOT_OK(
+      metrics_->Time(IOOperation::Write, [&]() { return stream_->Writev(data); }));
+  for (const auto& buffer : data) {
+    metrics_->RecordWrite(buffer->size());
+  }
+  return Status::OK();
+}
+
+Status InstrumentedOutputStream::Flush() {
+  return metrics_->Time(IOOperation::Flush, [&]() { return stream_->Flush(); });
+}
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,247 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Stream wrappers recording I/O metrics, for diagnostics and benchmarking
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+
+namespace io {
+
+/// \brief The operations recorded by IOMetrics
+///
+/// DeleteDir also covers DeleteDirContents, OpenOutputStream also covers
+/// OpenAppendStream.  ListDir is GetTargetStats() with a Selector, including
+/// GetTargetStatsBatches() and each batch it yields.
+enum class IOOperation : int8_t {
+  // Filesystem operations
+  GetTargetStats,
+  ListDir,
+  CreateDir,
+  DeleteDir,
+  DeleteFile,
+  Move,
+  CopyFile,
+  OpenInputStream,
+  OpenInputFile,
+  OpenOutputStream,
+  // Stream operations
+  Read,
+  Write,
+  Flush,
+  Close,
+};
+
+constexpr int kNumIOOperations = static_cast<int>(IOOperation::Close) + 1;
+
+ARROW_EXPORT
+const char* IOOperationName(IOOperation op);
+
+/// \brief A snapshot of a histogram with power-of-two buckets
+struct ARROW_EXPORT IOHistogram {
+  /// The number of buckets.  Bucket 0 counts values <= 1, bucket i counts
+  /// values in (2^(i-1), 2^i], the last bucket counts all larger values.
+  static constexpr int kNumBuckets = 40;
+
+  std::vector<int64_t> buckets = std::vector<int64_t>(kNumBuckets, 0);
+  /// The number of recorded values
+  int64_t count = 0;
+  /// The sum of recorded values
+  int64_t sum = 0;
+
+  /// The index of the bucket a value is counted in
+  static int BucketIndex(int64_t value);
+  /// The largest value counted in the given bucket
+  static int64_t BucketUpperBound(int bucket);
+
+  double mean() const;
+  /// \brief An upper bound of the given quantile, in [0, 1]
+  ///
+  /// The result is the upper bound of the bucket the quantile falls into,
+  /// so it overestimates the actual value by less than a factor of two.
+  int64_t Quantile(double q) const;
+};
+
+/// \brief A snapshot of the metrics of one IOOperation
+struct ARROW_EXPORT IOOperationMetrics {
+  /// The number of calls, including failed ones
+  int64_t count = 0;
+  /// The number of calls that returned an error
+  int64_t errors = 0;
+  /// Call latencies, in microseconds
+  IOHistogram latency_us;
+};
+
+/// \brief A snapshot of IOMetrics
+struct ARROW_EXPORT IOMetricsSnapshot {
+  std::vector<IOOperationMetrics> operations =
+      std::vector<IOOperationMetrics>(kNumIOOperations);
+  /// The number of bytes returned by Read() and ReadAt() calls
+  int64_t bytes_read = 0;
+  /// The number of bytes given to Write() calls
+  int64_t bytes_written = 0;
+  /// The sizes requested by Read() and ReadAt() calls, in bytes
+  IOHistogram read_sizes;
+
+  const IOOperationMetrics& operation(IOOperation op) const {
+    return operations[static_cast<int>(op)];
+  }
+
+  /// The total time spent in recorded calls, in seconds
+  double total_time() const;
+
+  /// A human-readable multi-line summary of the non-zero metrics
+  std::string ToString() const;
+};
+
+/// \brief EXPERIMENTAL: thread-safe I/O counters and histograms
+///
+/// Recording is lock-free.  An instance may be shared between several
+/// wrapped streams and filesystems to aggregate their metrics.
+class ARROW_EXPORT IOMetrics {
+ public:
+  IOMetrics();
+  ~IOMetrics();
+
+  /// Record a call to the given operation, taking `nanos` nanoseconds
+  void Record(IOOperation op, int64_t nanos, const Status& st);
+  /// Call `func`, returning a Status, and record it as a call to `op`
+  template <typename Func>
+  Status Time(IOOperation op, Func&& func) {
+    const auto start = std::chrono::steady_clock::now();
+    Status st = func();
+    const auto duration = std::chrono::steady_clock::now() - start;
+    Record(op, std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count(),
+           st);
+    return st;
+  }
+  /// Record a read request of `nbytes`, returning `bytes_read`
+  void RecordRead(int64_t nbytes, int64_t bytes_read);
+  /// Record a write of `nbytes`
+  void RecordWrite(int64_t nbytes);
+
+  IOMetricsSnapshot Snapshot() const;
+  void Reset();
+
+ protected:
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+template <class StreamType>
+class ARROW_EXPORT InstrumentedStreamBase : public StreamType {
+ public:
+  InstrumentedStreamBase(std::shared_ptr<StreamType> stream,
+                         std::shared_ptr<IOMetrics> metrics)
+      : stream_(std::move(stream)), metrics_(std::move(metrics)) {}
+
+  const std::shared_ptr<IOMetrics>& metrics() const { return metrics_; }
+
+ protected:
+  std::shared_ptr<StreamType> stream_;
+  std::shared_ptr<IOMetrics> metrics_;
+};
+
+/// \brief An InputStream wrapper that records I/O metrics.
+///
+/// Read() and Close() calls are timed and counted, along with the bytes read.
+/// Other calls are forwarded directly.
+class ARROW_EXPORT InstrumentedInputStream : public InstrumentedStreamBase<InputStream> {
+ public:
+  ~InstrumentedInputStream() override;
+
+  using InstrumentedStreamBase<InputStream>::InstrumentedStreamBase;
+
+  Status Close() override;
+  Status Abort() override;
+  bool closed() const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+  Status Peek(int64_t nbytes, util::string_view* out) override;
+  bool supports_zero_copy() const override;
+
+  Status Tell(int64_t* position) const override;
+};
+
+/// \brief A RandomAccessFile wrapper that records I/O metrics.
+///
+/// Similar to InstrumentedInputStream, ReadAt() calls are recorded as reads.
+class ARROW_EXPORT InstrumentedRandomAccessFile
+    : public InstrumentedStreamBase<RandomAccessFile> {
+ public:
+  ~InstrumentedRandomAccessFile() override;
+
+  using InstrumentedStreamBase<RandomAccessFile>::InstrumentedStreamBase;
+
+  Status Close() override;
+  Status Abort() override;
+  bool closed() const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+  Status Peek(int64_t nbytes, util::string_view* out) override;
+  bool supports_zero_copy() const override;
+
+  Status GetSize(int64_t* size) override;
+  Status Seek(int64_t position) override;
+  Status Tell(int64_t* position) const override;
+};
+
+/// \brief An OutputStream wrapper that records I/O metrics.
+///
+/// Write(), Flush() and Close() calls are timed and counted, along with the
+/// bytes written.
+class ARROW_EXPORT InstrumentedOutputStream
+    : public InstrumentedStreamBase<OutputStream> {
+ public:
+  ~InstrumentedOutputStream() override;
+
+  using InstrumentedStreamBase<OutputStream>::InstrumentedStreamBase;
+
+  Status Close() override;
+  Status Abort() override;
+  bool closed() const override;
+
+  using OutputStream::Write;
+  Status Write(const void* data, int64_t nbytes) override;
+  Status Write(const std::shared_ptr<Buffer>& data) override;
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& data) override;
+  Status Flush() override;
+
+  Status Tell(int64_t* position) const override;
+};
+
+}  // namespace io
+}  // namespace arrow
@@ -32,6 +32,7 @@
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -110,6 +111,16 @@ Status RandomAccessFile::ReadAt(int64_t position, int64_t nbytes,
   return Read(nbytes, out);
 }
 
+std::future<Result<std::shared_ptr<Buffer>>> RandomAccessFile::ReadAsync(
+    int64_t position, int64_t nbytes) {
+  return ::arrow::internal::GetIOThreadPool()->Submit(
+      [this, position, nbytes]() -> Result<std::shared_ptr<Buffer>> {
+        std::shared_ptr<Buffer> out;
+        RETURN_NOT_OK(ReadAt(position, nbytes, &out));
+        return out;
+      });
+}
+
 Status Writable::Write(const std::string& data) {
   return Write(data.c_str(), static_cast<int64_t>(data.size()));
 }
@@ -118,6 +129,13 @@ Status Writable::Write(const std::shared_ptr<Buffer>& data) {
   return Write(data->data(), data->size());
 }
 
+Status Writable::Writev(const std::vector<std::shared_ptr<Buffer>>& data) {
+  for (const auto& buffer : data) {
+    RETURN_NOT_OK(Write(buffer));
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 class FileSegmentReader
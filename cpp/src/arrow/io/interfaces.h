@@ -19,10 +19,12 @@
 #define ARROW_IO_INTERFACES_H
 
 #include <cstdint>
+#include <future>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "arrow/result.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/string_view.h"
@@ -126,6 +128,13 @@ class ARROW_EXPORT Writable {
   /// buffering is required.  See Write(const void*, int64_t) for details.
   virtual Status Write(const std::shared_ptr<Buffer>& data);
 
+  /// \brief Write several buffers to the stream, in order
+  ///
+  /// Equivalent to calling Write(const std::shared_ptr<Buffer>&) on each of
+  /// them, which is what the default implementation does.  Streams backed by
+  /// a file descriptor override it to issue a single vectored (writev) call.
+  virtual Status Writev(const std::vector<std::shared_ptr<Buffer>>& data);
+
   /// \brief Flush buffered bytes, if any
   virtual Status Flush();
 
@@ -214,6 +223,19 @@ class ARROW_EXPORT RandomAccessFile : public InputStream, public Seekable {
   /// retrieved by calling Buffer::size().
   virtual Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out);
 
+  /// \brief Read nbytes at position without blocking the caller
+  ///
+  /// The default implementation runs ReadAt() on the global I/O thread pool,
+  /// separate from the CPU thread pool. Implementations backed by memory
+  /// return a ready future. The file must be kept alive until the returned
+  /// future is ready.
+  ///
+  /// \param[in] position Where to read bytes from
+  /// \param[in] nbytes The number of bytes to read
+  /// \return a future of the buffer read, as with ReadAt()
+  virtual std::future<Result<std::shared_ptr<Buffer>>> ReadAsync(int64_t position,
+                                                                 int64_t nbytes);
+
  protected:
   RandomAccessFile();
 
@@ -111,6 +111,27 @@ Status BufferOutputStream::Write(const void* data, int64_t nbytes) {
   return Status::OK();
 }
 
+Status BufferOutputStream::Writev(const std::vector<std::shared_ptr<Buffer>>& data) {
+  if (ARROW_PREDICT_FALSE(!is_open_)) {
+    return Status::IOError("OutputStream is closed");
+  }
+  DCHECK(buffer_);
+  int64_t nbytes = 0;
+  for (const auto& buffer : data) {
+    nbytes += buffer->size();
+  }
+  if (ARROW_PREDICT_FALSE(position_ + nbytes >= capacity_)) {
+    RETURN_NOT_OK(Reserve(nbytes));
+  }
+  for (const auto& buffer : data) {
+    if (buffer->size() > 0) {
+      memcpy(mutable_data_ + position_, buffer->data(), buffer->size());
+      position_ += buffer->size();
+    }
+  }
+  return Status::OK();
+}
+
 Status BufferOutputStream::Reserve(int64_t nbytes) {
   // Always overallocate by doubling.  It seems that it is a better growth
   // strategy, at least for memory_benchmark.cc.
@@ -333,6 +354,16 @@ Status BufferReader::DoReadAt(int64_t position, int64_t nbytes, int64_t* bytes_r
   return Status::OK();
 }
 
+std::future<Result<std::shared_ptr<Buffer>>> BufferReader::ReadAsync(int64_t position,
+                                                                     int64_t nbytes) {
+  std::shared_ptr<Buffer> out;
+  Status st = ReadAt(position, nbytes, &out);
+  if (!st.ok()) {
+    return internal::MakeReadyFuture(Result<std::shared_ptr<Buffer>>(st));
+  }
+  return internal::MakeReadyFuture(Result<std::shared_ptr<Buffer>>(std::move(out)));
+}
+
 Status BufferReader::DoReadAt(int64_t position, int64_t nbytes,
                               std::shared_ptr<Buffer>* out) {
   RETURN_NOT_OK(CheckClosed());
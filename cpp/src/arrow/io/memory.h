@@ -21,6 +21,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/io/concurrency.h"
 #include "arrow/io/interfaces.h"
@@ -62,6 +63,9 @@ class ARROW_EXPORT BufferOutputStream : public OutputStream {
   using OutputStream::Write;
   /// \endcond
 
+  /// Copy several buffers into the stream, growing it at most once
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& data) override;
+
   /// Close the stream and return the buffer
   Status Finish(std::shared_ptr<Buffer>* result);
 
@@ -156,6 +160,11 @@ class ARROW_EXPORT BufferReader
 
   bool supports_zero_copy() const override;
 
+  /// \brief Read synchronously and return a ready future, since reading from
+  /// memory never blocks
+  std::future<Result<std::shared_ptr<Buffer>>> ReadAsync(int64_t position,
+                                                         int64_t nbytes) override;
+
   std::shared_ptr<Buffer> buffer() const { return buffer_; }
 
  protected:
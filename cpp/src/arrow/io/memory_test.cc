@@ -19,8 +19,10 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#include <future>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -88,6 +90,22 @@ TEST_F(TestBufferOutputStream, WriteAfterFinish) {
   ASSERT_RAISES(IOError, stream_->Write(data));
 }
 
+TEST_F(TestBufferOutputStream, Writev) {
+  std::string data = "data123456";
+
+  const int K = 100;
+  std::vector<std::shared_ptr<Buffer>> pieces;
+  for (int i = 0; i < K; ++i) {
+    pieces.push_back(std::make_shared<Buffer>(data));
+  }
+  ASSERT_OK(stream_->Writev(pieces));
+  ASSERT_OK(stream_->Write(data));
+
+  ASSERT_OK(stream_->Close());
+  ASSERT_EQ(static_cast<int64_t>((K + 1) * data.size()), buffer_->size());
+  ASSERT_EQ(0, std::memcmp(buffer_->data() + K * data.size(), data.data(), data.size()));
+}
+
 TEST_F(TestBufferOutputStream, Reset) {
   std::string data = "data123456";
 
@@ -200,6 +218,24 @@ TEST(TestBufferReader, Peek) {
   ASSERT_EQ(data, view.to_string());
 }
 
+TEST(TestBufferReader, ReadAsync) {
+  auto buffer = std::make_shared<Buffer>("data123456");
+  BufferReader reader(buffer);
+
+  auto fut1 = reader.ReadAsync(2, 3);
+  auto fut2 = reader.ReadAsync(8, 10);
+  // Memory reads complete immediately, without copying
+  ASSERT_EQ(std::future_status::ready, fut1.wait_for(std::chrono::seconds(0)));
+  ASSERT_OK_AND_ASSIGN(auto buf1, fut1.get());
+  ASSERT_OK_AND_ASSIGN(auto buf2, fut2.get());
+  AssertBufferEqual(*buf1, "ta1");
+  AssertBufferEqual(*buf2, "56");
+  ASSERT_EQ(buffer->data() + 2, buf1->data());
+
+  ASSERT_OK(reader.Close());
+  ASSERT_RAISES(Invalid, reader.ReadAsync(0, 1).get().status());
+}
+
 TEST(TestBufferReader, RetainParentReference) {
   // ARROW-387
   std::string data = "data123456";
@@ -350,6 +386,22 @@ TEST(TestSlowInputStream, Basics) { TestSlowInputStream<SlowInputStream>(); }
 
 TEST(TestSlowRandomAccessFile, Basics) { TestSlowInputStream<SlowRandomAccessFile>(); }
 
+TEST(TestSlowRandomAccessFile, ReadAsync) {
+  // The default implementation runs ReadAt() on the I/O thread pool
+  auto stream = std::make_shared<BufferReader>(util::string_view("abcdefghijkl"));
+  auto slow = std::make_shared<SlowRandomAccessFile>(stream, 0.01);
+
+  std::vector<std::future<Result<std::shared_ptr<Buffer>>>> futures;
+  for (int i = 0; i < 12; ++i) {
+    futures.push_back(slow->ReadAsync(i, 2));
+  }
+  const std::string data = "abcdefghijkl";
+  for (int i = 0; i < 12; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto buf, futures[i].get());
+    AssertBufferEqual(*buf, data.substr(i, 2));
+  }
+}
+
 TEST(TestInputStreamIterator, Basics) {
   auto reader = std::make_shared<BufferReader>(Buffer::FromString("data123456"));
   Iterator<std::shared_ptr<Buffer>> it;
@@ -0,0 +1,608 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/windows_compatibility.h"  // IWYU pragma: keep
+
+// sys/mman.h not present in Visual Studio or Cygwin
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include "arrow/io/mman.h"
+#undef Realloc
+#undef Free
+#else
+#include <sys/mman.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <utility>
+
+#include "arrow/buffer.h"
+#include "arrow/io/shared_memory.h"
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+
+using internal::FileClose;
+using internal::FileExists;
+using internal::FileGetSize;
+using internal::FileNameFromString;
+using internal::FileOpenWritable;
+using internal::FileTruncate;
+using internal::PlatformFilename;
+
+namespace {
+
+constexpr uint64_t kRingMagic = 0x474e495257525241ULL;  // "ARRWRING"
+
+// Records are 8-byte aligned and start with their int64 length. This length
+// tells the consumer to skip to the start of the ring
+constexpr int64_t kWrapMarker = -1;
+constexpr int64_t kRecordHeaderSize = sizeof(int64_t);
+
+// Shared state at the start of the mapping. The producer and the consumer
+// each advance their own position, on separate cache lines.
+struct RingHeader {
+  uint64_t magic;
+  int64_t capacity;
+  alignas(64) std::atomic<int64_t> write_position;
+  std::atomic<int32_t> writer_closed;
+  alignas(64) std::atomic<int64_t> read_position;
+  std::atomic<int32_t> reader_closed;
+};
+
+constexpr int64_t kHeaderSize = 256;
+static_assert(sizeof(RingHeader) <= kHeaderSize, "ring header too large");
+
+// Wait for a condition updated by another process: spin briefly, then back
+// off with growing sleeps
+template <typename Predicate>
+void WaitUntil(Predicate&& ready) {
+  int attempt = 0;
+  while (!ready()) {
+    if (attempt < 64) {
+      std::this_thread::yield();
+    } else {
+      const int shift = std::min(attempt - 64, 10);
+      std::this_thread::sleep_for(std::chrono::microseconds(1 << shift));
+    }
+    ++attempt;
+  }
+}
+
+// The whole mapping, unmapped once the ring and every buffer exported from
+// it are gone
+class Region : public MutableBuffer {
+ public:
+  Region(uint8_t* data, int64_t size) : MutableBuffer(data, size) {}
+
+  ~Region() override {
+    int result = munmap(mutable_data(), static_cast<size_t>(size_));
+    ARROW_CHECK_EQ(result, 0) << "munmap failed";
+  }
+};
+
+}  // namespace
+
+class SharedRingBuffer::Impl {
+ public:
+  explicit Impl(std::shared_ptr<Region> region) : region_(std::move(region)) {
+    header_ = reinterpret_cast<RingHeader*>(region_->mutable_data());
+    data_ = region_->mutable_data() + kHeaderSize;
+  }
+
+  static Status Map(const std::string& path, bool create, int64_t size,
+                    std::shared_ptr<Impl>* out) {
+    PlatformFilename file_name;
+    RETURN_NOT_OK(FileNameFromString(path, &file_name));
+    if (!create) {
+      bool exists;
+      RETURN_NOT_OK(FileExists(file_name, &exists));
+      if (!exists) {
+        return Status::IOError("Shared ring buffer file not found: ", path);
+      }
+    }
+    int fd;
+    RETURN_NOT_OK(FileOpenWritable(file_name, /*write_only=*/false,
+                                   /*truncate=*/create, /*append=*/false, &fd));
+    Status st;
+    if (create) {
+      st = FileTruncate(fd, size);
+    } else {
+      st = FileGetSize(fd, &size);
+      if (st.ok() && size <= kHeaderSize) {
+        st = Status::Invalid("File is too small for a shared ring buffer: ", path);
+      }
+    }
+    void* result = MAP_FAILED;
+    if (st.ok()) {
+      result = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE,
+                    MAP_SHARED, fd, 0);
+      if (result == MAP_FAILED) {
+        st = Status::IOError("Memory mapping file failed: ", std::strerror(errno));
+      }
+    }
+    // The mapping outlives the file descriptor
+    st &= FileClose(fd);
+    if (!st.ok()) {
+      if (result != MAP_FAILED) {
+        munmap(result, static_cast<size_t>(size));
+      }
+      return st;
+    }
+    auto region = std::make_shared<Region>(static_cast<uint8_t*>(result), size);
+    out->reset(new Impl(std::move(region)));
+    return Status::OK();
+  }
+
+  void Initialize(int64_t capacity) {
+    header_ = new (region_->mutable_data()) RingHeader();
+    header_->magic = kRingMagic;
+    header_->capacity = capacity;
+    header_->write_position.store(0);
+    header_->writer_closed.store(0);
+    header_->read_position.store(0);
+    header_->reader_closed.store(0);
+  }
+
+  Status Validate() const {
+    if (header_->magic != kRingMagic) {
+      return Status::IOError("Not a shared ring buffer");
+    }
+    if (header_->capacity <= 0 || header_->capacity + kHeaderSize > region_->size() ||
+        header_->capacity % kRecordHeaderSize != 0) {
+      return Status::IOError("Invalid shared ring buffer capacity: ", header_->capacity);
+    }
+    return Status::OK();
+  }
+
+  int64_t capacity() const { return header_->capacity; }
+  RingHeader* header() const { return header_; }
+  uint8_t* data() const { return data_; }
+  const std::shared_ptr<Region>& region() const { return region_; }
+
+ private:
+  std::shared_ptr<Region> region_;
+  RingHeader* header_;
+  uint8_t* data_;
+};
+
+SharedRingBuffer::SharedRingBuffer() {}
+
+SharedRingBuffer::~SharedRingBuffer() {}
+
+Status SharedRingBuffer::Create(const std::string& path, int64_t capacity,
+                                std::shared_ptr<SharedRingBuffer>* out) {
+  if (capacity <= kRecordHeaderSize) {
+    return Status::Invalid("Shared ring buffer capacity is too small: ", capacity);
+  }
+  capacity = BitUtil::RoundUpToMultipleOf64(capacity);
+  std::shared_ptr<Impl> impl;
+  RETURN_NOT_OK(Impl::Map(path, /*create=*/true, kHeaderSize + capacity, &impl));
+  impl->Initialize(capacity);
+  out->reset(new SharedRingBuffer());
+  (*out)->impl_ = std::move(impl);
+  return Status::OK();
+}
+
+Status SharedRingBuffer::Open(const std::string& path,
+                              std::shared_ptr<SharedRingBuffer>* out) {
+  std::shared_ptr<Impl> impl;
+  RETURN_NOT_OK(Impl::Map(path, /*create=*/false, 0, &impl));
+  RETURN_NOT_OK(impl->Validate());
+  out->reset(new SharedRingBuffer());
+  (*out)->impl_ = std::move(impl);
+  return Status::OK();
+}
+
+int64_t SharedRingBuffer::capacity() const { return impl_->capacity(); }
+
+// ----------------------------------------------------------------------
+// SharedRingBufferOutputStream implementation
+
+class SharedRingBufferOutputStream::Impl {
+ public:
+  explicit Impl(std::shared_ptr<SharedRingBuffer::Impl> ring)
+      : ring_(std::move(ring)),
+        header_(ring_->header()),
+        write_position_(header_->write_position.load()) {}
+
+  ~Impl() { ARROW_CHECK_OK(Close()); }
+
+  Status Close() {
+    if (!closed_) {
+      closed_ = true;
+      header_->writer_closed.store(1, std::memory_order_release);
+    }
+    return Status::OK();
+  }
+
+  bool closed() const { return closed_; }
+
+  int64_t position() const { return bytes_written_; }
+
+  Status WriteRecord(const std::vector<util::string_view>& pieces) {
+    if (closed_) {
+      return Status::IOError("Operation on closed stream");
+    }
+    int64_t nbytes = 0;
+    for (const auto& piece : pieces) {
+      nbytes += static_cast<int64_t>(piece.size());
+    }
+    if (nbytes == 0) {
+      return Status::OK();
+    }
+
+    const int64_t capacity = ring_->capacity();
+    const int64_t record_size =
+        kRecordHeaderSize + BitUtil::RoundUpToMultipleOf8(nbytes);
+    if (record_size > capacity) {
+      return Status::Invalid("Write of ", nbytes,
+                             " bytes does not fit in a shared ring buffer of capacity ",
+                             capacity);
+    }
+
+    // A record never wraps around: skip the tail of the ring if needed.
+    // The skipped tail is published on its own, so that the consumer can
+    // release it before the record needs the space at the start of the ring.
+    int64_t offset = write_position_ % capacity;
+    const int64_t tail = capacity - offset;
+    if (record_size > tail) {
+      RETURN_NOT_OK(WaitForSpace(tail));
+      std::memcpy(ring_->data() + offset, &kWrapMarker, sizeof(int64_t));
+      write_position_ += tail;
+      header_->write_position.store(write_position_, std::memory_order_release);
+      offset = 0;
+    }
+    RETURN_NOT_OK(WaitForSpace(record_size));
+
+    uint8_t* out = ring_->data() + offset + kRecordHeaderSize;
+    for (const auto& piece : pieces) {
+      if (piece.size() > 0) {
+        std::memcpy(out, piece.data(), piece.size());
+        out += piece.size();
+      }
+    }
+    std::memcpy(ring_->data() + offset, &nbytes, sizeof(int64_t));
+    write_position_ += record_size;
+    bytes_written_ += nbytes;
+    // Publish the record to the consumer
+    header_->write_position.store(write_position_, std::memory_order_release);
+    return Status::OK();
+  }
+
+ private:
+  Status WaitForSpace(int64_t needed) {
+    const int64_t capacity = ring_->capacity();
+    bool reader_closed = false;
+    WaitUntil([&]() {
+      if (header_->reader_closed.load(std::memory_order_acquire)) {
+        reader_closed = true;
+        return true;
+      }
+      const int64_t read_position =
+          header_->read_position.load(std::memory_order_acquire);
+      return capacity - (write_position_ - read_position) >= needed;
+    });
+    if (reader_closed) {
+      return Status::IOError("Shared ring buffer consumer is closed");
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<SharedRingBuffer::Impl> ring_;
+  RingHeader* header_;
+  int64_t write_position_;
+  int64_t bytes_written_ = 0;
+  bool closed_ = false;
+};
+
+SharedRingBufferOutputStream::SharedRingBufferOutputStream(
+    std::shared_ptr<SharedRingBuffer> ring)
+    : impl_(new Impl(ring->impl_)) {}
+
+SharedRingBufferOutputStream::~SharedRingBufferOutputStream() {}
+
+Status SharedRingBufferOutputStream::Close() { return impl_->Close(); }
+
+bool SharedRingBufferOutputStream::closed() const { return impl_->closed(); }
+
+Status SharedRingBufferOutputStream::Tell(int64_t* position) const {
+  *position = impl_->position();
+  return Status::OK();
+}
+
+Status SharedRingBufferOutputStream::Write(const void* data, int64_t nbytes) {
+  if (nbytes < 0) {
+    return Status::Invalid("Negative write size: ", nbytes);
+  }
+  return impl_->WriteRecord(
+      {util::string_view(reinterpret_cast<const char*>(data),
+                         static_cast<size_t>(nbytes))});
+}
+
+Status SharedRingBufferOutputStream::Writev(
+    const std::vector<std::shared_ptr<Buffer>>& data) {
+  std::vector<util::string_view> pieces;
+  pieces.reserve(data.size());
+  for (const auto& buffer : data) {
+    pieces.emplace_back(reinterpret_cast<const char*>(buffer->data()),
+                        static_cast<size_t>(buffer->size()));
+  }
+  return impl_->WriteRecord(pieces);
+}
+
+// ----------------------------------------------------------------------
+// SharedRingBufferInputStream implementation
+
+namespace {
+
+// Returns ring space to the producer in order, as records are released
+class ReleaseTracker {
+ public:
+  explicit ReleaseTracker(std::shared_ptr<SharedRingBuffer::Impl> ring)
+      : ring_(std::move(ring)), header_(ring_->header()) {}
+
+  // Register a record (or skipped tail) ending at the given ring position
+  void Add(int64_t end, bool released) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    pending_.push_back({end, released});
+    Advance();
+  }
+
+  void Release(int64_t end) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& entry : pending_) {
+      if (entry.first == end) {
+        entry.second = true;
+        break;
+      }
+    }
+    Advance();
+  }
+
+ private:
+  void Advance() {
+    int64_t position = -1;
+    while (!pending_.empty() && pending_.front().second) {
+      position = pending_.front().first;
+      pending_.pop_front();
+    }
+    if (position >= 0) {
+      header_->read_position.store(position, std::memory_order_release);
+    }
+  }
+
+  // Keeps the mapping alive as long as records are outstanding
+  std::shared_ptr<SharedRingBuffer::Impl> ring_;
+  RingHeader* header_;
+  std::mutex mutex_;
+  std::deque<std::pair<int64_t, bool>> pending_;
+};
+
+// A record of the ring, handing its space back when destroyed. Slices of it
+// keep it alive
+class RecordBuffer : public Buffer {
+ public:
+  RecordBuffer(const std::shared_ptr<SharedRingBuffer::Impl>& ring,
+               std::shared_ptr<ReleaseTracker> tracker, const uint8_t* data,
+               int64_t size, int64_t end)
+      : Buffer(data, size), tracker_(std::move(tracker)), end_(end) {
+    parent_ = ring->region();
+  }
+
+  ~RecordBuffer() override { tracker_->Release(end_); }
+
+ private:
+  std::shared_ptr<ReleaseTracker> tracker_;
+  int64_t end_;
+};
+
+}  // namespace
+
+class SharedRingBufferInputStream::Impl {
+ public:
+  explicit Impl(std::shared_ptr<SharedRingBuffer::Impl> ring)
+      : ring_(std::move(ring)),
+        header_(ring_->header()),
+        tracker_(std::make_shared<ReleaseTracker>(ring_)),
+        read_position_(header_->read_position.load()) {}
+
+  ~Impl() { ARROW_CHECK_OK(Close()); }
+
+  Status Close() {
+    if (!closed_) {
+      closed_ = true;
+      current_.reset();
+      header_->reader_closed.store(1, std::memory_order_release);
+    }
+    return Status::OK();
+  }
+
+  bool closed() const { return closed_; }
+
+  int64_t position() const { return bytes_read_; }
+
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(CheckReadable(nbytes));
+    if (nbytes == 0) {
+      *out = std::make_shared<Buffer>(nullptr, 0);
+      return Status::OK();
+    }
+    RETURN_NOT_OK(EnsureRecord());
+    if (current_ != nullptr && current_->size() - current_offset_ >= nbytes) {
+      // Zero-copy slice of the shared mapping
+      *out = SliceBuffer(current_, current_offset_, nbytes);
+      Consume(nbytes);
+      return Status::OK();
+    }
+
+    // The read spans several records (or reaches the end of the stream)
+    std::shared_ptr<ResizableBuffer> buffer;
+    RETURN_NOT_OK(AllocateResizableBuffer(nbytes, &buffer));
+    int64_t bytes_read = 0;
+    RETURN_NOT_OK(CopyOut(nbytes, &bytes_read, buffer->mutable_data()));
+    if (bytes_read < nbytes) {
+      RETURN_NOT_OK(buffer->Resize(bytes_read));
+    }
+    *out = std::move(buffer);
+    return Status::OK();
+  }
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+    RETURN_NOT_OK(CheckReadable(nbytes));
+    return CopyOut(nbytes, bytes_read, static_cast<uint8_t*>(out));
+  }
+
+ private:
+  Status CheckReadable(int64_t nbytes) const {
+    if (closed_) {
+      return Status::IOError("Operation on closed stream");
+    }
+    if (nbytes < 0) {
+      return Status::Invalid("Negative read size: ", nbytes);
+    }
+    return Status::OK();
+  }
+
+  Status CopyOut(int64_t nbytes, int64_t* bytes_read, uint8_t* out) {
+    *bytes_read = 0;
+    while (*bytes_read < nbytes) {
+      RETURN_NOT_OK(EnsureRecord());
+      if (current_ == nullptr) {
+        break;
+      }
+      const int64_t chunk =
+          std::min(nbytes - *bytes_read, current_->size() - current_offset_);
+      std::memcpy(out + *bytes_read, current_->data() + current_offset_, chunk);
+      *bytes_read += chunk;
+      Consume(chunk);
+    }
+    return Status::OK();
+  }
+
+  void Consume(int64_t nbytes) {
+    current_offset_ += nbytes;
+    bytes_read_ += nbytes;
+    if (current_offset_ == current_->size()) {
+      // Buffers sliced from the record now decide when it is released
+      current_.reset();
+    }
+  }
+
+  // Make sure current_ holds unread data, unless the producer is done
+  Status EnsureRecord() {
+    if (current_ != nullptr) {
+      return Status::OK();
+    }
+    const int64_t capacity = ring_->capacity();
+    while (true) {
+      bool end_of_stream = false;
+      WaitUntil([&]() {
+        if (header_->write_position.load(std::memory_order_acquire) > read_position_) {
+          return true;
+        }
+        if (header_->writer_closed.load(std::memory_order_acquire)) {
+          // Records published before closing are visible by now
+          end_of_stream =
+              header_->write_position.load(std::memory_order_acquire) <= read_position_;
+          return true;
+        }
+        return false;
+      });
+      if (end_of_stream) {
+        return Status::OK();
+      }
+
+      const int64_t offset = read_position_ % capacity;
+      int64_t length;
+      std::memcpy(&length, ring_->data() + offset, sizeof(int64_t));
+      if (length == kWrapMarker) {
+        read_position_ += capacity - offset;
+        tracker_->Add(read_position_, /*released=*/true);
+        continue;
+      }
+      const int64_t record_size =
+          kRecordHeaderSize + BitUtil::RoundUpToMultipleOf8(length);
+      if (length <= 0 || record_size > capacity - offset) {
+        return Status::IOError("Corrupt record in shared ring buffer");
+      }
+      read_position_ += record_size;
+      tracker_->Add(read_position_, /*released=*/false);
+      current_ = std::make_shared<RecordBuffer>(
+          ring_, tracker_, ring_->data() + offset + kRecordHeaderSize, length,
+          read_position_);
+      current_offset_ = 0;
+      return Status::OK();
+    }
+  }
+
+  std::shared_ptr<SharedRingBuffer::Impl> ring_;
+  RingHeader* header_;
+  std::shared_ptr<ReleaseTracker> tracker_;
+
+  // Ring position of the next record to read
+  int64_t read_position_;
+  std::shared_ptr<Buffer> current_;
+  int64_t current_offset_ = 0;
+
+  int64_t bytes_read_ = 0;
+  bool closed_ = false;
+};
+
+SharedRingBufferInputStream::SharedRingBufferInputStream(
+    std::shared_ptr<SharedRingBuffer> ring)
+    : impl_(new Impl(ring->impl_)) {}
+
+SharedRingBufferInputStream::~SharedRingBufferInputStream() {}
+
+Status SharedRingBufferInputStream::Close() { return impl_->Close(); }
+
+bool SharedRingBufferInputStream::closed() const { return impl_->closed(); }
+
+Status SharedRingBufferInputStream::Tell(int64_t* position) const {
+  *position = impl_->position();
+  return Status::OK();
+}
+
+Status SharedRingBufferInputStream::Read(int64_t nbytes, int64_t* bytes_read,
+                                         void* out) {
+  return impl_->Read(nbytes, bytes_read, out);
+}
+
+Status SharedRingBufferInputStream::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  return impl_->Read(nbytes, out);
+}
+
+bool SharedRingBufferInputStream::supports_zero_copy() const { return true; }
+
+}  // namespace io
+}  // namespace arrow
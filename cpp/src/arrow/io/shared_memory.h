@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Streams exchanging data between processes through a ring buffer in a
+// shared memory mapping
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+namespace io {
+
+/// \brief A single-producer, single-consumer ring buffer living in a
+/// memory-mapped file
+///
+/// The file is typically created under /dev/shm by one process and opened by
+/// another one. Data is exchanged as records: each call to Write() or Writev()
+/// on a SharedRingBufferOutputStream publishes one record, which is never
+/// split at the end of the ring. Since IPC payloads are written with a single
+/// Writev() call, a message and its body are always contiguous in the mapping.
+///
+/// Space is reclaimed on the consumer side once every buffer handed out for a
+/// record has been destroyed. A consumer keeping all of its buffers alive
+/// therefore eventually blocks the producer.
+class ARROW_EXPORT SharedRingBuffer {
+ public:
+  ~SharedRingBuffer();
+
+  /// \brief Create (or truncate) a file and map a ring buffer into it
+  ///
+  /// \param[in] path the file to create, e.g. under /dev/shm
+  /// \param[in] capacity the number of bytes available for records, rounded
+  /// up to a multiple of 64
+  /// \param[out] out the created ring buffer
+  /// \return Status
+  static Status Create(const std::string& path, int64_t capacity,
+                       std::shared_ptr<SharedRingBuffer>* out);
+
+  /// \brief Map an existing ring buffer, created by another process
+  static Status Open(const std::string& path, std::shared_ptr<SharedRingBuffer>* out);
+
+  /// \brief The number of bytes available for records
+  int64_t capacity() const;
+
+  class ARROW_NO_EXPORT Impl;
+
+ private:
+  SharedRingBuffer();
+
+  friend class SharedRingBufferOutputStream;
+  friend class SharedRingBufferInputStream;
+
+  std::shared_ptr<Impl> impl_;
+};
+
+/// \brief The producer side of a SharedRingBuffer
+///
+/// Writes block while the ring does not have enough free space. A single
+/// write must fit in the ring, including an 8-byte record header.
+class ARROW_EXPORT SharedRingBufferOutputStream : public OutputStream {
+ public:
+  explicit SharedRingBufferOutputStream(std::shared_ptr<SharedRingBuffer> ring);
+  ~SharedRingBufferOutputStream() override;
+
+  /// \brief Close the stream, signalling the end of data to the consumer
+  Status Close() override;
+  bool closed() const override;
+  Status Tell(int64_t* position) const override;
+
+  /// \brief Copy the data into the ring as one record
+  Status Write(const void* data, int64_t nbytes) override;
+
+  /// \cond FALSE
+  using OutputStream::Write;
+  /// \endcond
+
+  /// \brief Gather the buffers into the ring as one contiguous record
+  Status Writev(const std::vector<std::shared_ptr<Buffer>>& data) override;
+
+ private:
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief The consumer side of a SharedRingBuffer
+///
+/// Reads that fall within a record return zero-copy slices of the shared
+/// mapping; reads spanning several records are copied. Reads block until
+/// enough data is available or the producer closes its stream.
+///
+/// Combine with ipc::MessageReader::Open() or RecordBatchStreamReader::Open()
+/// to receive IPC messages without copying their bodies.
+class ARROW_EXPORT SharedRingBufferInputStream : public InputStream {
+ public:
+  explicit SharedRingBufferInputStream(std::shared_ptr<SharedRingBuffer> ring);
+  ~SharedRingBufferInputStream() override;
+
+  /// \brief Close the stream. Buffers already read remain valid
+  Status Close() override;
+  bool closed() const override;
+  Status Tell(int64_t* position) const override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  bool supports_zero_copy() const override;
+
+ private:
+  class ARROW_NO_EXPORT Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,257 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/shared_memory.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+
+using internal::TemporaryDir;
+
+namespace io {
+
+// Record i holds i % 97 + 1 bytes, each equal to i
+static std::string MakeRecord(int i) {
+  return std::string(i % 97 + 1, static_cast<char>(i & 0xff));
+}
+
+class TestSharedRingBuffer : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(TemporaryDir::Make("shared-ring-test-", &temp_dir_));
+    path_ = temp_dir_->path().ToString() + "ring";
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::string path_;
+};
+
+TEST_F(TestSharedRingBuffer, CreateAndOpen) {
+  std::shared_ptr<SharedRingBuffer> ring, other;
+  ASSERT_OK(SharedRingBuffer::Create(path_, 1000, &ring));
+  ASSERT_EQ(1024, ring->capacity());
+  ASSERT_OK(SharedRingBuffer::Open(path_, &other));
+  ASSERT_EQ(1024, other->capacity());
+
+  ASSERT_RAISES(Invalid, SharedRingBuffer::Create(path_, 8, &ring));
+  ASSERT_RAISES(IOError, SharedRingBuffer::Open(path_ + "-missing", &other));
+}
+
+TEST_F(TestSharedRingBuffer, ZeroCopyRecords) {
+  std::shared_ptr<SharedRingBuffer> ring;
+  ASSERT_OK(SharedRingBuffer::Create(path_, 1024, &ring));
+  SharedRingBufferOutputStream writer(ring);
+  SharedRingBufferInputStream reader(ring);
+  ASSERT_TRUE(reader.supports_zero_copy());
+
+  ASSERT_OK(writer.Writev({Buffer::FromString("abc"), Buffer::FromString("defgh")}));
+  ASSERT_OK(writer.Write("ij", 2));
+  int64_t position;
+  ASSERT_OK(writer.Tell(&position));
+  ASSERT_EQ(10, position);
+  ASSERT_OK(writer.Close());
+  ASSERT_RAISES(IOError, writer.Write("k", 1));
+
+  // Reads within a record are slices of the same memory
+  std::shared_ptr<Buffer> first, second;
+  ASSERT_OK(reader.Read(3, &first));
+  ASSERT_OK(reader.Read(5, &second));
+  ASSERT_EQ("abc", first->ToString());
+  ASSERT_EQ("defgh", second->ToString());
+  ASSERT_EQ(first->data() + 3, second->data());
+
+  // A read across records is copied, and stops at the end of the stream
+  std::shared_ptr<Buffer> rest;
+  ASSERT_OK(reader.Read(100, &rest));
+  ASSERT_EQ("ij", rest->ToString());
+  ASSERT_OK(reader.Read(100, &rest));
+  ASSERT_EQ(0, rest->size());
+  ASSERT_OK(reader.Tell(&position));
+  ASSERT_EQ(10, position);
+}
+
+TEST_F(TestSharedRingBuffer, WrapAround) {
+  std::shared_ptr<SharedRingBuffer> ring;
+  ASSERT_OK(SharedRingBuffer::Create(path_, 256, &ring));
+  const int num_records = 1000;
+
+  std::thread producer([&]() {
+    SharedRingBufferOutputStream writer(ring);
+    for (int i = 0; i < num_records; ++i) {
+      ASSERT_OK(writer.Write(MakeRecord(i)));
+    }
+    ASSERT_OK(writer.Close());
+  });
+
+  SharedRingBufferInputStream reader(ring);
+  for (int i = 0; i < num_records; ++i) {
+    const std::string expected = MakeRecord(i);
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(reader.Read(static_cast<int64_t>(expected.size()), &buffer));
+    ASSERT_EQ(expected, buffer->ToString());
+  }
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(reader.Read(1, &buffer));
+  ASSERT_EQ(0, buffer->size());
+  producer.join();
+}
+
+TEST_F(TestSharedRingBuffer, LargeRecordsWrapAround) {
+  // Records larger than the remaining tail of the ring, but smaller than its
+  // capacity, must be written at the start once the consumer made room
+  std::shared_ptr<SharedRingBuffer> ring;
+  ASSERT_OK(SharedRingBuffer::Create(path_, 256, &ring));
+  const int64_t sizes[] = {40, 200, 120, 232, 8, 248};
+  const int num_records = 600;
+  auto make_record = [&](int i) {
+    return std::string(static_cast<size_t>(sizes[i % 6]),
+                       static_cast<char>('a' + i % 26));
+  };
+
+  std::thread producer([&]() {
+    SharedRingBufferOutputStream writer(ring);
+    for (int i = 0; i < num_records; ++i) {
+      ASSERT_OK(writer.Write(make_record(i)));
+    }
+    ASSERT_OK(writer.Close());
+  });
+
+  SharedRingBufferInputStream reader(ring);
+  for (int i = 0; i < num_records; ++i) {
+    const std::string expected = make_record(i);
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(reader.Read(static_cast<int64_t>(expected.size()), &buffer));
+    ASSERT_EQ(expected, buffer->ToString());
+  }
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(reader.Read(1, &buffer));
+  ASSERT_EQ(0, buffer->size());
+  producer.join();
+}
+
+TEST_F(TestSharedRingBuffer, ReleaseOnConsume) {
+  std::shared_ptr<SharedRingBuffer> ring;
+  ASSERT_OK(SharedRingBuffer::Create(path_, 256, &ring));
+  SharedRingBufferOutputStream writer(ring);
+  SharedRingBufferInputStream reader(ring);
+
+  // Fill the ring with a single record
+  ASSERT_OK(writer.Write(std::string(248, 'x')));
+  ASSERT_RAISES(Invalid, writer.Write(std::string(256, 'x')));
+
+  std::shared_ptr<Buffer> slice;
+  {
+    std::shared_ptr<Buffer> record;
+    ASSERT_OK(reader.Read(248, &record));
+    slice = SliceBuffer(record, 10, 10);
+  }
+
+  // The record is still referenced by a slice: the producer must wait
+  std::atomic<bool> written(false);
+  std::thread producer([&]() {
+    ASSERT_OK(writer.Write("y", 1));
+    written = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_FALSE(written);
+  ASSERT_EQ(std::string(10, 'x'), slice->ToString());
+
+  slice.reset();
+  producer.join();
+  ASSERT_TRUE(written);
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(reader.Read(1, &buffer));
+  ASSERT_EQ("y", buffer->ToString());
+}
+
+TEST_F(TestSharedRingBuffer, ClosedConsumer) {
+  std::shared_ptr<SharedRingBuffer> ring;
+  ASSERT_OK(SharedRingBuffer::Create(path_, 256, &ring));
+  SharedRingBufferOutputStream writer(ring);
+  SharedRingBufferInputStream reader(ring);
+
+  ASSERT_OK(writer.Write(std::string(200, 'x')));
+  ASSERT_OK(reader.Close());
+  ASSERT_TRUE(reader.closed());
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_RAISES(IOError, reader.Read(1, &buffer));
+  // No room left and nobody to make some
+  ASSERT_RAISES(IOError, writer.Write(std::string(200, 'x')));
+}
+
+#ifndef _WIN32
+TEST_F(TestSharedRingBuffer, TwoProcesses) {
+  std::shared_ptr<SharedRingBuffer> ring;
+  ASSERT_OK(SharedRingBuffer::Create(path_, 4096, &ring));
+  const int num_records = 5000;
+
+  pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0) {
+    // Child process: map the ring by path and produce
+    std::shared_ptr<SharedRingBuffer> child_ring;
+    bool ok = SharedRingBuffer::Open(path_, &child_ring).ok();
+    if (ok) {
+      SharedRingBufferOutputStream writer(child_ring);
+      for (int i = 0; ok && i < num_records; ++i) {
+        ok = writer.Write(MakeRecord(i)).ok();
+      }
+      ok = ok && writer.Close().ok();
+    }
+    _exit(ok ? 0 : 1);
+  }
+
+  SharedRingBufferInputStream reader(ring);
+  for (int i = 0; i < num_records; ++i) {
+    const std::string expected = MakeRecord(i);
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(reader.Read(static_cast<int64_t>(expected.size()), &buffer));
+    ASSERT_EQ(expected, buffer->ToString());
+  }
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(reader.Read(1, &buffer));
+  ASSERT_EQ(0, buffer->size());
+
+  int status;
+  ASSERT_EQ(pid, waitpid(pid, &status, 0));
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(0, WEXITSTATUS(status));
+}
+#endif
+
+}  // namespace io
+}  // namespace arrow
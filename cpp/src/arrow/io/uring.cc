@@ -0,0 +1,731 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/io/uring.h"
+
+#ifdef ARROW_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/io/util_internal.h"
+#include "arrow/status.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+
+namespace arrow {
+namespace io {
+
+using internal::MakeReadyFuture;
+
+using BufferResult = Result<std::shared_ptr<Buffer>>;
+
+#ifdef ARROW_IO_URING
+
+namespace {
+
+int IoUringSetup(unsigned entries, struct io_uring_params* params) {
+  return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+}
+
+int IoUringEnter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags) {
+  return static_cast<int>(
+      syscall(__NR_io_uring_enter, ring_fd, to_submit, min_complete, flags, nullptr, 0));
+}
+
+int IoUringRegister(int ring_fd, unsigned opcode, const void* arg, unsigned nr_args) {
+  return static_cast<int>(syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+template <typename T>
+T LoadAcquire(const T* ptr) {
+  return __atomic_load_n(ptr, __ATOMIC_ACQUIRE);
+}
+
+template <typename T>
+void StoreRelease(T* ptr, T value) {
+  __atomic_store_n(ptr, value, __ATOMIC_RELEASE);
+}
+
+// The longest wait before retrying a submission the kernel had no resources for
+constexpr int kMaxBackoffMicros = 1000;
+
+// The submission and completion queues of an io_uring instance, shared with
+// the kernel through memory mappings
+class Ring {
+ public:
+  Ring() = default;
+
+  ~Ring() {
+    if (sqes_ != nullptr) {
+      munmap(sqes_, sqes_size_);
+    }
+    if (cq_ptr_ != nullptr && cq_ptr_ != sq_ptr_) {
+      munmap(cq_ptr_, cq_size_);
+    }
+    if (sq_ptr_ != nullptr) {
+      munmap(sq_ptr_, sq_size_);
+    }
+    if (ring_fd_ >= 0) {
+      close(ring_fd_);
+    }
+  }
+
+  Status Init(unsigned entries) {
+    struct io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd_ = IoUringSetup(entries, &params);
+    if (ring_fd_ < 0) {
+      return Status::IOError("io_uring_setup failed: ",
+                             ::arrow::internal::ErrnoMessage(errno));
+    }
+    sq_entries_ = params.sq_entries;
+
+    sq_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_size_ = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    const bool single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) {
+      sq_size_ = cq_size_ = std::max(sq_size_, cq_size_);
+    }
+    RETURN_NOT_OK(Map(sq_size_, IORING_OFF_SQ_RING, &sq_ptr_));
+    if (single_mmap) {
+      cq_ptr_ = sq_ptr_;
+    } else {
+      RETURN_NOT_OK(Map(cq_size_, IORING_OFF_CQ_RING, &cq_ptr_));
+    }
+    sqes_size_ = params.sq_entries * sizeof(struct io_uring_sqe);
+    void* sqes = nullptr;
+    RETURN_NOT_OK(Map(sqes_size_, IORING_OFF_SQES, &sqes));
+    sqes_ = static_cast<struct io_uring_sqe*>(sqes);
+
+    auto sq = static_cast<uint8_t*>(sq_ptr_);
+    sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+    auto cq = static_cast<uint8_t*>(cq_ptr_);
+    cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+    local_tail_ = *sq_tail_;
+    return Status::OK();
+  }
+
+  int fd() const { return ring_fd_; }
+
+  unsigned entries() const { return sq_entries_; }
+
+  // The next free submission entry, zeroed. The caller keeps the number of
+  // entries in use below entries()
+  struct io_uring_sqe* NextSqe() {
+    const unsigned index = local_tail_ & sq_mask_;
+    struct io_uring_sqe* sqe = &sqes_[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sq_array_[index] = index;
+    ++local_tail_;
+    return sqe;
+  }
+
+  // Publish the prepared entries and submit those not yet consumed by the
+  // kernel, waiting for at least min_complete completions
+  Status Submit(unsigned min_complete) {
+    StoreRelease(sq_tail_, local_tail_);
+    int backoff_us = 1;
+    while (true) {
+      const unsigned to_submit = local_tail_ - LoadAcquire(sq_head_);
+      if (to_submit == 0 && min_complete == 0) {
+        return Status::OK();
+      }
+      const int ret = IoUringEnter(ring_fd_, to_submit, min_complete,
+                                   min_complete > 0 ? IORING_ENTER_GETEVENTS : 0);
+      if (ret >= 0) {
+        return Status::OK();
+      }
+      if (errno == EINTR) {
+        continue;
+      }
+      if (errno == EAGAIN || errno == EBUSY) {
+        // The kernel is short of resources until completions are reaped
+        if (*cq_head_ != LoadAcquire(cq_tail_)) {
+          return Status::OK();
+        }
+        // None is available yet: back off instead of spinning
+        std::this_thread::sleep_for(std::chrono::microseconds(backoff_us));
+        backoff_us = std::min(2 * backoff_us, kMaxBackoffMicros);
+        continue;
+      }
+      return Status::IOError("io_uring_enter failed: ",
+                             ::arrow::internal::ErrnoMessage(errno));
+    }
+  }
+
+  // Call visit(user_data, res) for every available completion
+  template <typename Visitor>
+  void Reap(Visitor&& visit) {
+    unsigned head = *cq_head_;
+    while (head != LoadAcquire(cq_tail_)) {
+      const struct io_uring_cqe* cqe = &cqes_[head & cq_mask_];
+      visit(cqe->user_data, cqe->res);
+      ++head;
+    }
+    StoreRelease(cq_head_, head);
+  }
+
+ private:
+  Status Map(size_t size, off_t offset, void** out) {
+    void* ptr =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+             offset);
+    if (ptr == MAP_FAILED) {
+      return Status::IOError("Mapping io_uring queue failed: ",
+                             ::arrow::internal::ErrnoMessage(errno));
+    }
+    *out = ptr;
+    return Status::OK();
+  }
+
+  int ring_fd_ = -1;
+  unsigned sq_entries_ = 0;
+  void* sq_ptr_ = nullptr;
+  void* cq_ptr_ = nullptr;
+  size_t sq_size_ = 0;
+  size_t cq_size_ = 0;
+  size_t sqes_size_ = 0;
+  struct io_uring_sqe* sqes_ = nullptr;
+
+  unsigned* sq_head_ = nullptr;
+  unsigned* sq_tail_ = nullptr;
+  unsigned* sq_array_ = nullptr;
+  unsigned sq_mask_ = 0;
+  unsigned* cq_head_ = nullptr;
+  unsigned* cq_tail_ = nullptr;
+  unsigned cq_mask_ = 0;
+  struct io_uring_cqe* cqes_ = nullptr;
+
+  // Tail of the submission queue including unpublished entries
+  unsigned local_tail_ = 0;
+};
+
+// Buffers registered with the kernel, lent to the results of reads. A slot
+// is free again once the Buffer handed out for it is destroyed
+class RegisteredBuffers : public std::enable_shared_from_this<RegisteredBuffers> {
+ public:
+  Status Init(int ring_fd, int num_buffers, int64_t buffer_size, MemoryPool* pool) {
+    buffer_size_ = buffer_size;
+    RETURN_NOT_OK(AllocateBuffer(pool, num_buffers * buffer_size, &memory_));
+    std::vector<struct iovec> iovecs(num_buffers);
+    for (int i = 0; i < num_buffers; ++i) {
+      iovecs[i].iov_base = memory_->mutable_data() + i * buffer_size;
+      iovecs[i].iov_len = static_cast<size_t>(buffer_size);
+      free_slots_.push_back(i);
+    }
+    if (IoUringRegister(ring_fd, IORING_REGISTER_BUFFERS, iovecs.data(),
+                        static_cast<unsigned>(num_buffers)) < 0) {
+      return Status::IOError("Registering io_uring buffers failed: ",
+                             ::arrow::internal::ErrnoMessage(errno));
+    }
+    return Status::OK();
+  }
+
+  int64_t buffer_size() const { return buffer_size_; }
+
+  uint8_t* data(int slot) { return memory_->mutable_data() + slot * buffer_size_; }
+
+  // Return a free slot, or -1 if all are lent
+  int Acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (free_slots_.empty()) {
+      return -1;
+    }
+    int slot = free_slots_.back();
+    free_slots_.pop_back();
+    return slot;
+  }
+
+  void Release(int slot) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    free_slots_.push_back(slot);
+  }
+
+  std::shared_ptr<Buffer> Lend(int slot, int64_t size);
+
+ private:
+  std::shared_ptr<Buffer> memory_;
+  int64_t buffer_size_ = 0;
+  std::mutex mutex_;
+  std::vector<int> free_slots_;
+};
+
+class SlotBuffer : public Buffer {
+ public:
+  SlotBuffer(std::shared_ptr<RegisteredBuffers> owner, int slot, int64_t size)
+      : Buffer(owner->data(slot), size), owner_(std::move(owner)), slot_(slot) {}
+
+  ~SlotBuffer() override { owner_->Release(slot_); }
+
+ private:
+  std::shared_ptr<RegisteredBuffers> owner_;
+  int slot_;
+};
+
+std::shared_ptr<Buffer> RegisteredBuffers::Lend(int slot, int64_t size) {
+  return std::make_shared<SlotBuffer>(shared_from_this(), slot, size);
+}
+
+struct ReadRequest {
+  int64_t position;
+  int64_t nbytes;
+  uint8_t* out;
+  // Index of the registered buffer holding out, or -1
+  int slot;
+  int64_t bytes_read;
+  struct iovec iov;
+  std::function<void(Status, int64_t)> on_done;
+};
+
+// The largest length of a single read entry, the rest is resubmitted
+constexpr int64_t kMaxReadLength = 1 << 30;
+
+}  // namespace
+
+class UringReadableFile::Impl {
+ public:
+  Impl(int fd, int64_t size, const UringOptions& options)
+      : fd_(fd), size_(size), pool_(options.pool) {}
+
+  ~Impl() {
+    if (!closed_) {
+      ARROW_CHECK_OK(Close());
+    }
+  }
+
+  Status Init(const UringOptions& options) {
+    if (options.queue_depth <= 0) {
+      return Status::Invalid("io_uring queue depth must be positive");
+    }
+    RETURN_NOT_OK(ring_.Init(static_cast<unsigned>(options.queue_depth)));
+    if (options.num_registered_buffers > 0) {
+      registered_ = std::make_shared<RegisteredBuffers>();
+      RETURN_NOT_OK(registered_->Init(ring_.fd(), options.num_registered_buffers,
+                                      options.registered_buffer_size, pool_));
+    }
+    thread_ = std::thread([this]() { Run(); });
+    return Status::OK();
+  }
+
+  Status Close() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_) {
+        return Status::OK();
+      }
+      closed_ = true;
+    }
+    cv_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+    return ::arrow::internal::FileClose(fd_);
+  }
+
+  bool closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+  }
+
+  Status CheckClosed() const {
+    if (closed()) {
+      return Status::Invalid("Invalid operation on closed file");
+    }
+    return Status::OK();
+  }
+
+  int fd() const { return fd_; }
+
+  int64_t size() const { return size_; }
+
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read, void* out) {
+    RETURN_NOT_OK(CheckRange(position, nbytes));
+    if (nbytes == 0) {
+      *bytes_read = 0;
+      return Status::OK();
+    }
+    std::promise<Status> done;
+    auto request = new ReadRequest{position, nbytes, static_cast<uint8_t*>(out), -1, 0,
+                                   {}, nullptr};
+    request->on_done = [&done, bytes_read](Status st, int64_t nread) {
+      *bytes_read = nread;
+      done.set_value(std::move(st));
+    };
+    auto fut = done.get_future();
+    RETURN_NOT_OK(Enqueue(request));
+    return fut.get();
+  }
+
+  std::future<BufferResult> ReadAsync(int64_t position, int64_t nbytes) {
+    Status st = CheckRange(position, nbytes);
+    if (!st.ok()) {
+      return MakeReadyFuture(BufferResult(st));
+    }
+    if (nbytes == 0) {
+      return MakeReadyFuture(BufferResult(std::make_shared<Buffer>(nullptr, 0)));
+    }
+
+    auto promise = std::make_shared<std::promise<BufferResult>>();
+    auto request = new ReadRequest{position, nbytes, nullptr, -1, 0, {}, nullptr};
+    if (registered_ != nullptr && nbytes <= registered_->buffer_size()) {
+      request->slot = registered_->Acquire();
+    }
+    if (request->slot >= 0) {
+      std::shared_ptr<RegisteredBuffers> registered = registered_;
+      const int slot = request->slot;
+      request->out = registered->data(slot);
+      request->on_done = [promise, registered, slot](Status st, int64_t nread) {
+        if (!st.ok()) {
+          registered->Release(slot);
+          promise->set_value(std::move(st));
+        } else {
+          promise->set_value(registered->Lend(slot, nread));
+        }
+      };
+    } else {
+      std::shared_ptr<ResizableBuffer> buffer;
+      st = AllocateResizableBuffer(pool_, nbytes, &buffer);
+      if (!st.ok()) {
+        delete request;
+        return MakeReadyFuture(BufferResult(st));
+      }
+      request->out = buffer->mutable_data();
+      request->on_done = [promise, buffer](Status st, int64_t nread) {
+        if (st.ok() && nread < buffer->size()) {
+          st = buffer->Resize(nread);
+          buffer->ZeroPadding();
+        }
+        if (!st.ok()) {
+          promise->set_value(std::move(st));
+        } else {
+          promise->set_value(std::static_pointer_cast<Buffer>(buffer));
+        }
+      };
+    }
+    auto fut = promise->get_future();
+    st = Enqueue(request);
+    if (!st.ok()) {
+      return MakeReadyFuture(BufferResult(st));
+    }
+    return fut;
+  }
+
+ private:
+  Status CheckRange(int64_t position, int64_t nbytes) const {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0) {
+      return Status::Invalid("Cannot read from negative position");
+    }
+    if (nbytes < 0) {
+      return Status::Invalid("Negative read size: ", nbytes);
+    }
+    return Status::OK();
+  }
+
+  // Takes ownership of the request
+  Status Enqueue(ReadRequest* request) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (closed_ || !failed_.ok()) {
+        Status st =
+            closed_ ? Status::Invalid("Invalid operation on closed file") : failed_;
+        if (request->slot >= 0) {
+          registered_->Release(request->slot);
+        }
+        delete request;
+        return st;
+      }
+      pending_.push_back(request);
+    }
+    cv_.notify_one();
+    return Status::OK();
+  }
+
+  void Prepare(ReadRequest* request) {
+    struct io_uring_sqe* sqe = ring_.NextSqe();
+    const int64_t length =
+        std::min(request->nbytes - request->bytes_read, kMaxReadLength);
+    uint8_t* dest = request->out + request->bytes_read;
+    sqe->fd = fd_;
+    sqe->off = static_cast<uint64_t>(request->position + request->bytes_read);
+    if (request->slot >= 0) {
+      sqe->opcode = IORING_OP_READ_FIXED;
+      sqe->addr = reinterpret_cast<uint64_t>(dest);
+      sqe->len = static_cast<uint32_t>(length);
+      sqe->buf_index = static_cast<uint16_t>(request->slot);
+    } else {
+      request->iov.iov_base = dest;
+      request->iov.iov_len = static_cast<size_t>(length);
+      sqe->opcode = IORING_OP_READV;
+      sqe->addr = reinterpret_cast<uint64_t>(&request->iov);
+      sqe->len = 1;
+    }
+    sqe->user_data = reinterpret_cast<uint64_t>(request);
+  }
+
+  static void Finish(ReadRequest* request, Status st) {
+    request->on_done(std::move(st), request->bytes_read);
+    delete request;
+  }
+
+  // Handle a completion, returning true if the request needs another read
+  bool Complete(ReadRequest* request, int res) {
+    if (res == -EINTR || res == -EAGAIN) {
+      return true;
+    }
+    if (res < 0) {
+      Finish(request, Status::IOError("Error reading bytes from file: ",
+                                      ::arrow::internal::ErrnoMessage(-res)));
+      return false;
+    }
+    request->bytes_read += res;
+    // Short reads happen: keep reading until the end of the file
+    if (res > 0 && request->bytes_read < request->nbytes &&
+        request->position + request->bytes_read < size_) {
+      return true;
+    }
+    Finish(request, Status::OK());
+    return false;
+  }
+
+  // The ring thread: submit all pending reads at once, then complete them
+  void Run() {
+    // Requests handed to the ring and not completed yet
+    std::unordered_set<ReadRequest*> in_flight;
+    std::deque<ReadRequest*> retries;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      cv_.wait(lock,
+               [&]() { return !pending_.empty() || !in_flight.empty() || closed_; });
+      if (closed_ && pending_.empty() && in_flight.empty()) {
+        break;
+      }
+      while (!pending_.empty() && in_flight.size() < ring_.entries()) {
+        Prepare(pending_.front());
+        in_flight.insert(pending_.front());
+        pending_.pop_front();
+      }
+      lock.unlock();
+
+      Status st = ring_.Submit(in_flight.empty() ? 0 : 1);
+      if (!st.ok()) {
+        // The ring is unusable: fail everything without waiting on it again
+        lock.lock();
+        failed_ = st;
+        for (ReadRequest* request : pending_) {
+          Finish(request, st);
+        }
+        pending_.clear();
+        // The kernel may still write into in-flight reads, keep their
+        // buffers alive until the ring is destroyed
+        for (ReadRequest* request : in_flight) {
+          request->on_done(st, request->bytes_read);
+          abandoned_.emplace_back(request);
+        }
+        in_flight.clear();
+        continue;
+      }
+      ring_.Reap([&](uint64_t user_data, int res) {
+        auto request = reinterpret_cast<ReadRequest*>(user_data);
+        in_flight.erase(request);
+        if (Complete(request, res)) {
+          retries.push_back(request);
+        }
+      });
+      lock.lock();
+      for (auto it = retries.rbegin(); it != retries.rend(); ++it) {
+        pending_.push_front(*it);
+      }
+      retries.clear();
+    }
+  }
+
+  const int fd_;
+  const int64_t size_;
+  MemoryPool* pool_;
+
+  // Reads failed while in flight, destroyed after the ring
+  std::vector<std::unique_ptr<ReadRequest>> abandoned_;
+  Ring ring_;
+  std::shared_ptr<RegisteredBuffers> registered_;
+
+  std::thread thread_;
+  mutable std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<ReadRequest*> pending_;
+  bool closed_ = false;
+  Status failed_;
+};
+
+bool UringReadableFile::IsAvailable() {
+  static const bool available = []() {
+    Ring ring;
+    return ring.Init(1).ok();
+  }();
+  return available;
+}
+
+Status UringReadableFile::Open(const std::string& path, const UringOptions& options,
+                               std::shared_ptr<RandomAccessFile>* file) {
+  if (!IsAvailable()) {
+    std::shared_ptr<ReadableFile> readable;
+    RETURN_NOT_OK(ReadableFile::Open(path, options.pool, &readable));
+    *file = std::move(readable);
+    return Status::OK();
+  }
+
+  ::arrow::internal::PlatformFilename file_name;
+  RETURN_NOT_OK(::arrow::internal::FileNameFromString(path, &file_name));
+  int fd;
+  RETURN_NOT_OK(::arrow::internal::FileOpenReadable(file_name, &fd));
+  int64_t size;
+  Status st = ::arrow::internal::FileGetSize(fd, &size);
+  if (!st.ok()) {
+    ARROW_UNUSED(::arrow::internal::FileClose(fd));
+    return st;
+  }
+  std::unique_ptr<Impl> impl(new Impl(fd, size, options));
+  st = impl->Init(options);
+  if (!st.ok()) {
+    ARROW_UNUSED(impl->Close());
+    return st;
+  }
+  file->reset(new UringReadableFile(std::move(impl)));
+  return Status::OK();
+}
+
+#else  // !ARROW_IO_URING
+
+// Never instantiated: Open() returns a ReadableFile
+class UringReadableFile::Impl {
+ public:
+  Status Close() { return Status::OK(); }
+  bool closed() const { return true; }
+  Status CheckClosed() const { return Status::Invalid("io_uring is not available"); }
+  int fd() const { return -1; }
+  int64_t size() const { return 0; }
+
+  Status ReadAt(int64_t, int64_t, int64_t*, void*) { return CheckClosed(); }
+
+  std::future<BufferResult> ReadAsync(int64_t, int64_t) {
+    return MakeReadyFuture(BufferResult(CheckClosed()));
+  }
+};
+
+bool UringReadableFile::IsAvailable() { return false; }
+
+Status UringReadableFile::Open(const std::string& path, const UringOptions& options,
+                               std::shared_ptr<RandomAccessFile>* file) {
+  std::shared_ptr<ReadableFile> readable;
+  RETURN_NOT_OK(ReadableFile::Open(path, options.pool, &readable));
+  *file = std::move(readable);
+  return Status::OK();
+}
+
+#endif  // ARROW_IO_URING
+
+UringReadableFile::UringReadableFile(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+UringReadableFile::~UringReadableFile() { internal::CloseFromDestructor(this); }
+
+Status UringReadableFile::Close() { return impl_->Close(); }
+
+bool UringReadableFile::closed() const { return impl_->closed(); }
+
+Status UringReadableFile::Tell(int64_t* position) const {
+  RETURN_NOT_OK(impl_->CheckClosed());
+  *position = position_;
+  return Status::OK();
+}
+
+Status UringReadableFile::Seek(int64_t position) {
+  RETURN_NOT_OK(impl_->CheckClosed());
+  if (position < 0) {
+    return Status::Invalid("Invalid position");
+  }
+  position_ = position;
+  return Status::OK();
+}
+
+Status UringReadableFile::GetSize(int64_t* size) {
+  RETURN_NOT_OK(impl_->CheckClosed());
+  *size = impl_->size();
+  return Status::OK();
+}
+
+Status UringReadableFile::Read(int64_t nbytes, int64_t* bytes_read, void* out) {
+  RETURN_NOT_OK(impl_->ReadAt(position_, nbytes, bytes_read, out));
+  position_ += *bytes_read;
+  return Status::OK();
+}
+
+Status UringReadableFile::Read(int64_t nbytes, std::shared_ptr<Buffer>* out) {
+  RETURN_NOT_OK(ReadAt(position_, nbytes, out));
+  position_ += (*out)->size();
+  return Status::OK();
+}
+
+Status UringReadableFile::ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                                 void* out) {
+  return impl_->ReadAt(position, nbytes, bytes_read, out);
+}
+
+Status UringReadableFile::ReadAt(int64_t position, int64_t nbytes,
+                                 std::shared_ptr<Buffer>* out) {
+  auto result = impl_->ReadAsync(position, nbytes).get();
+  RETURN_NOT_OK(result.status());
+  *out = std::move(result).ValueOrDie();
+  return Status::OK();
+}
+
+std::future<Result<std::shared_ptr<Buffer>>> UringReadableFile::ReadAsync(
+    int64_t position, int64_t nbytes) {
+  return impl_->ReadAsync(position, nbytes);
+}
+
+int UringReadableFile::file_descriptor() const { return impl_->fd(); }
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Local file reads through the Linux io_uring interface
+
+#pragma once
+
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+
+#include "arrow/io/interfaces.h"
+#include "arrow/memory_pool.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Buffer;
+class Status;
+
+namespace io {
+
+struct ARROW_EXPORT UringOptions {
+  /// \brief Number of submission queue entries: the number of reads the
+  /// kernel can be working on at once
+  int queue_depth = 64;
+  /// \brief Number of buffers registered with the kernel for reads. Registered
+  /// buffers save the kernel from mapping pages on every read; 0 disables them
+  int num_registered_buffers = 0;
+  /// \brief Size of each registered buffer. Reads larger than this, or issued
+  /// while all registered buffers are handed out, use a regular buffer
+  int64_t registered_buffer_size = 1 << 20;
+  /// \brief Pool for read buffers and for the registered buffers
+  MemoryPool* pool = default_memory_pool();
+
+  static UringOptions Defaults() { return UringOptions(); }
+};
+
+/// \brief A local file read through io_uring
+///
+/// Reads issued with ReadAsync() are queued to a thread owning the ring,
+/// which submits all pending reads with a single system call and completes
+/// their futures as the kernel finishes them, so that many reads can be in
+/// flight at once. Synchronous reads wait for their asynchronous counterpart.
+///
+/// io_uring is only built on Linux with ARROW_IO_URING enabled, and may be
+/// unavailable at runtime (old kernels, seccomp filters). Open() then returns
+/// a ReadableFile instead.
+class ARROW_EXPORT UringReadableFile : public RandomAccessFile {
+ public:
+  ~UringReadableFile() override;
+
+  /// \brief Whether io_uring is built in and usable in this process
+  static bool IsAvailable();
+
+  /// \brief Open a local file for reading with io_uring, falling back to a
+  /// ReadableFile when io_uring is not available
+  ///
+  /// \param[in] path the file path
+  /// \param[in] options the ring and buffer options
+  /// \param[out] file the opened file
+  /// \return Status
+  static Status Open(const std::string& path, const UringOptions& options,
+                     std::shared_ptr<RandomAccessFile>* file);
+
+  Status Close() override;
+  bool closed() const override;
+
+  Status Tell(int64_t* position) const override;
+  Status Seek(int64_t position) override;
+  Status GetSize(int64_t* size) override;
+
+  Status Read(int64_t nbytes, int64_t* bytes_read, void* out) override;
+  Status Read(int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Thread-safe positional read, leaving the file position unchanged
+  Status ReadAt(int64_t position, int64_t nbytes, int64_t* bytes_read,
+                void* out) override;
+  /// \brief Thread-safe positional read, leaving the file position unchanged
+  Status ReadAt(int64_t position, int64_t nbytes, std::shared_ptr<Buffer>* out) override;
+
+  /// \brief Queue a read to the ring without blocking
+  std::future<Result<std::shared_ptr<Buffer>>> ReadAsync(int64_t position,
+                                                         int64_t nbytes) override;
+
+  int file_descriptor() const;
+
+ private:
+  class ARROW_NO_EXPORT Impl;
+
+  explicit UringReadableFile(std::unique_ptr<Impl> impl);
+
+  std::unique_ptr<Impl> impl_;
+  int64_t position_ = 0;
+};
+
+}  // namespace io
+}  // namespace arrow
@@ -0,0 +1,198 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/io/uring.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+
+using internal::TemporaryDir;
+
+namespace io {
+
+static std::string MakeContents(int64_t size) {
+  std::string contents(static_cast<size_t>(size), '\0');
+  for (int64_t i = 0; i < size; ++i) {
+    contents[static_cast<size_t>(i)] = static_cast<char>((i * 31 + i / 251) & 0xff);
+  }
+  return contents;
+}
+
+class TestUringReadableFile : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(TemporaryDir::Make("uring-test-", &temp_dir_));
+    path_ = temp_dir_->path().ToString() + "data";
+    contents_ = MakeContents(1 << 18);
+    std::shared_ptr<FileOutputStream> stream;
+    ASSERT_OK(FileOutputStream::Open(path_, &stream));
+    ASSERT_OK(stream->Write(contents_));
+    ASSERT_OK(stream->Close());
+  }
+
+  void OpenFile(const UringOptions& options = UringOptions::Defaults()) {
+    ASSERT_OK(UringReadableFile::Open(path_, options, &file_));
+    if (UringReadableFile::IsAvailable()) {
+      ASSERT_NE(nullptr, dynamic_cast<UringReadableFile*>(file_.get()));
+    } else {
+      ASSERT_NE(nullptr, dynamic_cast<ReadableFile*>(file_.get()));
+    }
+  }
+
+  std::string Expected(int64_t position, int64_t nbytes) const {
+    return contents_.substr(static_cast<size_t>(position), static_cast<size_t>(nbytes));
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> temp_dir_;
+  std::string path_;
+  std::string contents_;
+  std::shared_ptr<RandomAccessFile> file_;
+};
+
+TEST_F(TestUringReadableFile, Read) {
+  OpenFile();
+  int64_t size;
+  ASSERT_OK(file_->GetSize(&size));
+  ASSERT_EQ(static_cast<int64_t>(contents_.size()), size);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->Read(1000, &buffer));
+  ASSERT_EQ(Expected(0, 1000), buffer->ToString());
+  std::string out(500, '\0');
+  int64_t bytes_read;
+  ASSERT_OK(file_->Read(500, &bytes_read, &out[0]));
+  ASSERT_EQ(500, bytes_read);
+  ASSERT_EQ(Expected(1000, 500), out);
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(1500, position);
+
+  // Reads stop at the end of the file
+  ASSERT_OK(file_->Seek(size - 10));
+  ASSERT_OK(file_->Read(100, &buffer));
+  ASSERT_EQ(Expected(size - 10, 10), buffer->ToString());
+  ASSERT_OK(file_->Read(100, &buffer));
+  ASSERT_EQ(0, buffer->size());
+}
+
+TEST_F(TestUringReadableFile, ReadAt) {
+  OpenFile();
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(file_->ReadAt(12345, 54321, &buffer));
+  ASSERT_EQ(Expected(12345, 54321), buffer->ToString());
+
+  std::string out(100, '\0');
+  int64_t bytes_read;
+  ASSERT_OK(file_->ReadAt(7, 100, &bytes_read, &out[0]));
+  ASSERT_EQ(100, bytes_read);
+  ASSERT_EQ(Expected(7, 100), out);
+
+  // The file position is unchanged
+  int64_t position;
+  ASSERT_OK(file_->Tell(&position));
+  ASSERT_EQ(0, position);
+
+  ASSERT_OK(file_->ReadAt(0, 0, &buffer));
+  ASSERT_EQ(0, buffer->size());
+  ASSERT_RAISES(Invalid, file_->ReadAt(-1, 1, &buffer));
+  ASSERT_RAISES(Invalid, file_->ReadAt(0, -1, &buffer));
+}
+
+TEST_F(TestUringReadableFile, ManyReadAsync) {
+  UringOptions options;
+  // Fewer queue entries than reads: reads wait for free entries
+  options.queue_depth = 8;
+  OpenFile(options);
+
+  const int64_t size = static_cast<int64_t>(contents_.size());
+  std::vector<std::pair<int64_t, int64_t>> ranges;
+  std::vector<std::future<Result<std::shared_ptr<Buffer>>>> futures;
+  for (int i = 0; i < 200; ++i) {
+    const int64_t position = (i * 7919) % size;
+    const int64_t nbytes = 1 + (i * 104729) % 20000;
+    ranges.emplace_back(position, nbytes);
+    futures.push_back(file_->ReadAsync(position, nbytes));
+  }
+  for (size_t i = 0; i < futures.size(); ++i) {
+    auto result = futures[i].get();
+    ASSERT_OK(result.status());
+    const int64_t expected_size = std::min(ranges[i].second, size - ranges[i].first);
+    ASSERT_EQ(Expected(ranges[i].first, expected_size), result.ValueOrDie()->ToString());
+  }
+}
+
+TEST_F(TestUringReadableFile, RegisteredBuffers) {
+  UringOptions options;
+  options.num_registered_buffers = 2;
+  options.registered_buffer_size = 4096;
+  OpenFile(options);
+
+  // Hold on to more buffers than registered, some larger than a slot
+  std::vector<std::shared_ptr<Buffer>> buffers;
+  for (int i = 0; i < 6; ++i) {
+    const int64_t nbytes = (i % 2 == 0) ? 1000 : 10000;
+    auto result = file_->ReadAsync(i * 1000, nbytes).get();
+    ASSERT_OK(result.status());
+    ASSERT_EQ(Expected(i * 1000, nbytes), result.ValueOrDie()->ToString());
+    buffers.push_back(result.ValueOrDie());
+  }
+  // Slots are reused once their buffers are released
+  buffers.clear();
+  for (int i = 0; i < 6; ++i) {
+    std::shared_ptr<Buffer> buffer;
+    ASSERT_OK(file_->ReadAt(i * 3000, 3000, &buffer));
+    ASSERT_EQ(Expected(i * 3000, 3000), buffer->ToString());
+  }
+}
+
+TEST_F(TestUringReadableFile, Closed) {
+  OpenFile();
+  ASSERT_FALSE(file_->closed());
+  ASSERT_OK(file_->Close());
+  ASSERT_TRUE(file_->closed());
+  ASSERT_OK(file_->Close());
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_RAISES(Invalid, file_->ReadAt(0, 10, &buffer));
+  ASSERT_RAISES(Invalid, file_->ReadAsync(0, 10).get().status());
+  int64_t size;
+  ASSERT_RAISES(Invalid, file_->GetSize(&size));
+}
+
+TEST_F(TestUringReadableFile, MissingFile) {
+  std::shared_ptr<RandomAccessFile> file;
+  ASSERT_RAISES(IOError, UringReadableFile::Open(path_ + "-missing",
+                                                 UringOptions::Defaults(), &file));
+}
+
+}  // namespace io
+}  // namespace arrow
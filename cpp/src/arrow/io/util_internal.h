@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <future>
+#include <utility>
+
 #include "arrow/io/interfaces.h"
 #include "arrow/util/visibility.h"
 
@@ -26,6 +29,15 @@ namespace internal {
 
 ARROW_EXPORT void CloseFromDestructor(FileInterface* file);
 
+// Wrap the result of a read that completed synchronously, for ReadAsync()
+// implementations that need no thread
+template <typename T>
+std::future<T> MakeReadyFuture(T value) {
+  std::promise<T> promise;
+  promise.set_value(std::move(value));
+  return promise.get_future();
+}
+
 }  // namespace internal
 }  // namespace io
 }  // namespace arrow
@@ -24,6 +24,7 @@
 #include <utility>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
@@ -134,6 +135,18 @@ Status DictionaryMemo::AddDictionary(int64_t id,
   return Status::OK();
 }
 
+Status DictionaryMemo::AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                                          MemoryPool* pool) {
+  auto it = id_to_dictionary_.find(id);
+  if (it == id_to_dictionary_.end()) {
+    return Status::KeyError("No dictionary with id ", id, " to apply delta to");
+  }
+  std::shared_ptr<Array> combined;
+  RETURN_NOT_OK(Concatenate({it->second, delta}, pool, &combined));
+  it->second = combined;
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // CollectDictionaries implementation
 
@@ -180,5 +193,50 @@ Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo) {
   return collector.Collect(batch);
 }
 
+// Like DictionaryCollector, but walks the fields of a given schema (whose
+// ids are already in the memo) alongside the arrays of the batch
+struct DictionaryGatherer {
+  const DictionaryMemo& dictionary_memo_;
+  DictionaryMap* out_;
+
+  Status WalkChildren(const DataType& type, const Array& array) {
+    for (int i = 0; i < type.num_children(); ++i) {
+      auto boxed_child = MakeArray(array.data()->child_data[i]);
+      RETURN_NOT_OK(Visit(*type.child(i), *boxed_child));
+    }
+    return Status::OK();
+  }
+
+  Status Visit(const Field& field, const Array& array) {
+    const DataType& type = *field.type();
+    if (type.id() == Type::DICTIONARY) {
+      const auto& dict_array = static_cast<const DictionaryArray&>(array);
+      auto dictionary = dict_array.dictionary();
+      int64_t id = -1;
+      RETURN_NOT_OK(dictionary_memo_.GetId(field, &id));
+      (*out_)[id] = dictionary;
+
+      const auto& dict_type = static_cast<const DictionaryType&>(type);
+      RETURN_NOT_OK(WalkChildren(*dict_type.value_type(), *dictionary));
+    } else {
+      RETURN_NOT_OK(WalkChildren(type, array));
+    }
+    return Status::OK();
+  }
+
+  Status Gather(const Schema& schema, const RecordBatch& batch) {
+    for (int i = 0; i < schema.num_fields(); ++i) {
+      RETURN_NOT_OK(Visit(*schema.field(i), *batch.column(i)));
+    }
+    return Status::OK();
+  }
+};
+
+Status GetDictionaries(const Schema& schema, const RecordBatch& batch,
+                       const DictionaryMemo& memo, DictionaryMap* out) {
+  DictionaryGatherer gatherer{memo, out};
+  return gatherer.Gather(schema, batch);
+}
+
 }  // namespace ipc
 }  // namespace arrow
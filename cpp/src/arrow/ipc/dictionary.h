@@ -33,7 +33,9 @@ namespace arrow {
 class Array;
 class DataType;
 class Field;
+class MemoryPool;
 class RecordBatch;
+class Schema;
 
 namespace ipc {
 
@@ -77,6 +79,12 @@ class ARROW_EXPORT DictionaryMemo {
   /// KeyError if that dictionary already exists
   Status AddDictionary(int64_t id, const std::shared_ptr<Array>& dictionary);
 
+  /// \brief Append values to the dictionary with a particular id, as
+  /// received in a delta dictionary batch. Returns KeyError if there is no
+  /// dictionary with that id yet
+  Status AddDictionaryDelta(int64_t id, const std::shared_ptr<Array>& delta,
+                            MemoryPool* pool);
+
   const DictionaryMap& id_to_dictionary() const { return id_to_dictionary_; }
 
   /// \brief The number of fields tracked in the memo
@@ -100,6 +108,13 @@ class ARROW_EXPORT DictionaryMemo {
 ARROW_EXPORT
 Status CollectDictionaries(const RecordBatch& batch, DictionaryMemo* memo);
 
+/// \brief Gather the dictionaries of a record batch, keyed by the ids the
+/// memo assigned to the corresponding fields of schema. The batch must have a
+/// schema equal to schema; the memo is not modified
+ARROW_EXPORT
+Status GetDictionaries(const Schema& schema, const RecordBatch& batch,
+                       const DictionaryMemo& memo, DictionaryMap* out);
+
 }  // namespace ipc
 }  // namespace arrow
 
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -241,8 +242,11 @@ std::string FormatMessageType(Message::Type type) {
   return "unknown";
 }
 
-Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
-                   std::unique_ptr<Message>* message) {
+// Read the length-prefixed flatbuffer of an encapsulated message at the given
+// file offset. Sets *metadata to null at end of stream
+static Status ReadEncapsulatedMetadata(int64_t offset, int32_t metadata_length,
+                                       io::RandomAccessFile* file,
+                                       std::shared_ptr<Buffer>* metadata) {
   ARROW_CHECK_GT(static_cast<size_t>(metadata_length), sizeof(int32_t))
       << "metadata_length should be at least 4";
 
@@ -279,7 +283,7 @@ Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile
 
   if (flatbuffer_length == 0) {
     // EOS
-    *message = nullptr;
+    *metadata = nullptr;
     return Status::OK();
   }
 
@@ -289,11 +293,34 @@ Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile
                            ", metadata length: ", metadata_length);
   }
 
-  std::shared_ptr<Buffer> metadata =
-      SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+  *metadata = SliceBuffer(buffer, prefix_size, buffer->size() - prefix_size);
+  return Status::OK();
+}
+
+Status ReadMessage(int64_t offset, int32_t metadata_length, io::RandomAccessFile* file,
+                   std::unique_ptr<Message>* message) {
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(ReadEncapsulatedMetadata(offset, metadata_length, file, &metadata));
+  if (metadata == nullptr) {
+    *message = nullptr;
+    return Status::OK();
+  }
   return Message::ReadFrom(offset + metadata_length, metadata, file, message);
 }
 
+Status ReadMessageMetadata(int64_t offset, int32_t metadata_length,
+                           io::RandomAccessFile* file,
+                           std::unique_ptr<Message>* message) {
+  std::shared_ptr<Buffer> metadata;
+  RETURN_NOT_OK(ReadEncapsulatedMetadata(offset, metadata_length, file, &metadata));
+  if (metadata == nullptr) {
+    *message = nullptr;
+    return Status::OK();
+  }
+  RETURN_NOT_OK(MaybeAlignMetadata(&metadata));
+  return Message::Open(metadata, /*body=*/nullptr, message);
+}
+
 Status AlignStream(io::InputStream* stream, int32_t alignment) {
   int64_t position = -1;
   RETURN_NOT_OK(stream->Tell(&position));
@@ -383,33 +410,42 @@ Status ReadMessageCopy(io::InputStream* file, MemoryPool* pool,
   return ReadMessage(file, pool, /*copy_metadata=*/true, out);
 }
 
+namespace internal {
+
+MessageFraming GetMessageFraming(int32_t flatbuffer_size, const IpcOptions& options) {
+  MessageFraming framing;
+  framing.prefix_size = options.write_legacy_ipc_format ? 4 : 8;
+  framing.message_length = static_cast<int32_t>(
+      PaddedLength(flatbuffer_size + framing.prefix_size, options.alignment));
+  framing.padding = framing.message_length - flatbuffer_size - framing.prefix_size;
+
+  // ARROW-6314: Write continuation / padding token, then the flatbuffer size
+  // prefix including padding
+  uint8_t* prefix = framing.prefix;
+  if (!options.write_legacy_ipc_format) {
+    std::memcpy(prefix, &kIpcContinuationToken, sizeof(int32_t));
+    prefix += sizeof(int32_t);
+  }
+  const int32_t padded_flatbuffer_size = framing.message_length - framing.prefix_size;
+  std::memcpy(prefix, &padded_flatbuffer_size, sizeof(int32_t));
+  return framing;
+}
+
+}  // namespace internal
+
 Status WriteMessage(const Buffer& message, const IpcOptions& options,
                     io::OutputStream* file, int32_t* message_length) {
-  const int32_t prefix_size = options.write_legacy_ipc_format ? 4 : 8;
   const int32_t flatbuffer_size = static_cast<int32_t>(message.size());
-
-  int32_t padded_message_length = static_cast<int32_t>(
-      PaddedLength(flatbuffer_size + prefix_size, options.alignment));
-
-  int32_t padding = padded_message_length - flatbuffer_size - prefix_size;
+  const auto framing = internal::GetMessageFraming(flatbuffer_size, options);
 
   // The returned message size includes the length prefix, the flatbuffer,
   // plus padding
-  *message_length = padded_message_length;
-
-  // ARROW-6314: Write continuation / padding token
-  if (!options.write_legacy_ipc_format) {
-    RETURN_NOT_OK(file->Write(&internal::kIpcContinuationToken, sizeof(int32_t)));
-  }
-
-  // Write the flatbuffer size prefix including padding
-  int32_t padded_flatbuffer_size = padded_message_length - prefix_size;
-  RETURN_NOT_OK(file->Write(&padded_flatbuffer_size, sizeof(int32_t)));
+  *message_length = framing.message_length;
 
-  // Write the flatbuffer
+  RETURN_NOT_OK(file->Write(framing.prefix, framing.prefix_size));
   RETURN_NOT_OK(file->Write(message.data(), flatbuffer_size));
-  if (padding > 0) {
-    RETURN_NOT_OK(file->Write(kPaddingBytes, padding));
+  if (framing.padding > 0) {
+    RETURN_NOT_OK(file->Write(kPaddingBytes, framing.padding));
   }
 
   return Status::OK();
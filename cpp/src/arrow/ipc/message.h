@@ -197,6 +197,20 @@ ARROW_EXPORT
 Status ReadMessage(const int64_t offset, const int32_t metadata_length,
                    io::RandomAccessFile* file, std::unique_ptr<Message>* message);
 
+/// \brief Read only the metadata of an encapsulated IPC message at an offset
+/// in a file. The body is left in the file and the message's body() is null;
+/// it starts at offset + metadata_length
+///
+/// \param[in] offset the position in the file where the message starts
+/// \param[in] metadata_length the total number of bytes to read from file
+/// \param[in] file the seekable file interface to read from
+/// \param[out] message the message read
+/// \return Status success or failure
+ARROW_EXPORT
+Status ReadMessageMetadata(const int64_t offset, const int32_t metadata_length,
+                           io::RandomAccessFile* file,
+                           std::unique_ptr<Message>* message);
+
 /// \brief Advance stream to an 8-byte offset if its position is not a multiple
 /// of 8 already
 /// \param[in] stream an input stream
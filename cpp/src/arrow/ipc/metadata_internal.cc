@@ -848,9 +848,16 @@ Status SchemaToFlatbuffer(FBB& fbb, const Schema& schema, DictionaryMemo* dictio
 
 Status WriteFBMessage(FBB& fbb, flatbuf::MessageHeader header_type,
                       flatbuffers::Offset<void> header, int64_t body_length,
-                      std::shared_ptr<Buffer>* out) {
+                      std::shared_ptr<Buffer>* out,
+                      Compression::type compression = Compression::UNCOMPRESSED) {
+  flatbuffers::Offset<KVVector> fb_custom_metadata;
+  if (compression != Compression::UNCOMPRESSED) {
+    std::vector<KeyValueOffset> key_values = {AppendKeyValue(
+        fbb, kBodyCompressionKey, util::Codec::GetCodecAsString(compression))};
+    fb_custom_metadata = fbb.CreateVector(key_values);
+  }
   auto message = flatbuf::CreateMessage(fbb, kCurrentMetadataVersion, header_type, header,
-                                        body_length);
+                                        body_length, fb_custom_metadata);
   fbb.Finish(message);
   return WriteFlatbufferBuilder(fbb, out);
 }
@@ -917,12 +924,13 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
 Status WriteRecordBatchMessage(int64_t length, int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
   return WriteFBMessage(fbb, flatbuf::MessageHeader_RecordBatch, record_batch.Union(),
-                        body_length, out);
+                        body_length, out, compression);
 }
 
 Status WriteTensorMessage(const Tensor& tensor, int64_t buffer_start_offset,
@@ -1094,13 +1102,39 @@ Status WriteSparseTensorMessage(const SparseTensor& sparse_tensor, int64_t body_
 Status WriteDictionaryMessage(int64_t id, int64_t length, int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression, bool is_delta,
                               std::shared_ptr<Buffer>* out) {
   FBB fbb;
   RecordBatchOffset record_batch;
   RETURN_NOT_OK(MakeRecordBatch(fbb, length, body_length, nodes, buffers, &record_batch));
-  auto dictionary_batch = flatbuf::CreateDictionaryBatch(fbb, id, record_batch).Union();
+  auto dictionary_batch =
+      flatbuf::CreateDictionaryBatch(fbb, id, record_batch, is_delta).Union();
   return WriteFBMessage(fbb, flatbuf::MessageHeader_DictionaryBatch, dictionary_batch,
-                        body_length, out);
+                        body_length, out, compression);
+}
+
+Status GetBodyCompression(const flatbuf::Message* message, Compression::type* out) {
+  *out = Compression::UNCOMPRESSED;
+  auto fb_metadata = message->custom_metadata();
+  if (fb_metadata == nullptr) {
+    return Status::OK();
+  }
+  std::shared_ptr<KeyValueMetadata> metadata;
+  RETURN_NOT_OK(KeyValueMetadataFromFlatbuffer(fb_metadata, &metadata));
+  const int index = metadata->FindKey(kBodyCompressionKey);
+  if (index == -1) {
+    return Status::OK();
+  }
+  const std::string& name = metadata->value(index);
+  for (auto codec : {Compression::SNAPPY, Compression::GZIP, Compression::BROTLI,
+                     Compression::ZSTD, Compression::LZ4, Compression::LZO,
+                     Compression::BZ2}) {
+    if (name == util::Codec::GetCodecAsString(codec)) {
+      *out = codec;
+      return Status::OK();
+    }
+  }
+  return Status::Invalid("Unrecognized body compression in IPC message: ", name);
 }
 
 static flatbuffers::Offset<flatbuffers::Vector<const flatbuf::Block*>>
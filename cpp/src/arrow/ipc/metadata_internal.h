@@ -34,6 +34,7 @@
 #include "arrow/memory_pool.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/util/compression.h"
 
 #include "generated/Message_generated.h"
 #include "generated/Schema_generated.h"
@@ -62,6 +63,20 @@ namespace internal {
 // This 0xFFFFFFFF value is the first 4 bytes of a valid IPC message
 constexpr int32_t kIpcContinuationToken = -1;
 
+// Framing of an encapsulated IPC message: the prefix (the continuation token
+// unless writing the legacy format, then the flatbuffer size including
+// padding), the flatbuffer, then padding up to the alignment
+struct MessageFraming {
+  uint8_t prefix[8];
+  int32_t prefix_size;
+  // Padding to write after the flatbuffer
+  int32_t padding;
+  // Total length of the message, including the prefix and padding
+  int32_t message_length;
+};
+
+MessageFraming GetMessageFraming(int32_t flatbuffer_size, const IpcOptions& options);
+
 static constexpr flatbuf::MetadataVersion kCurrentMetadataVersion =
     flatbuf::MetadataVersion_V4;
 
@@ -72,6 +87,10 @@ MetadataVersion GetMetadataVersion(flatbuf::MetadataVersion version);
 
 static constexpr const char* kArrowMagicBytes = "ARROW1";
 
+// EXPERIMENTAL: Message custom metadata key naming the codec used to compress
+// the body buffers of a record batch or dictionary batch
+static constexpr const char* kBodyCompressionKey = "ARROW:experimental_compression";
+
 struct FieldMetadata {
   int64_t length;
   int64_t null_count;
@@ -145,6 +164,7 @@ Status WriteSchemaMessage(const Schema& schema, DictionaryMemo* dictionary_memo,
 Status WriteRecordBatchMessage(const int64_t length, const int64_t body_length,
                                const std::vector<FieldMetadata>& nodes,
                                const std::vector<BufferMetadata>& buffers,
+                               Compression::type compression,
                                std::shared_ptr<Buffer>* out);
 
 Status WriteTensorMessage(const Tensor& tensor, const int64_t buffer_start_offset,
@@ -162,8 +182,13 @@ Status WriteDictionaryMessage(const int64_t id, const int64_t length,
                               const int64_t body_length,
                               const std::vector<FieldMetadata>& nodes,
                               const std::vector<BufferMetadata>& buffers,
+                              Compression::type compression, bool is_delta,
                               std::shared_ptr<Buffer>* out);
 
+// Retrieve the codec used to compress the body buffers of a message, or
+// Compression::UNCOMPRESSED
+Status GetBodyCompression(const flatbuf::Message* message, Compression::type* out);
+
 static inline Status WriteFlatbufferBuilder(flatbuffers::FlatBufferBuilder& fbb,
                                             std::shared_ptr<Buffer>* out) {
   int32_t size = fbb.GetSize();
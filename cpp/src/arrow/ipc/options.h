@@ -18,7 +18,10 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
+#include "arrow/memory_pool.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -44,6 +47,25 @@ struct ARROW_EXPORT IpcOptions {
   /// consisting of a 4-byte prefix instead of 8 byte
   bool write_legacy_ipc_format = false;
 
+  /// \brief EXPERIMENTAL: Codec used to compress the body buffers of record
+  /// batch and dictionary batch messages. Buffers that do not get smaller are
+  /// written uncompressed. Readers decompress transparently
+  Compression::type compression = Compression::UNCOMPRESSED;
+  int compression_level = util::kUseDefaultCompressionLevel;
+
+  /// \brief Use the global CPU thread pool to compress or decompress the
+  /// buffers of a record batch in parallel
+  bool use_threads = false;
+
+  /// \brief Pool used to allocate the buffers created when reading, such as
+  /// decompressed body buffers and concatenated delta dictionaries
+  MemoryPool* memory_pool = default_memory_pool();
+
+  /// \brief Top-level schema fields to include when reading record batches.
+  /// Only the buffers of these fields are read; the resulting batch has
+  /// them in schema order. If empty (the default), all fields are read
+  std::vector<int> included_fields;
+
   static IpcOptions Defaults();
 };
 
@@ -22,10 +22,13 @@
 #include <string>
 
 #include "arrow/api.h"
+#include "arrow/io/file.h"
 #include "arrow/io/memory.h"
 #include "arrow/ipc/api.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/io_util.h"
 
 namespace arrow {
 
@@ -101,7 +104,193 @@ static void ReadRecordBatch(benchmark::State& state) {  // NOLINT non-const refe
   state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
 }
 
+// Body compression: throughput against the size of the written body. The
+// first argument selects the codec, the second toggles use_threads
+static const Compression::type kBodyCodecs[] = {
+    Compression::UNCOMPRESSED, Compression::SNAPPY, Compression::LZ4,
+    Compression::ZSTD,         Compression::GZIP,   Compression::BROTLI};
+
+static bool SetCompressionOptions(benchmark::State& state,  // NOLINT non-const reference
+                                  ipc::IpcOptions* options) {
+  options->compression = kBodyCodecs[state.range(0)];
+  options->use_threads = state.range(1) != 0;
+  if (!util::Codec::IsAvailable(options->compression)) {
+    state.SkipWithError("Codec not available");
+    return false;
+  }
+  state.SetLabel(util::Codec::GetCodecAsString(options->compression));
+  return true;
+}
+
+static void WriteRecordBatchCompressed(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // 8MB over 64 columns
+  constexpr int64_t kTotalSize = 1 << 23;
+  auto options = ipc::IpcOptions::Defaults();
+  if (!SetCompressionOptions(state, &options)) {
+    return;
+  }
+  auto record_batch = MakeRecordBatch(kTotalSize, 64);
+
+  int64_t body_length = 0;
+  while (state.KeepRunning()) {
+    std::shared_ptr<io::BufferOutputStream> stream;
+    ABORT_NOT_OK(io::BufferOutputStream::Create(kTotalSize, default_memory_pool(),
+                                                &stream));
+    int32_t metadata_length;
+    if (!ipc::WriteRecordBatch(*record_batch, 0, stream.get(), &metadata_length,
+                               &body_length, options, default_memory_pool())
+             .ok()) {
+      state.SkipWithError("Failed to write!");
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+  state.counters["ratio"] =
+      static_cast<double>(kTotalSize) / static_cast<double>(body_length);
+}
+
+static void ReadRecordBatchCompressed(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // 8MB over 64 columns
+  constexpr int64_t kTotalSize = 1 << 23;
+  auto options = ipc::IpcOptions::Defaults();
+  if (!SetCompressionOptions(state, &options)) {
+    return;
+  }
+  auto record_batch = MakeRecordBatch(kTotalSize, 64);
+
+  std::shared_ptr<io::BufferOutputStream> stream;
+  ABORT_NOT_OK(
+      io::BufferOutputStream::Create(kTotalSize, default_memory_pool(), &stream));
+  int32_t metadata_length;
+  int64_t body_length;
+  if (!ipc::WriteRecordBatch(*record_batch, 0, stream.get(), &metadata_length,
+                             &body_length, options, default_memory_pool())
+           .ok()) {
+    state.SkipWithError("Failed to write!");
+    return;
+  }
+  std::shared_ptr<Buffer> buffer;
+  ABORT_NOT_OK(stream->Finish(&buffer));
+
+  ipc::DictionaryMemo empty_memo;
+  while (state.KeepRunning()) {
+    std::unique_ptr<ipc::Message> message;
+    io::BufferReader reader(buffer);
+    if (!ipc::ReadMessage(&reader, &message).ok()) {
+      state.SkipWithError("Failed to read!");
+      break;
+    }
+    io::BufferReader body(message->body());
+    std::shared_ptr<RecordBatch> result;
+    if (!ipc::ReadRecordBatch(*message->metadata(), record_batch->schema(), &empty_memo,
+                              options, &body, &result)
+             .ok()) {
+      state.SkipWithError("Failed to read!");
+    }
+  }
+  state.SetBytesProcessed(int64_t(state.iterations()) * kTotalSize);
+  state.counters["ratio"] =
+      static_cast<double>(kTotalSize) / static_cast<double>(body_length);
+}
+
+// Streaming many narrow batches to a file, where the per-message overhead
+// (one vectored write per payload) dominates. The arguments are the number
+// of columns and the number of rows per batch
+static void WriteNarrowBatchStream(
+    benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int kNumBatches = 1024;
+  const int64_t num_fields = state.range(0);
+  const int64_t num_rows = state.range(1);
+  const int64_t batch_size = num_fields * num_rows * sizeof(int64_t);
+  auto record_batch = MakeRecordBatch(batch_size, num_fields);
+
+  std::unique_ptr<internal::TemporaryDir> temp_dir;
+  ABORT_NOT_OK(internal::TemporaryDir::Make("ipc-benchmark-", &temp_dir));
+  const std::string path = temp_dir->path().ToString() + "narrow.arrows";
+
+  while (state.KeepRunning()) {
+    std::shared_ptr<io::FileOutputStream> sink;
+    ABORT_NOT_OK(io::FileOutputStream::Open(path, &sink));
+    std::shared_ptr<ipc::RecordBatchWriter> writer;
+    ABORT_NOT_OK(
+        ipc::RecordBatchStreamWriter::Open(sink.get(), record_batch->schema(), &writer));
+    for (int i = 0; i < kNumBatches; ++i) {
+      if (!writer->WriteRecordBatch(*record_batch).ok()) {
+        state.SkipWithError("Failed to write!");
+        break;
+      }
+    }
+    ABORT_NOT_OK(writer->Close());
+    ABORT_NOT_OK(sink->Close());
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * kNumBatches);
+  state.SetBytesProcessed(int64_t(state.iterations()) * kNumBatches * batch_size);
+}
+
+// Reading a whole file made of thousands of small batches into a Table. The
+// first argument selects the body codec, the second toggles use_threads
+static void ReadTableManyBatches(
+    benchmark::State& state) {  // NOLINT non-const reference
+  constexpr int kNumBatches = 4096;
+  // 4KB over 8 columns per batch
+  constexpr int64_t kBatchSize = 1 << 12;
+  auto options = ipc::IpcOptions::Defaults();
+  if (!SetCompressionOptions(state, &options)) {
+    return;
+  }
+  auto record_batch = MakeRecordBatch(kBatchSize, 8);
+
+  std::shared_ptr<io::BufferOutputStream> stream;
+  ABORT_NOT_OK(io::BufferOutputStream::Create(kNumBatches * kBatchSize,
+                                              default_memory_pool(), &stream));
+  auto maybe_writer =
+      ipc::RecordBatchFileWriter::Open(stream.get(), record_batch->schema(), options);
+  ABORT_NOT_OK(maybe_writer.status());
+  auto writer = *maybe_writer;
+  for (int i = 0; i < kNumBatches; ++i) {
+    ABORT_NOT_OK(writer->WriteRecordBatch(*record_batch));
+  }
+  ABORT_NOT_OK(writer->Close());
+  std::shared_ptr<Buffer> buffer;
+  ABORT_NOT_OK(stream->Finish(&buffer));
+
+  const bool use_threads = state.range(1) != 0;
+  while (state.KeepRunning()) {
+    io::BufferReader source(buffer);
+    std::shared_ptr<ipc::RecordBatchFileReader> reader;
+    std::shared_ptr<Table> table;
+    if (!ipc::RecordBatchFileReader::Open(&source, &reader).ok() ||
+        !reader->ReadTable(use_threads, &table).ok()) {
+      state.SkipWithError("Failed to read!");
+      break;
+    }
+  }
+  state.SetItemsProcessed(int64_t(state.iterations()) * kNumBatches);
+  state.SetBytesProcessed(int64_t(state.iterations()) * kNumBatches * kBatchSize);
+}
+
+static void CompressionArgs(benchmark::internal::Benchmark* bench) {
+  for (int codec = 0; codec < 6; ++codec) {
+    for (int use_threads : {0, 1}) {
+      bench->Args({codec, use_threads});
+    }
+  }
+}
+
+static void NarrowBatchArgs(benchmark::internal::Benchmark* bench) {
+  for (int num_fields : {1, 4, 16}) {
+    for (int num_rows : {8, 64, 512}) {
+      bench->Args({num_fields, num_rows});
+    }
+  }
+}
+
 BENCHMARK(WriteRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
 BENCHMARK(ReadRecordBatch)->RangeMultiplier(4)->Range(1, 1 << 13)->UseRealTime();
+BENCHMARK(WriteRecordBatchCompressed)->Apply(CompressionArgs)->UseRealTime();
+BENCHMARK(ReadRecordBatchCompressed)->Apply(CompressionArgs)->UseRealTime();
+BENCHMARK(ReadTableManyBatches)->Apply(CompressionArgs)->UseRealTime();
+BENCHMARK(WriteNarrowBatchStream)->Apply(NarrowBatchArgs)->UseRealTime();
 
 }  // namespace arrow
@@ -15,6 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
 #include <algorithm>
 #include <cstdint>
 #include <limits>
@@ -30,6 +35,7 @@
 #include "arrow/builder.h"
 #include "arrow/io/file.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/shared_memory.h"
 #include "arrow/io/test_common.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
@@ -40,6 +46,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
@@ -47,7 +54,10 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/key_value_metadata.h"
+#include "arrow/util/thread_pool.h"
 
 #include "generated/Message_generated.h"  // IWYU pragma: keep
 
@@ -693,6 +703,7 @@ TEST_F(RecursionLimits, StressLimit) {
 struct FileWriterHelper {
   Status Init(const std::shared_ptr<Schema>& schema, const IpcOptions& options) {
     num_batches_written_ = 0;
+    options_ = options;
 
     RETURN_NOT_OK(AllocateResizableBuffer(0, &buffer_));
     sink_.reset(new io::BufferOutputStream(buffer_));
@@ -717,7 +728,8 @@ struct FileWriterHelper {
   Status ReadBatches(BatchVector* out_batches) {
     auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
     std::shared_ptr<RecordBatchFileReader> reader;
-    RETURN_NOT_OK(RecordBatchFileReader::Open(buf_reader.get(), footer_offset_, &reader));
+    RETURN_NOT_OK(
+        RecordBatchFileReader::Open(buf_reader.get(), footer_offset_, options_, &reader));
 
     EXPECT_EQ(num_batches_written_, reader->num_record_batches());
     for (int i = 0; i < num_batches_written_; ++i) {
@@ -734,10 +746,12 @@ struct FileWriterHelper {
   std::shared_ptr<RecordBatchWriter> writer_;
   int num_batches_written_;
   int64_t footer_offset_;
+  IpcOptions options_;
 };
 
 struct StreamWriterHelper {
   Status Init(const std::shared_ptr<Schema>& schema, const IpcOptions& options) {
+    options_ = options;
     RETURN_NOT_OK(AllocateResizableBuffer(0, &buffer_));
     sink_.reset(new io::BufferOutputStream(buffer_));
     ARROW_ASSIGN_OR_RAISE(writer_,
@@ -758,13 +772,15 @@ struct StreamWriterHelper {
   Status ReadBatches(BatchVector* out_batches) {
     auto buf_reader = std::make_shared<io::BufferReader>(buffer_);
     std::shared_ptr<RecordBatchReader> reader;
-    RETURN_NOT_OK(RecordBatchStreamReader::Open(buf_reader, &reader));
+    RETURN_NOT_OK(RecordBatchStreamReader::Open(MessageReader::Open(buf_reader),
+                                                options_, &reader));
     return reader->ReadAll(out_batches);
   }
 
   std::shared_ptr<ResizableBuffer> buffer_;
   std::unique_ptr<io::BufferOutputStream> sink_;
   std::shared_ptr<RecordBatchWriter> writer_;
+  IpcOptions options_;
 };
 
 // Parameterized mixin with tests for RecordBatchStreamWriter / RecordBatchFileWriter
@@ -815,13 +831,14 @@ class ReaderWriterMixin {
     }
   }
 
-  void TestDictionaryRoundtrip() {
+  void TestDictionaryRoundtrip(const IpcOptions& options = IpcOptions::Defaults()) {
     std::shared_ptr<RecordBatch> batch;
     ASSERT_OK(MakeDictionary(&batch));
 
     BatchVector out_batches;
-    ASSERT_OK(RoundTripHelper({batch}, IpcOptions::Defaults(), &out_batches));
+    ASSERT_OK(RoundTripHelper({batch}, options, &out_batches));
     ASSERT_EQ(out_batches.size(), 1);
+    CompareBatch(*batch, *out_batches[0]);
 
     // TODO(wesm): This was broken in ARROW-3144. I'm not sure how to
     // restore the deduplication logic yet because dictionaries are
@@ -831,6 +848,67 @@ class ReaderWriterMixin {
     // CheckDictionariesDeduplicated(*out_batches[0]);
   }
 
+  void TestDictionaryDeltas() {
+    // Each batch appends values to the dictionary of the previous one
+    auto type = dictionary(int8(), utf8());
+    auto schema = ::arrow::schema({field("f0", type)});
+    auto dict0 = ArrayFromJSON(utf8(), R"(["foo", "bar"])");
+    auto dict1 = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz"])");
+    auto dict2 = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz", "quux", "zap"])");
+
+    BatchVector in_batches;
+    for (const auto& pair :
+         std::vector<std::pair<std::shared_ptr<Array>, std::string>>{
+             {dict0, "[0, 1, null, 1]"}, {dict1, "[2, 0]"}, {dict1, "[1, 2, 2]"},
+             {dict2, "[4, null, 3, 0]"}}) {
+      std::shared_ptr<Array> array;
+      ASSERT_OK(DictionaryArray::FromArrays(type, ArrayFromJSON(int8(), pair.second),
+                                            pair.first, &array));
+      in_batches.push_back(RecordBatch::Make(schema, array->length(), {array}));
+    }
+
+    // Concatenated dictionaries are allocated from the reader's pool
+    ProxyMemoryPool pool(default_memory_pool());
+    auto options = IpcOptions::Defaults();
+    options.memory_pool = &pool;
+
+    BatchVector out_batches;
+    ASSERT_OK(RoundTripHelper(in_batches, options, &out_batches));
+    ASSERT_EQ(out_batches.size(), in_batches.size());
+    ASSERT_GT(pool.bytes_allocated(), 0);
+
+    for (size_t i = 0; i < in_batches.size(); ++i) {
+      const auto& expected =
+          checked_cast<const DictionaryArray&>(*in_batches[i]->column(0));
+      const auto& actual =
+          checked_cast<const DictionaryArray&>(*out_batches[i]->column(0));
+      AssertArraysEqual(*expected.indices(), *actual.indices());
+      // Readers of the file format apply all deltas up front, so the
+      // dictionary read back may extend the one written
+      const int64_t length = expected.dictionary()->length();
+      ASSERT_GE(actual.dictionary()->length(), length);
+      ASSERT_TRUE(actual.dictionary()->RangeEquals(0, length, 0, *expected.dictionary()));
+    }
+  }
+
+  void TestDictionaryReplacement() {
+    auto type = dictionary(int8(), utf8());
+    auto schema = ::arrow::schema({field("f0", type)});
+    auto indices = ArrayFromJSON(int8(), "[0, 1]");
+
+    std::shared_ptr<Array> array0, array1;
+    ASSERT_OK(DictionaryArray::FromArrays(
+        type, indices, ArrayFromJSON(utf8(), R"(["foo", "bar"])"), &array0));
+    ASSERT_OK(DictionaryArray::FromArrays(
+        type, indices, ArrayFromJSON(utf8(), R"(["bar", "foo", "baz"])"), &array1));
+
+    WriterHelper writer_helper;
+    ASSERT_OK(writer_helper.Init(schema, IpcOptions::Defaults()));
+    ASSERT_OK(writer_helper.WriteBatch(RecordBatch::Make(schema, 2, {array0})));
+    ASSERT_RAISES(Invalid,
+                  writer_helper.WriteBatch(RecordBatch::Make(schema, 2, {array1})));
+  }
+
   void TestWriteDifferentSchema() {
     // Test writing batches with a different schema than the RecordBatchWriter
     // was initialized with.
@@ -917,6 +995,212 @@ TEST_P(TestStreamFormat, RoundTrip) {
   TestZeroLengthRoundTrip(*GetParam(), options);
 }
 
+// Codecs supporting one-shot compression, as used for IPC body buffers
+std::vector<Compression::type> AvailableBodyCodecs() {
+  std::vector<Compression::type> codecs;
+  for (auto codec : {Compression::SNAPPY, Compression::GZIP, Compression::BROTLI,
+                     Compression::ZSTD, Compression::LZ4}) {
+    if (util::Codec::IsAvailable(codec)) {
+      codecs.push_back(codec);
+    }
+  }
+  return codecs;
+}
+
+TEST_P(TestFileFormat, RoundTripCompressed) {
+  for (auto codec : AvailableBodyCodecs()) {
+    SCOPED_TRACE(util::Codec::GetCodecAsString(codec));
+    IpcOptions options;
+    options.compression = codec;
+    TestRoundTrip(*GetParam(), options);
+    TestZeroLengthRoundTrip(*GetParam(), options);
+
+    options.use_threads = true;
+    TestRoundTrip(*GetParam(), options);
+  }
+}
+
+TEST_P(TestStreamFormat, RoundTripCompressed) {
+  for (auto codec : AvailableBodyCodecs()) {
+    SCOPED_TRACE(util::Codec::GetCodecAsString(codec));
+    IpcOptions options;
+    options.compression = codec;
+    TestRoundTrip(*GetParam(), options);
+    TestZeroLengthRoundTrip(*GetParam(), options);
+
+    options.use_threads = true;
+    TestRoundTrip(*GetParam(), options);
+  }
+}
+
+TEST(TestCompressedRecordBatch, ReadOptions) {
+  auto codecs = AvailableBodyCodecs();
+  if (codecs.empty()) {
+    // No codec available for IPC body buffers
+    return;
+  }
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntBatchSized(1000, &batch));
+
+  IpcOptions options;
+  options.compression = codecs[0];
+  options.use_threads = true;
+  std::shared_ptr<io::BufferOutputStream> stream;
+  ASSERT_OK(io::BufferOutputStream::Create(1 << 10, default_memory_pool(), &stream));
+  int32_t metadata_length;
+  int64_t body_length;
+  ASSERT_OK(WriteRecordBatch(*batch, 0, stream.get(), &metadata_length, &body_length,
+                             options, default_memory_pool()));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK(stream->Finish(&buffer));
+
+  auto read_batch = [&](const IpcOptions& read_options,
+                        std::shared_ptr<RecordBatch>* out) -> Status {
+    io::BufferReader buffer_reader(buffer);
+    std::unique_ptr<Message> message;
+    RETURN_NOT_OK(ReadMessage(&buffer_reader, &message));
+    io::BufferReader body_reader(message->body());
+    DictionaryMemo dictionary_memo;
+    return ReadRecordBatch(*message->metadata(), batch->schema(), &dictionary_memo,
+                           read_options, &body_reader, out);
+  };
+
+  // Decompressed buffers are allocated from the given pool
+  ProxyMemoryPool pool(default_memory_pool());
+  options.memory_pool = &pool;
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(read_batch(options, &result));
+  AssertBatchesEqual(*batch, *result);
+  ASSERT_GT(pool.bytes_allocated(), 0);
+  result.reset();
+  ASSERT_EQ(0, pool.bytes_allocated());
+
+  // Reading from the only thread of the CPU pool doesn't deadlock
+  const int cpu_capacity = GetCpuThreadPoolCapacity();
+  ASSERT_OK(SetCpuThreadPoolCapacity(1));
+  auto fut = ::arrow::internal::GetCpuThreadPool()->Submit(
+      [&]() { return read_batch(options, &result); });
+  ASSERT_OK(fut.get());
+  AssertBatchesEqual(*batch, *result);
+  ASSERT_OK(SetCpuThreadPoolCapacity(cpu_capacity));
+}
+
+TEST_P(TestFileFormat, ReadFieldSubset) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcOptions::Defaults()));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.Finish());
+
+  auto buf_reader = std::make_shared<io::BufferReader>(helper.buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(
+      RecordBatchFileReader::Open(buf_reader.get(), helper.footer_offset_, &reader));
+
+  const int num_fields = batch->num_columns();
+  for (int i = 0; i < num_fields; ++i) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->ReadRecordBatch(0, {i}, &result));
+    ASSERT_OK(result->Validate());
+    ASSERT_EQ(1, result->num_columns());
+    ASSERT_EQ(batch->num_rows(), result->num_rows());
+    ASSERT_TRUE(result->schema()->field(0)->Equals(batch->schema()->field(i)));
+    AssertArraysEqual(*batch->column(i), *result->column(0));
+  }
+
+  // Fields come back in schema order, and repeated reads of the same batch
+  // reuse its metadata
+  std::vector<int> indices = {num_fields - 1, 0};
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->ReadRecordBatch(0, indices, &result));
+    ASSERT_EQ(num_fields > 1 ? 2 : 1, result->num_columns());
+    AssertArraysEqual(*batch->column(0), *result->column(0));
+    AssertArraysEqual(*batch->column(num_fields - 1),
+                      *result->column(result->num_columns() - 1));
+  }
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_RAISES(Invalid, reader->ReadRecordBatch(0, {num_fields}, &result));
+}
+
+TEST_P(TestFileFormat, ReadTable) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK((*GetParam())(&batch));  // NOLINT clang-tidy gtest issue
+
+  // More batches than are allowed in flight at once
+  const int num_batches = 50;
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcOptions::Defaults()));
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  for (int i = 0; i < num_batches; ++i) {
+    auto slice = batch->Slice(std::min<int64_t>(i % 3, batch->num_rows()));
+    batches.push_back(slice);
+    ASSERT_OK(helper.WriteBatch(slice));
+  }
+  ASSERT_OK(helper.Finish());
+
+  std::shared_ptr<Table> expected;
+  ASSERT_OK(Table::FromRecordBatches(batch->schema(), batches, &expected));
+
+  for (bool use_threads : {false, true}) {
+    auto buf_reader = std::make_shared<io::BufferReader>(helper.buffer_);
+    std::shared_ptr<RecordBatchFileReader> reader;
+    ASSERT_OK(
+        RecordBatchFileReader::Open(buf_reader.get(), helper.footer_offset_, &reader));
+
+    std::shared_ptr<Table> table;
+    ASSERT_OK(reader->ReadTable(use_threads, &table));
+    ASSERT_OK(table->Validate());
+    AssertTablesEqual(*expected, *table);
+  }
+
+  // Reading from the only thread of the CPU pool doesn't deadlock
+  struct RestoreCapacity {
+    ~RestoreCapacity() { ARROW_EXPECT_OK(SetCpuThreadPoolCapacity(capacity)); }
+    int capacity;
+  } restore_capacity{GetCpuThreadPoolCapacity()};
+  ASSERT_OK(SetCpuThreadPoolCapacity(1));
+  auto buf_reader = std::make_shared<io::BufferReader>(helper.buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(
+      RecordBatchFileReader::Open(buf_reader.get(), helper.footer_offset_, &reader));
+  std::shared_ptr<Table> table;
+  auto fut = ::arrow::internal::GetCpuThreadPool()->Submit(
+      [&]() { return reader->ReadTable(true, &table); });
+  ASSERT_OK(fut.get());
+  AssertTablesEqual(*expected, *table);
+}
+
+TEST_F(TestFileFormat, ReadFieldSubsetZeroCopy) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcOptions::Defaults()));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.Finish());
+
+  // BufferReader, like MemoryMappedFile, hands out slices of its memory
+  auto buf_reader = std::make_shared<io::BufferReader>(helper.buffer_);
+  std::shared_ptr<RecordBatchFileReader> reader;
+  ASSERT_OK(
+      RecordBatchFileReader::Open(buf_reader.get(), helper.footer_offset_, &reader));
+
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->ReadRecordBatch(0, {1}, &result));
+  const uint8_t* begin = helper.buffer_->data();
+  const uint8_t* end = begin + helper.buffer_->size();
+  for (const auto& buffer : result->column_data(0)->buffers) {
+    if (buffer != nullptr && buffer->size() > 0) {
+      ASSERT_GE(buffer->data(), begin);
+      ASSERT_LE(buffer->data() + buffer->size(), end);
+    }
+  }
+}
+
 INSTANTIATE_TEST_CASE_P(GenericIpcRoundTripTests, TestIpcRoundTrip, BATCH_CASES());
 INSTANTIATE_TEST_CASE_P(FileRoundTripTests, TestFileFormat, BATCH_CASES());
 INSTANTIATE_TEST_CASE_P(StreamRoundTripTests, TestStreamFormat, BATCH_CASES());
@@ -958,6 +1242,53 @@ TEST_F(TestStreamFormat, DictionaryRoundTrip) { TestDictionaryRoundtrip(); }
 
 TEST_F(TestFileFormat, DictionaryRoundTrip) { TestDictionaryRoundtrip(); }
 
+TEST_F(TestStreamFormat, DictionaryDeltas) { TestDictionaryDeltas(); }
+
+TEST_F(TestFileFormat, DictionaryDeltas) { TestDictionaryDeltas(); }
+
+TEST_F(TestStreamFormat, DictionaryReplacement) { TestDictionaryReplacement(); }
+
+TEST_F(TestFileFormat, DictionaryReplacement) { TestDictionaryReplacement(); }
+
+TEST_F(TestStreamFormat, DictionaryRoundTripCompressed) {
+  for (auto codec : AvailableBodyCodecs()) {
+    SCOPED_TRACE(util::Codec::GetCodecAsString(codec));
+    IpcOptions options;
+    options.compression = codec;
+    TestDictionaryRoundtrip(options);
+  }
+}
+
+TEST_F(TestFileFormat, DictionaryRoundTripCompressed) {
+  for (auto codec : AvailableBodyCodecs()) {
+    SCOPED_TRACE(util::Codec::GetCodecAsString(codec));
+    IpcOptions options;
+    options.compression = codec;
+    TestDictionaryRoundtrip(options);
+  }
+}
+
+TEST_F(TestWriteRecordBatch, CompressedBodyIsSmaller) {
+  // Highly repetitive values compress well
+  std::vector<int64_t> values(1 << 14, 42);
+  std::shared_ptr<Array> array;
+  ArrayFromVector<Int64Type, int64_t>(values, &array);
+  auto batch = RecordBatch::Make(schema({field("f0", int64())}), values.size(), {array});
+
+  for (auto codec : AvailableBodyCodecs()) {
+    SCOPED_TRACE(util::Codec::GetCodecAsString(codec));
+    IpcOptions options;
+    options.compression = codec;
+
+    internal::IpcPayload plain, compressed;
+    ASSERT_OK(internal::GetRecordBatchPayload(*batch, IpcOptions::Defaults(),
+                                              default_memory_pool(), &plain));
+    ASSERT_OK(internal::GetRecordBatchPayload(*batch, options, default_memory_pool(),
+                                              &compressed));
+    ASSERT_LT(compressed.body_length, plain.body_length);
+  }
+}
+
 TEST_F(TestStreamFormat, DifferentSchema) { TestWriteDifferentSchema(); }
 
 TEST_F(TestFileFormat, DifferentSchema) { TestWriteDifferentSchema(); }
@@ -1429,6 +1760,56 @@ TEST(TestDictionaryMemo, ReusedDictionaries) {
   ASSERT_EQ(0, returned_id);
 }
 
+#ifndef _WIN32
+TEST(TestSharedMemoryStream, AcrossProcesses) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+  const int num_batches = 100;
+
+  std::unique_ptr<::arrow::internal::TemporaryDir> temp_dir;
+  ASSERT_OK(::arrow::internal::TemporaryDir::Make("ipc-shared-ring-", &temp_dir));
+  const std::string path = temp_dir->path().ToString() + "ring";
+  // Smaller than the stream, so that the ring wraps around
+  std::shared_ptr<io::SharedRingBuffer> ring;
+  ASSERT_OK(io::SharedRingBuffer::Create(path, 1 << 16, &ring));
+
+  pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0) {
+    std::shared_ptr<io::SharedRingBuffer> child_ring;
+    bool ok = io::SharedRingBuffer::Open(path, &child_ring).ok();
+    if (ok) {
+      io::SharedRingBufferOutputStream sink(child_ring);
+      std::shared_ptr<RecordBatchWriter> writer;
+      ok = RecordBatchStreamWriter::Open(&sink, batch->schema(), &writer).ok();
+      for (int i = 0; ok && i < num_batches; ++i) {
+        ok = writer->WriteRecordBatch(*batch).ok();
+      }
+      ok = ok && writer->Close().ok() && sink.Close().ok();
+    }
+    _exit(ok ? 0 : 1);
+  }
+
+  auto source = std::make_shared<io::SharedRingBufferInputStream>(ring);
+  std::shared_ptr<RecordBatchReader> reader;
+  ASSERT_OK(RecordBatchStreamReader::Open(source, &reader));
+  for (int i = 0; i < num_batches; ++i) {
+    std::shared_ptr<RecordBatch> result;
+    ASSERT_OK(reader->ReadNext(&result));
+    ASSERT_NE(nullptr, result);
+    CompareBatch(*batch, *result);
+  }
+  std::shared_ptr<RecordBatch> result;
+  ASSERT_OK(reader->ReadNext(&result));
+  ASSERT_EQ(nullptr, result);
+
+  int status;
+  ASSERT_EQ(pid, waitpid(pid, &status, 0));
+  ASSERT_TRUE(WIFEXITED(status));
+  ASSERT_EQ(0, WEXITSTATUS(status));
+}
+#endif
+
 }  // namespace test
 }  // namespace ipc
 }  // namespace arrow
@@ -17,8 +17,11 @@
 
 #include "arrow/ipc/reader.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <sstream>
 #include <string>
 #include <type_traits>
@@ -34,13 +37,18 @@
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
 #include "arrow/ipc/metadata_internal.h"
+#include "arrow/memory_pool.h"
 #include "arrow/record_batch.h"
 #include "arrow/sparse_tensor.h"
 #include "arrow/status.h"
+#include "arrow/table.h"
 #include "arrow/tensor.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 #include "generated/File_generated.h"  // IWYU pragma: export
@@ -96,8 +104,9 @@ Status InvalidMessageType(Message::Type expected, Message::Type actual) {
 /// Accessor class for flatbuffers metadata
 class IpcComponentSource {
  public:
-  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file)
-      : metadata_(metadata), file_(file) {}
+  IpcComponentSource(const flatbuf::RecordBatch* metadata, io::RandomAccessFile* file,
+                     int64_t body_offset = 0)
+      : metadata_(metadata), file_(file), body_offset_(body_offset) {}
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
     auto buffers = metadata_->buffers();
@@ -120,7 +129,7 @@ class IpcComponentSource {
             "Buffer ", buffer_index,
             " did not start on 8-byte aligned offset: ", buffer->offset());
       }
-      return file_->ReadAt(buffer->offset(), buffer->length(), out);
+      return file_->ReadAt(body_offset_ + buffer->offset(), buffer->length(), out);
     }
   }
 
@@ -144,6 +153,8 @@ class IpcComponentSource {
  private:
   const flatbuf::RecordBatch* metadata_;
   io::RandomAccessFile* file_;
+  // Position of the message body in file_
+  int64_t body_offset_;
 };
 
 /// Bookkeeping struct for loading array objects from their constituent pieces of raw data
@@ -157,6 +168,9 @@ struct ArrayLoaderContext {
   int buffer_index;
   int field_index;
   int max_recursion_depth;
+  // If true, buffers are skipped rather than read (for fields that are
+  // not projected)
+  bool skip_io;
 };
 
 static Status LoadArray(const Field& field, ArrayLoaderContext* context, ArrayData* out);
@@ -177,6 +191,10 @@ class ArrayLoader {
   }
 
   Status GetBuffer(int buffer_index, std::shared_ptr<Buffer>* out) {
+    if (context_->skip_io) {
+      out->reset();
+      return Status::OK();
+    }
     return context_->source->GetBuffer(buffer_index, out);
   }
 
@@ -373,24 +391,132 @@ Status ReadRecordBatch(const Message& message, const std::shared_ptr<Schema>& sc
 // Array loading
 
 static Status LoadRecordBatchFromSource(const std::shared_ptr<Schema>& schema,
-                                        int64_t num_rows, int max_recursion_depth,
+                                        int64_t num_rows,
+                                        const std::vector<int>& included_fields,
+                                        int max_recursion_depth,
                                         IpcComponentSource* source,
                                         const DictionaryMemo* dictionary_memo,
                                         std::shared_ptr<RecordBatch>* out) {
-  ArrayLoaderContext context{source, dictionary_memo, /*field_index=*/0,
-                             /*buffer_index=*/0, max_recursion_depth};
+  ArrayLoaderContext context{source,
+                             dictionary_memo,
+                             /*buffer_index=*/0,
+                             /*field_index=*/0,
+                             max_recursion_depth,
+                             /*skip_io=*/false};
+
+  std::vector<bool> inclusion_mask(schema->num_fields(), included_fields.empty());
+  for (int i : included_fields) {
+    if (i < 0 || i >= schema->num_fields()) {
+      return Status::Invalid("Out of bounds field index: ", i);
+    }
+    inclusion_mask[i] = true;
+  }
 
-  std::vector<std::shared_ptr<ArrayData>> arrays(schema->num_fields());
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ArrayData>> arrays;
   for (int i = 0; i < schema->num_fields(); ++i) {
+    // Excluded fields are still walked to advance the node and buffer
+    // indices, but none of their buffers are touched
+    context.skip_io = !inclusion_mask[i];
     auto arr = std::make_shared<ArrayData>();
     RETURN_NOT_OK(LoadArray(*schema->field(i), &context, arr.get()));
     if (num_rows != arr->length) {
       return Status::IOError("Array length did not match record batch length");
     }
-    arrays[i] = std::move(arr);
+    if (inclusion_mask[i]) {
+      fields.push_back(schema->field(i));
+      arrays.push_back(std::move(arr));
+    }
   }
 
-  *out = RecordBatch::Make(schema, num_rows, std::move(arrays));
+  auto out_schema = included_fields.empty()
+                        ? schema
+                        : ::arrow::schema(std::move(fields), schema->metadata());
+  *out = RecordBatch::Make(std::move(out_schema), num_rows, std::move(arrays));
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Body buffer decompression
+
+// Inverse of the writer's buffer compression: an int64 little-endian
+// uncompressed length (-1 if stored raw) followed by the payload
+static Status DecompressBuffer(Compression::type compression, MemoryPool* pool,
+                               std::shared_ptr<Buffer>* buffer) {
+  const int64_t size = (*buffer)->size();
+  if (size < static_cast<int64_t>(sizeof(int64_t))) {
+    return Status::IOError("Compressed IPC buffer is too short: ", size, " bytes");
+  }
+  int64_t raw_size;
+  std::memcpy(&raw_size, (*buffer)->data(), sizeof(int64_t));
+  raw_size = BitUtil::FromLittleEndian(raw_size);
+
+  const int64_t payload_size = size - sizeof(int64_t);
+  if (raw_size == -1) {
+    *buffer = SliceBuffer(*buffer, sizeof(int64_t), payload_size);
+    return Status::OK();
+  }
+  if (raw_size < 0) {
+    return Status::IOError("Invalid uncompressed length in IPC buffer: ", raw_size);
+  }
+
+  // Codecs may keep stream state, so each task uses its own instance
+  std::unique_ptr<util::Codec> codec;
+  RETURN_NOT_OK(util::Codec::Create(compression, &codec));
+
+  std::shared_ptr<Buffer> result;
+  RETURN_NOT_OK(AllocateBuffer(pool, raw_size, &result));
+  int64_t actual_size = 0;
+  RETURN_NOT_OK(codec->Decompress(payload_size, (*buffer)->data() + sizeof(int64_t),
+                                  raw_size, result->mutable_data(), &actual_size));
+  if (actual_size != raw_size) {
+    return Status::IOError("Decompressed IPC buffer has ", actual_size,
+                           " bytes, expected ", raw_size);
+  }
+  *buffer = result;
+  return Status::OK();
+}
+
+// Collect the body buffers loaded for an array, depth-first. Dictionaries
+// come from the DictionaryMemo already decoded and are left alone
+static void CollectBodyBuffers(ArrayData* data,
+                               std::vector<std::shared_ptr<Buffer>*>* out) {
+  for (auto& buffer : data->buffers) {
+    if (buffer != nullptr && buffer->size() > 0) {
+      out->push_back(&buffer);
+    }
+  }
+  for (auto& child : data->child_data) {
+    CollectBodyBuffers(child.get(), out);
+  }
+}
+
+static Status DecompressBodyBuffers(
+    Compression::type compression, const IpcOptions& options,
+    const std::vector<std::shared_ptr<ArrayData>>& arrays) {
+  std::vector<std::shared_ptr<Buffer>*> buffers;
+  for (const auto& array : arrays) {
+    CollectBodyBuffers(array.get(), &buffers);
+  }
+
+  auto DecompressOne = [&](int i) -> Status {
+    return DecompressBuffer(compression, options.memory_pool, buffers[i]);
+  };
+
+  const int num_buffers = static_cast<int>(buffers.size());
+  if (options.use_threads && num_buffers > 1) {
+    // The calling thread runs pending tasks while finishing the group, so
+    // this doesn't deadlock when reading from a task of the CPU thread pool
+    auto task_group =
+        ::arrow::internal::TaskGroup::MakeThreaded(::arrow::internal::GetCpuThreadPool());
+    for (int i = 0; i < num_buffers; ++i) {
+      task_group->Append([&, i]() { return DecompressOne(i); });
+    }
+    return task_group->Finish();
+  }
+  for (int i = 0; i < num_buffers; ++i) {
+    RETURN_NOT_OK(DecompressOne(i));
+  }
   return Status::OK();
 }
 
@@ -398,17 +524,33 @@ static inline Status ReadRecordBatch(const flatbuf::RecordBatch* metadata,
                                      const std::shared_ptr<Schema>& schema,
                                      const DictionaryMemo* dictionary_memo,
                                      const IpcOptions& options,
-                                     io::RandomAccessFile* file,
+                                     Compression::type compression,
+                                     io::RandomAccessFile* file, int64_t body_offset,
                                      std::shared_ptr<RecordBatch>* out) {
-  IpcComponentSource source(metadata, file);
-  return LoadRecordBatchFromSource(schema, metadata->length(),
-                                   options.max_recursion_depth, &source, dictionary_memo,
-                                   out);
+  IpcComponentSource source(metadata, file, body_offset);
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(LoadRecordBatchFromSource(schema, metadata->length(),
+                                          options.included_fields,
+                                          options.max_recursion_depth, &source,
+                                          dictionary_memo, &batch));
+  if (compression != Compression::UNCOMPRESSED) {
+    std::vector<std::shared_ptr<ArrayData>> arrays(batch->num_columns());
+    for (int i = 0; i < batch->num_columns(); ++i) {
+      arrays[i] = batch->column_data(i);
+    }
+    RETURN_NOT_OK(DecompressBodyBuffers(compression, options, arrays));
+    batch = RecordBatch::Make(batch->schema(), batch->num_rows(), std::move(arrays));
+  }
+  *out = std::move(batch);
+  return Status::OK();
 }
 
-Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
-                       const DictionaryMemo* dictionary_memo, const IpcOptions& options,
-                       io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out) {
+// Read a record batch whose body starts at body_offset in file
+static Status ReadRecordBatchAt(const Buffer& metadata,
+                                const std::shared_ptr<Schema>& schema,
+                                const DictionaryMemo* dictionary_memo,
+                                const IpcOptions& options, io::RandomAccessFile* file,
+                                int64_t body_offset, std::shared_ptr<RecordBatch>* out) {
   const flatbuf::Message* message;
   RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
   auto batch = message->header_as_RecordBatch();
@@ -416,13 +558,21 @@ Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& sc
     return Status::IOError(
         "Header-type of flatbuffer-encoded Message is not RecordBatch.");
   }
-  return ReadRecordBatch(batch, schema, dictionary_memo, options, file, out);
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetBodyCompression(message, &compression));
+  return ReadRecordBatch(batch, schema, dictionary_memo, options, compression, file,
+                         body_offset, out);
 }
 
-Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
-                      io::RandomAccessFile* file) {
-  auto options = IpcOptions::Defaults();
+Status ReadRecordBatch(const Buffer& metadata, const std::shared_ptr<Schema>& schema,
+                       const DictionaryMemo* dictionary_memo, const IpcOptions& options,
+                       io::RandomAccessFile* file, std::shared_ptr<RecordBatch>* out) {
+  return ReadRecordBatchAt(metadata, schema, dictionary_memo, options, file,
+                           /*body_offset=*/0, out);
+}
 
+Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
+                      const IpcOptions& options, io::RandomAccessFile* file) {
   const flatbuf::Message* message;
   RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
   auto dictionary_batch = message->header_as_DictionaryBatch();
@@ -432,6 +582,8 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
   }
 
   int64_t id = dictionary_batch->id();
+  Compression::type compression;
+  RETURN_NOT_OK(internal::GetBodyCompression(message, &compression));
 
   // Look up the field, which must have been added to the
   // DictionaryMemo already prior to invoking this function
@@ -444,11 +596,15 @@ Status ReadDictionary(const Buffer& metadata, DictionaryMemo* dictionary_memo,
   std::shared_ptr<RecordBatch> batch;
   auto batch_meta = dictionary_batch->data();
   RETURN_NOT_OK(ReadRecordBatch(batch_meta, ::arrow::schema({value_field}),
-                                dictionary_memo, options, file, &batch));
+                                dictionary_memo, options, compression, file,
+                                /*body_offset=*/0, &batch));
   if (batch->num_columns() != 1) {
     return Status::Invalid("Dictionary record batch must only contain one field");
   }
   auto dictionary = batch->column(0);
+  if (dictionary_batch->isDelta()) {
+    return dictionary_memo->AddDictionaryDelta(id, dictionary, options.memory_pool);
+  }
   return dictionary_memo->AddDictionary(id, dictionary);
 }
 
@@ -464,8 +620,9 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
   RecordBatchStreamReaderImpl() {}
   ~RecordBatchStreamReaderImpl() {}
 
-  Status Open(std::unique_ptr<MessageReader> message_reader) {
+  Status Open(std::unique_ptr<MessageReader> message_reader, const IpcOptions& options) {
     message_reader_ = std::move(message_reader);
+    options_ = options;
     return ReadSchema();
   }
 
@@ -488,7 +645,7 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     DCHECK_EQ(message.type(), Message::DICTIONARY_BATCH);
     CHECK_HAS_BODY(message);
     io::BufferReader reader(message.body());
-    return ReadDictionary(*message.metadata(), &dictionary_memo_, &reader);
+    return ReadDictionary(*message.metadata(), &dictionary_memo_, options_, &reader);
   }
 
   Status ReadInitialDictionaries() {
@@ -542,28 +699,32 @@ class RecordBatchStreamReader::RecordBatchStreamReaderImpl {
     }
 
     std::unique_ptr<Message> message;
-    RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
-    if (message == nullptr) {
-      // End of stream
-      *batch = nullptr;
-      return Status::OK();
+    while (true) {
+      RETURN_NOT_OK(message_reader_->ReadNextMessage(&message));
+      if (message == nullptr) {
+        // End of stream
+        *batch = nullptr;
+        return Status::OK();
+      }
+      if (message->type() != Message::DICTIONARY_BATCH) {
+        break;
+      }
+      // Delta dictionary batches extend the dictionaries in the memo before
+      // the record batches that reference the new values
+      RETURN_NOT_OK(ParseDictionary(*message));
     }
 
-    if (message->type() == Message::DICTIONARY_BATCH) {
-      // TODO(wesm): implement delta dictionaries
-      return Status::NotImplemented("Delta dictionaries not yet implemented");
-    } else {
-      CHECK_HAS_BODY(*message);
-      io::BufferReader reader(message->body());
-      return ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_, &reader,
-                             batch);
-    }
+    CHECK_HAS_BODY(*message);
+    io::BufferReader reader(message->body());
+    return ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_, options_,
+                           &reader, batch);
   }
 
   std::shared_ptr<Schema> schema() const { return schema_; }
 
  private:
   std::unique_ptr<MessageReader> message_reader_;
+  IpcOptions options_;
 
   bool read_initial_dictionaries_ = false;
 
@@ -583,9 +744,15 @@ RecordBatchStreamReader::~RecordBatchStreamReader() {}
 
 Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
                                      std::shared_ptr<RecordBatchReader>* reader) {
+  return Open(std::move(message_reader), IpcOptions::Defaults(), reader);
+}
+
+Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_reader,
+                                     const IpcOptions& options,
+                                     std::shared_ptr<RecordBatchReader>* reader) {
   // Private ctor
   auto result = std::shared_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
-  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader), options));
   *reader = result;
   return Status::OK();
 }
@@ -594,7 +761,7 @@ Status RecordBatchStreamReader::Open(std::unique_ptr<MessageReader> message_read
                                      std::unique_ptr<RecordBatchReader>* reader) {
   // Private ctor
   auto result = std::unique_ptr<RecordBatchStreamReader>(new RecordBatchStreamReader());
-  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader)));
+  RETURN_NOT_OK(result->impl_->Open(std::move(message_reader), IpcOptions::Defaults()));
   *reader = std::move(result);
   return Status::OK();
 }
@@ -699,26 +866,128 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
       RETURN_NOT_OK(ReadMessageFromBlock(GetDictionaryBlock(i), &message));
 
       io::BufferReader reader(message->body());
-      RETURN_NOT_OK(ReadDictionary(*message->metadata(), &dictionary_memo_, &reader));
+      RETURN_NOT_OK(
+          ReadDictionary(*message->metadata(), &dictionary_memo_, options_, &reader));
     }
     return Status::OK();
   }
 
-  Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch) {
-    DCHECK_GE(i, 0);
-    DCHECK_LT(i, num_record_batches());
+  // Return the metadata of a record batch, reading and verifying it only
+  // the first time it is requested
+  Status GetRecordBatchMetadata(int i, std::shared_ptr<Message>* out) {
+    if (batch_metadata_.empty()) {
+      batch_metadata_.resize(num_record_batches());
+    }
+    if (batch_metadata_[i] == nullptr) {
+      const FileBlock block = GetRecordBatchBlock(i);
+      DCHECK(BitUtil::IsMultipleOf8(block.offset));
+      DCHECK(BitUtil::IsMultipleOf8(block.metadata_length));
 
+      std::unique_ptr<Message> message;
+      RETURN_NOT_OK(ReadMessageMetadata(block.offset, block.metadata_length, file_,
+                                        &message));
+      if (message == nullptr) {
+        return Status::IOError("Unexpected end of stream reading record batch ", i);
+      }
+      CHECK_MESSAGE_TYPE(Message::RECORD_BATCH, message->type());
+      batch_metadata_[i] = std::move(message);
+    }
+    *out = batch_metadata_[i];
+    return Status::OK();
+  }
+
+  Status EnsureDictionaries() {
     if (!read_dictionaries_) {
       RETURN_NOT_OK(ReadDictionaries());
       read_dictionaries_ = true;
     }
+    return Status::OK();
+  }
 
-    std::unique_ptr<Message> message;
-    RETURN_NOT_OK(ReadMessageFromBlock(GetRecordBatchBlock(i), &message));
+  Status ReadRecordBatch(int i, const std::vector<int>& field_indices,
+                         std::shared_ptr<RecordBatch>* batch) {
+    RETURN_NOT_OK(EnsureDictionaries());
+    IpcOptions options = options_;
+    options.included_fields = field_indices;
+    return ReadRecordBatchWithOptions(i, options, batch);
+  }
 
-    io::BufferReader reader(message->body());
-    return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_, &dictionary_memo_,
-                                         &reader, batch);
+  Status ReadTable(bool use_threads, std::shared_ptr<Table>* out) {
+    // Dictionaries and the metadata cache are shared by all batches, set
+    // them up before any concurrent read
+    RETURN_NOT_OK(EnsureDictionaries());
+    const int num_batches = num_record_batches();
+    batch_metadata_.resize(num_batches);
+
+    std::vector<std::shared_ptr<RecordBatch>> batches(num_batches);
+    IpcOptions options = options_;
+    // Batches are already decoded in parallel; decompressing their buffers
+    // on the same pool from within a task could exhaust it
+    options.use_threads = false;
+    auto read_batch = [&](int i) -> Status {
+      RETURN_NOT_OK(ReadRecordBatchWithOptions(i, options, &batches[i]));
+      return batches[i]->Validate();
+    };
+
+    if (use_threads && num_batches > 1) {
+      // Only keep a bounded number of batches in flight, so that the
+      // transient memory used for reading and decompressing depends on the
+      // pool size rather than the number of batches.  Each task starts the
+      // next batch when done, so a slow batch doesn't hold back the others.
+      // Finish() runs pending tasks, which makes this safe to call from a
+      // CPU pool task.
+      auto pool = ::arrow::internal::GetCpuThreadPool();
+      auto group = ::arrow::internal::TaskGroup::MakeThreaded(pool);
+      const int max_in_flight =
+          std::min(2 * std::max(1, pool->GetCapacity()), num_batches);
+      std::atomic<int> next_batch(0);
+      std::function<Status()> read_next = [&]() -> Status {
+        const int i = next_batch++;
+        if (i >= num_batches) {
+          return Status::OK();
+        }
+        RETURN_NOT_OK(read_batch(i));
+        group->Append(read_next);
+        return Status::OK();
+      };
+      for (int i = 0; i < max_in_flight; ++i) {
+        group->Append(read_next);
+      }
+      RETURN_NOT_OK(group->Finish());
+    } else {
+      for (int i = 0; i < num_batches; ++i) {
+        RETURN_NOT_OK(read_batch(i));
+      }
+    }
+    return Table::FromRecordBatches(schema_, batches, out);
+  }
+
+  Status ReadRecordBatchWithOptions(int i, const IpcOptions& options,
+                                    std::shared_ptr<RecordBatch>* batch) {
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_record_batches());
+
+    std::shared_ptr<Message> message;
+    RETURN_NOT_OK(GetRecordBatchMetadata(i, &message));
+    const FileBlock block = GetRecordBatchBlock(i);
+    const int64_t body_offset = block.offset + block.metadata_length;
+
+    if (options.included_fields.empty()) {
+      // All fields are needed: fetch the whole body with a single read
+      std::shared_ptr<Buffer> body;
+      RETURN_NOT_OK(file_->ReadAt(body_offset, message->body_length(), &body));
+      if (body->size() < message->body_length()) {
+        return Status::IOError("Expected to be able to read ", message->body_length(),
+                               " bytes for message body, got ", body->size());
+      }
+      io::BufferReader reader(body);
+      return ::arrow::ipc::ReadRecordBatch(*message->metadata(), schema_,
+                                           &dictionary_memo_, options, &reader, batch);
+    }
+    // Only the buffers of the selected fields are read. With a memory-mapped
+    // file these are zero-copy slices of the mapping
+    return ReadRecordBatchAt(*message->metadata(), schema_, &dictionary_memo_, options,
+                             file_, body_offset, batch);
   }
 
   Status ReadSchema() {
@@ -726,14 +995,17 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
     return internal::GetSchema(footer_->schema(), &dictionary_memo_, &schema_);
   }
 
-  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset) {
+  Status Open(const std::shared_ptr<io::RandomAccessFile>& file, int64_t footer_offset,
+              const IpcOptions& options) {
     owned_file_ = file;
-    return Open(file.get(), footer_offset);
+    return Open(file.get(), footer_offset, options);
   }
 
-  Status Open(io::RandomAccessFile* file, int64_t footer_offset) {
+  Status Open(io::RandomAccessFile* file, int64_t footer_offset,
+              const IpcOptions& options) {
     file_ = file;
     footer_offset_ = footer_offset;
+    options_ = options;
     RETURN_NOT_OK(ReadFooter());
     return ReadSchema();
   }
@@ -749,6 +1021,8 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
   // or some other location if embedded in a larger file.
   int64_t footer_offset_;
 
+  IpcOptions options_;
+
   // Footer metadata
   std::shared_ptr<Buffer> footer_buffer_;
   const flatbuf::Footer* footer_;
@@ -756,6 +1030,9 @@ class RecordBatchFileReader::RecordBatchFileReaderImpl {
   bool read_dictionaries_ = false;
   DictionaryMemo dictionary_memo_;
 
+  // Record batch metadata read so far, by batch index
+  std::vector<std::shared_ptr<Message>> batch_metadata_;
+
   // Reconstructed schema, including any read dictionaries
   std::shared_ptr<Schema> schema_;
 };
@@ -775,8 +1052,7 @@ Status RecordBatchFileReader::Open(io::RandomAccessFile* file,
 
 Status RecordBatchFileReader::Open(io::RandomAccessFile* file, int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
-  *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return Open(file, footer_offset, IpcOptions::Defaults(), reader);
 }
 
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
@@ -789,8 +1065,21 @@ Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>&
 Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
                                    int64_t footer_offset,
                                    std::shared_ptr<RecordBatchFileReader>* reader) {
+  return Open(file, footer_offset, IpcOptions::Defaults(), reader);
+}
+
+Status RecordBatchFileReader::Open(io::RandomAccessFile* file, int64_t footer_offset,
+                                   const IpcOptions& options,
+                                   std::shared_ptr<RecordBatchFileReader>* reader) {
+  *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
+  return (*reader)->impl_->Open(file, footer_offset, options);
+}
+
+Status RecordBatchFileReader::Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                                   int64_t footer_offset, const IpcOptions& options,
+                                   std::shared_ptr<RecordBatchFileReader>* reader) {
   *reader = std::shared_ptr<RecordBatchFileReader>(new RecordBatchFileReader());
-  return (*reader)->impl_->Open(file, footer_offset);
+  return (*reader)->impl_->Open(file, footer_offset, options);
 }
 
 std::shared_ptr<Schema> RecordBatchFileReader::schema() const { return impl_->schema(); }
@@ -803,7 +1092,17 @@ MetadataVersion RecordBatchFileReader::version() const { return impl_->version()
 
 Status RecordBatchFileReader::ReadRecordBatch(int i,
                                               std::shared_ptr<RecordBatch>* batch) {
-  return impl_->ReadRecordBatch(i, batch);
+  return impl_->ReadRecordBatch(i, {}, batch);
+}
+
+Status RecordBatchFileReader::ReadRecordBatch(int i,
+                                              const std::vector<int>& field_indices,
+                                              std::shared_ptr<RecordBatch>* batch) {
+  return impl_->ReadRecordBatch(i, field_indices, batch);
+}
+
+Status RecordBatchFileReader::ReadTable(bool use_threads, std::shared_ptr<Table>* out) {
+  return impl_->ReadTable(use_threads, out);
 }
 
 static Status ReadContiguousPayload(io::InputStream* file,
@@ -22,6 +22,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/message.h"
@@ -36,6 +37,7 @@ namespace arrow {
 class Buffer;
 class Schema;
 class Status;
+class Table;
 class Tensor;
 class SparseTensor;
 
@@ -71,6 +73,18 @@ class ARROW_EXPORT RecordBatchStreamReader : public RecordBatchReader {
   static Status Open(std::unique_ptr<MessageReader> message_reader,
                      std::unique_ptr<RecordBatchReader>* out);
 
+  /// \brief Create batch reader from generic MessageReader, with options
+  ///
+  /// \param[in] message_reader a MessageReader implementation
+  /// \param[in] options options used to read the dictionaries and record
+  /// batches, such as the memory pool for decompressed buffers and
+  /// dictionary deltas
+  /// \param[out] out the created RecordBatchReader object
+  /// \return Status
+  static Status Open(std::unique_ptr<MessageReader> message_reader,
+                     const IpcOptions& options,
+                     std::shared_ptr<RecordBatchReader>* out);
+
   /// \brief Record batch stream reader from InputStream
   ///
   /// \param[in] stream an input stream instance. Must stay alive throughout
@@ -144,6 +158,31 @@ class ARROW_EXPORT RecordBatchFileReader {
                      int64_t footer_offset,
                      std::shared_ptr<RecordBatchFileReader>* reader);
 
+  /// \brief Open a RecordBatchFileReader with options
+  ///
+  /// \param[in] file the data source
+  /// \param[in] footer_offset the position of the end of the Arrow file
+  /// \param[in] options options used to read the dictionaries and record
+  /// batches, such as the memory pool for decompressed buffers and
+  /// dictionary deltas. Fields to include are given to ReadRecordBatch()
+  /// \param[out] reader the returned reader
+  /// \return Status
+  static Status Open(io::RandomAccessFile* file, int64_t footer_offset,
+                     const IpcOptions& options,
+                     std::shared_ptr<RecordBatchFileReader>* reader);
+
+  /// \brief Version of Open with options that retains ownership of file
+  ///
+  /// \param[in] file the data source
+  /// \param[in] footer_offset the position of the end of the Arrow file
+  /// \param[in] options options used to read the dictionaries and record
+  /// batches
+  /// \param[out] reader the returned reader
+  /// \return Status
+  static Status Open(const std::shared_ptr<io::RandomAccessFile>& file,
+                     int64_t footer_offset, const IpcOptions& options,
+                     std::shared_ptr<RecordBatchFileReader>* reader);
+
   /// \brief The schema read from the file
   std::shared_ptr<Schema> schema() const;
 
@@ -161,6 +200,35 @@ class ARROW_EXPORT RecordBatchFileReader {
   /// \return Status
   Status ReadRecordBatch(int i, std::shared_ptr<RecordBatch>* batch);
 
+  /// \brief Read a subset of the top-level fields of a particular record
+  /// batch from the file
+  ///
+  /// Only the buffers of the selected fields are read from the file. With a
+  /// memory-mapped file they are zero-copy slices of the mapping. The metadata
+  /// of a record batch is parsed once and reused by later reads of the same
+  /// batch.
+  ///
+  /// \param[in] i the index of the record batch to return
+  /// \param[in] field_indices indices of the fields to read in the file
+  /// schema. The returned batch has them in schema order. If empty, all
+  /// fields are read
+  /// \param[out] batch the read batch
+  /// \return Status
+  Status ReadRecordBatch(int i, const std::vector<int>& field_indices,
+                         std::shared_ptr<RecordBatch>* batch);
+
+  /// \brief Read all the record batches of the file into a Table
+  ///
+  /// Each batch is validated after being read. With use_threads, batches are
+  /// read and decoded concurrently on the global CPU thread pool, with a
+  /// bounded number of them in flight at any time; the order of the batches
+  /// is preserved. This may be called from a task running on that pool.
+  ///
+  /// \param[in] use_threads whether to read the batches in parallel
+  /// \param[out] out the table holding all the record batches
+  /// \return Status
+  Status ReadTable(bool use_threads, std::shared_ptr<Table>* out);
+
  private:
   RecordBatchFileReader();
 
@@ -44,8 +44,11 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
+#include "arrow/util/compression.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/stl.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor.h"
 
 namespace arrow {
@@ -156,7 +159,66 @@ class RecordBatchSerializer : public ArrayVisitor {
   // Override this for writing dictionary metadata
   virtual Status SerializeMetadata(int64_t num_rows) {
     return WriteRecordBatchMessage(num_rows, out_->body_length, field_nodes_,
-                                   buffer_meta_, &out_->metadata);
+                                   buffer_meta_, options_.compression, &out_->metadata);
+  }
+
+  // Replace a body buffer by its compressed form: the uncompressed length as
+  // a little-endian int64 followed by the compressed bytes. If compression
+  // does not save space, the length is written as -1 followed by the raw bytes
+  Status CompressBuffer(util::Codec* codec, std::shared_ptr<Buffer>* buffer) {
+    const int64_t raw_size = (*buffer)->size();
+    const int64_t max_size = codec->MaxCompressedLen(raw_size, (*buffer)->data());
+
+    std::shared_ptr<ResizableBuffer> result;
+    RETURN_NOT_OK(AllocateResizableBuffer(pool_, max_size + sizeof(int64_t), &result));
+
+    int64_t actual_size = 0;
+    RETURN_NOT_OK(codec->Compress(raw_size, (*buffer)->data(), max_size,
+                                  result->mutable_data() + sizeof(int64_t),
+                                  &actual_size));
+    int64_t prefix = raw_size;
+    if (actual_size >= raw_size) {
+      // Not worth it, store the buffer as is
+      prefix = -1;
+      actual_size = raw_size;
+      std::memcpy(result->mutable_data() + sizeof(int64_t), (*buffer)->data(),
+                  static_cast<size_t>(raw_size));
+    }
+    prefix = BitUtil::ToLittleEndian(prefix);
+    std::memcpy(result->mutable_data(), &prefix, sizeof(int64_t));
+    RETURN_NOT_OK(result->Resize(actual_size + sizeof(int64_t), /*shrink_to_fit=*/true));
+    *buffer = result;
+    return Status::OK();
+  }
+
+  Status CompressBodyBuffers() {
+    auto CompressOne = [&](int i) -> Status {
+      std::shared_ptr<Buffer>& buffer = out_->body_buffers[i];
+      if (buffer == nullptr || buffer->size() == 0) {
+        return Status::OK();
+      }
+      // Codecs may keep stream state, so each task uses its own instance
+      std::unique_ptr<util::Codec> codec;
+      RETURN_NOT_OK(
+          util::Codec::Create(options_.compression, options_.compression_level, &codec));
+      return CompressBuffer(codec.get(), &buffer);
+    };
+
+    const int num_buffers = static_cast<int>(out_->body_buffers.size());
+    if (options_.use_threads && num_buffers > 1) {
+      // The calling thread runs pending tasks while finishing the group, so
+      // this doesn't deadlock when writing from a task of the CPU thread pool
+      auto task_group = ::arrow::internal::TaskGroup::MakeThreaded(
+          ::arrow::internal::GetCpuThreadPool());
+      for (int i = 0; i < num_buffers; ++i) {
+        task_group->Append([&, i]() { return CompressOne(i); });
+      }
+      return task_group->Finish();
+    }
+    for (int i = 0; i < num_buffers; ++i) {
+      RETURN_NOT_OK(CompressOne(i));
+    }
+    return Status::OK();
   }
 
   Status Assemble(const RecordBatch& batch) {
@@ -171,6 +233,10 @@ class RecordBatchSerializer : public ArrayVisitor {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
     }
 
+    if (options_.compression != Compression::UNCOMPRESSED) {
+      RETURN_NOT_OK(CompressBodyBuffers());
+    }
+
     // The position for the start of a buffer relative to the passed frame of
     // reference. May be 0 or some other position in an address space
     int64_t offset = buffer_start_offset_;
@@ -189,7 +255,10 @@ class RecordBatchSerializer : public ArrayVisitor {
         padding = BitUtil::RoundUpToMultipleOf8(size) - size;
       }
 
-      buffer_meta_.push_back({offset, size + padding});
+      // Compressed buffers record their exact length so that readers do not
+      // hand the trailing padding to the codec
+      const bool compressed = options_.compression != Compression::UNCOMPRESSED;
+      buffer_meta_.push_back({offset, compressed ? size : size + padding});
       offset += size + padding;
     }
 
@@ -510,14 +579,17 @@ class RecordBatchSerializer : public ArrayVisitor {
 
 class DictionaryWriter : public RecordBatchSerializer {
  public:
-  DictionaryWriter(int64_t dictionary_id, MemoryPool* pool, int64_t buffer_start_offset,
-                   const IpcOptions& options, IpcPayload* out)
+  DictionaryWriter(int64_t dictionary_id, bool is_delta, MemoryPool* pool,
+                   int64_t buffer_start_offset, const IpcOptions& options,
+                   IpcPayload* out)
       : RecordBatchSerializer(pool, buffer_start_offset, options, out),
-        dictionary_id_(dictionary_id) {}
+        dictionary_id_(dictionary_id),
+        is_delta_(is_delta) {}
 
   Status SerializeMetadata(int64_t num_rows) override {
     return WriteDictionaryMessage(dictionary_id_, num_rows, out_->body_length,
-                                  field_nodes_, buffer_meta_, &out_->metadata);
+                                  field_nodes_, buffer_meta_, options_.compression,
+                                  is_delta_, &out_->metadata);
   }
 
   Status Assemble(const std::shared_ptr<Array>& dictionary) {
@@ -529,17 +601,32 @@ class DictionaryWriter : public RecordBatchSerializer {
 
  private:
   int64_t dictionary_id_;
+  bool is_delta_;
 };
 
 Status WriteIpcPayload(const IpcPayload& payload, const IpcOptions& options,
                        io::OutputStream* dst, int32_t* metadata_length) {
-  RETURN_NOT_OK(WriteMessage(*payload.metadata, options, dst, metadata_length));
-
-#ifndef NDEBUG
-  RETURN_NOT_OK(CheckAligned(dst));
-#endif
+  static const auto kPadding = std::make_shared<Buffer>(kPaddingBytes, kArrowAlignment);
+
+  // Gather the encapsulated message (prefix, flatbuffer and padding) and the
+  // body buffers with their padding, so that the stream receives the whole
+  // payload in a single vectored write
+  std::vector<std::shared_ptr<Buffer>> pieces;
+  pieces.reserve(3 + 2 * payload.body_buffers.size());
+
+  const int32_t flatbuffer_size = static_cast<int32_t>(payload.metadata->size());
+  const auto framing = internal::GetMessageFraming(flatbuffer_size, options);
+  *metadata_length = framing.message_length;
+
+  std::shared_ptr<Buffer> prefix;
+  RETURN_NOT_OK(AllocateBuffer(framing.prefix_size, &prefix));
+  std::memcpy(prefix->mutable_data(), framing.prefix, framing.prefix_size);
+  pieces.push_back(prefix);
+  pieces.push_back(payload.metadata);
+  if (framing.padding > 0) {
+    pieces.push_back(SliceBuffer(kPadding, 0, framing.padding));
+  }
 
-  // Now write the buffers
   for (size_t i = 0; i < payload.body_buffers.size(); ++i) {
     const std::shared_ptr<Buffer>& buffer = payload.body_buffers[i];
     int64_t size = 0;
@@ -552,14 +639,16 @@ Status WriteIpcPayload(const IpcPayload& payload, const IpcOptions& options,
     }
 
     if (size > 0) {
-      RETURN_NOT_OK(dst->Write(buffer));
+      pieces.push_back(buffer);
     }
 
     if (padding > 0) {
-      RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+      pieces.push_back(SliceBuffer(kPadding, 0, padding));
     }
   }
 
+  RETURN_NOT_OK(dst->Writev(pieces));
+
 #ifndef NDEBUG
   RETURN_NOT_OK(CheckAligned(dst));
 #endif
@@ -576,9 +665,16 @@ Status GetSchemaPayload(const Schema& schema, const IpcOptions& options,
 Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary,
                             const IpcOptions& options, MemoryPool* pool,
                             IpcPayload* out) {
+  return GetDictionaryPayload(id, /*is_delta=*/false, dictionary, options, pool, out);
+}
+
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcOptions& options, MemoryPool* pool,
+                            IpcPayload* out) {
   out->type = Message::DICTIONARY_BATCH;
   // Frame of reference is 0, see ARROW-384
-  DictionaryWriter writer(id, pool, /*buffer_start_offset=*/0, options, out);
+  DictionaryWriter writer(id, is_delta, pool, /*buffer_start_offset=*/0, options, out);
   return writer.Assemble(dictionary);
 }
 
@@ -931,11 +1027,10 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
     if (!wrote_dictionaries_) {
       RETURN_NOT_OK(WriteDictionaries(batch));
       wrote_dictionaries_ = true;
+    } else if (dictionary_memo_->num_dictionaries() > 0) {
+      RETURN_NOT_OK(WriteDictionaryDeltas(batch));
     }
 
-    // TODO(wesm): Check for delta dictionaries. Can we scan for
-    // deltas while computing the RecordBatch payload to save time?
-
     internal::IpcPayload payload;
     RETURN_NOT_OK(GetRecordBatchPayload(batch, options_, pool_, &payload));
     return payload_writer_->WritePayload(payload);
@@ -976,6 +1071,45 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
       RETURN_NOT_OK(
           GetDictionaryPayload(dictionary_id, dictionary, options_, pool_, &payload));
       RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+      sent_dictionaries_[dictionary_id] = dictionary;
+    }
+    return Status::OK();
+  }
+
+  // Compare the dictionaries of a subsequent batch against those already
+  // sent. A dictionary that only had values appended is sent as a delta
+  // dictionary batch holding the new values; other changes cannot be
+  // expressed in an IPC stream
+  Status WriteDictionaryDeltas(const RecordBatch& batch) {
+    DictionaryMap dictionaries;
+    RETURN_NOT_OK(GetDictionaries(schema_, batch, *dictionary_memo_, &dictionaries));
+
+    for (auto& pair : dictionaries) {
+      const int64_t dictionary_id = pair.first;
+      const auto& dictionary = pair.second;
+      std::shared_ptr<Array>& sent = sent_dictionaries_[dictionary_id];
+      if (sent == nullptr) {
+        return Status::KeyError("No dictionary was sent for id ", dictionary_id);
+      }
+      if (sent == dictionary) {
+        continue;
+      }
+
+      const int64_t sent_length = sent->length();
+      if (dictionary->length() < sent_length ||
+          !dictionary->RangeEquals(0, sent_length, 0, *sent)) {
+        return Status::Invalid("Dictionary with id ", dictionary_id,
+                               " was replaced; only appending values to a ",
+                               "dictionary is supported between record batches");
+      }
+      if (dictionary->length() > sent_length) {
+        internal::IpcPayload payload;
+        RETURN_NOT_OK(GetDictionaryPayload(dictionary_id, /*is_delta=*/true,
+                                           dictionary->Slice(sent_length), options_,
+                                           pool_, &payload));
+        RETURN_NOT_OK(payload_writer_->WritePayload(payload));
+      }
+      sent = dictionary;
     }
     return Status::OK();
   }
@@ -987,6 +1121,8 @@ class RecordBatchPayloadWriter : public RecordBatchWriter {
   MemoryPool* pool_;
   DictionaryMemo* dictionary_memo_;
   DictionaryMemo internal_dict_memo_;
+  // The most recent dictionary sent for each id, including deltas
+  DictionaryMap sent_dictionaries_;
   bool started_ = false;
   bool wrote_dictionaries_ = false;
   IpcOptions options_;
@@ -385,6 +385,20 @@ Status GetDictionaryPayload(int64_t id, const std::shared_ptr<Array>& dictionary
                             const IpcOptions& options, MemoryPool* pool,
                             IpcPayload* payload);
 
+/// \brief Compute IpcPayload for a dictionary or a dictionary delta
+/// \param[in] id the dictionary id
+/// \param[in] is_delta if true, the values are appended by readers to the
+/// dictionary previously sent with the same id
+/// \param[in] dictionary the dictionary values
+/// \param[in] options options for serialization
+/// \param[out] payload the output IpcPayload
+/// \return Status
+ARROW_EXPORT
+Status GetDictionaryPayload(int64_t id, bool is_delta,
+                            const std::shared_ptr<Array>& dictionary,
+                            const IpcOptions& options, MemoryPool* pool,
+                            IpcPayload* payload);
+
 /// \brief Compute IpcPayload for the given record batch
 /// \param[in] batch the RecordBatch that is being serialized
 /// \param[in] options options for serialization
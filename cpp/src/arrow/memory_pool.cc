@@ -18,6 +18,7 @@
 #include "arrow/memory_pool.h"
 
 #include <algorithm>  // IWYU pragma: keep
+#include <cerrno>
 #include <cstdlib>    // IWYU pragma: keep
 #include <cstring>    // IWYU pragma: keep
 #include <iostream>   // IWYU pragma: keep
@@ -25,7 +26,13 @@
 #include <memory>
 
 #include "arrow/status.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"  // IWYU pragma: keep
+#include "arrow/util/numa.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
 
 #ifdef ARROW_JEMALLOC
 // Needed to support jemalloc 3 and 4
@@ -533,4 +540,74 @@ int64_t ProxyMemoryPool::max_memory() const { return impl_->max_memory(); }
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// NumaMemoryPool implementation
+
+NumaMemoryPool::NumaMemoryPool(MemoryPool* pool, int64_t min_bind_size)
+    : pool_(pool), min_bind_size_(std::max<int64_t>(min_bind_size, 1)) {}
+
+bool NumaMemoryPool::IsBound(int64_t size) const {
+#ifdef __linux__
+  return size >= min_bind_size_;
+#else
+  return false;
+#endif
+}
+
+Status NumaMemoryPool::Allocate(int64_t size, uint8_t** out) {
+  if (!IsBound(size)) {
+    RETURN_NOT_OK(pool_->Allocate(size, out));
+    stats_.UpdateAllocatedBytes(size);
+    return Status::OK();
+  }
+#ifdef __linux__
+  // Mapped pages are page-aligned, and only get physical memory when first
+  // touched, on the node they are bound to
+  void* data = mmap(nullptr, static_cast<size_t>(size), PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (data == MAP_FAILED) {
+    return Status::OutOfMemory("mmap of size ", size, " failed: ",
+                               internal::ErrnoMessage(errno));
+  }
+  // Binding is a best-effort hint; without it, the kernel still places
+  // pages on the node of the thread that first touches them
+  ARROW_UNUSED(
+      internal::BindMemoryToNumaNode(data, size, internal::GetCurrentNumaNode()));
+  *out = reinterpret_cast<uint8_t*>(data);
+  stats_.UpdateAllocatedBytes(size);
+#endif
+  return Status::OK();
+}
+
+Status NumaMemoryPool::Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) {
+  if (!IsBound(old_size) && !IsBound(new_size)) {
+    RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, ptr));
+    stats_.UpdateAllocatedBytes(new_size - old_size);
+    return Status::OK();
+  }
+  uint8_t* new_ptr;
+  RETURN_NOT_OK(Allocate(new_size, &new_ptr));
+  std::memcpy(new_ptr, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+  Free(*ptr, old_size);
+  *ptr = new_ptr;
+  return Status::OK();
+}
+
+void NumaMemoryPool::Free(uint8_t* buffer, int64_t size) {
+  if (!IsBound(size)) {
+    pool_->Free(buffer, size);
+  } else {
+#ifdef __linux__
+    ARROW_CHECK_EQ(munmap(buffer, static_cast<size_t>(size)), 0);
+#endif
+  }
+  stats_.UpdateAllocatedBytes(-size);
+}
+
+int64_t NumaMemoryPool::bytes_allocated() const { return stats_.bytes_allocated(); }
+
+int64_t NumaMemoryPool::max_memory() const { return stats_.max_memory(); }
+
+std::string NumaMemoryPool::backend_name() const { return "numa"; }
+
 }  // namespace arrow
@@ -150,6 +150,38 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief EXPERIMENTAL: a MemoryPool placing memory on the NUMA node of the
+/// calling thread.
+///
+/// Allocations of at least `min_bind_size` bytes are mapped from the OS and
+/// bound to the NUMA node the calling thread runs on, so that buffers
+/// allocated by workers of a NUMA-aware ThreadPool stay local to them.
+/// Smaller allocations are delegated to another pool.  On platforms without
+/// NUMA support, all allocations are delegated.
+class ARROW_EXPORT NumaMemoryPool : public MemoryPool {
+ public:
+  explicit NumaMemoryPool(MemoryPool* pool, int64_t min_bind_size = 1 << 16);
+  ~NumaMemoryPool() override = default;
+
+  Status Allocate(int64_t size, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, uint8_t** ptr) override;
+
+  void Free(uint8_t* buffer, int64_t size) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  bool IsBound(int64_t size) const;
+
+  MemoryPool* pool_;
+  int64_t min_bind_size_;
+  internal::MemoryPoolStats stats_;
+};
+
 /// Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
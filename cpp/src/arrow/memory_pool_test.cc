@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <cstring>
 
 #include <gtest/gtest.h>
 
@@ -54,6 +55,15 @@ struct MimallocMemoryPoolFactory {
 };
 #endif
 
+struct NumaMemoryPoolFactory {
+  static MemoryPool* memory_pool() {
+    // Bind allocations of 16 bytes or more, so that the tests exercise
+    // both bound and delegated allocations
+    static NumaMemoryPool pool(system_memory_pool(), 16);
+    return &pool;
+  }
+};
+
 template <typename Factory>
 class TestMemoryPool : public ::arrow::TestMemoryPoolBase {
  public:
@@ -76,6 +86,7 @@ REGISTER_TYPED_TEST_CASE_P(TestMemoryPool, MemoryTracking, OOM, Reallocate);
 
 INSTANTIATE_TYPED_TEST_CASE_P(Default, TestMemoryPool, DefaultMemoryPoolFactory);
 INSTANTIATE_TYPED_TEST_CASE_P(System, TestMemoryPool, SystemMemoryPoolFactory);
+INSTANTIATE_TYPED_TEST_CASE_P(Numa, TestMemoryPool, NumaMemoryPoolFactory);
 
 #ifdef ARROW_JEMALLOC
 INSTANTIATE_TYPED_TEST_CASE_P(Jemalloc, TestMemoryPool, JemallocMemoryPoolFactory);
@@ -153,4 +164,24 @@ TEST(Jemalloc, SetDirtyPageDecayMillis) {
 #endif
 }
 
+TEST(NumaMemoryPool, LargeAllocations) {
+  NumaMemoryPool pool(default_memory_pool());
+  ASSERT_EQ("numa", pool.backend_name());
+
+  uint8_t* data;
+  ASSERT_OK(pool.Allocate(100, &data));
+  ASSERT_OK(pool.Reallocate(100, 1 << 20, &data));
+  std::memset(data, 42, 1 << 20);
+  ASSERT_EQ(1 << 20, pool.bytes_allocated());
+  ASSERT_OK(pool.Reallocate(1 << 20, 1 << 21, &data));
+  ASSERT_EQ(42, data[(1 << 20) - 1]);
+  ASSERT_OK(pool.Reallocate(1 << 21, 64, &data));
+  ASSERT_EQ(42, data[63]);
+  pool.Free(data, 64);
+
+  ASSERT_EQ(0, pool.bytes_allocated());
+  // Reallocating bound memory holds both buffers for a while
+  ASSERT_EQ(3 << 20, pool.max_memory());
+}
+
 }  // namespace arrow
@@ -28,6 +28,8 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/rle_encoding.h"
 
 namespace arrow {
 
@@ -356,6 +358,70 @@ static void CopyBitmapWithOffset(benchmark::State& state) {  // NOLINT non-const
   CopyBitmap<4>(state);
 }
 
+template <typename UnpackFunc>
+static void BenchmarkUnpack32(benchmark::State& state, UnpackFunc&& unpack) {
+  const int num_bits = static_cast<int>(state.range(0));
+  constexpr int kNumValues = 4096;
+
+  std::shared_ptr<Buffer> buffer = CreateRandomBuffer(kNumValues * num_bits / 8);
+  const uint32_t* packed = reinterpret_cast<const uint32_t*>(buffer->data());
+  std::vector<uint32_t> values(kNumValues);
+
+  for (auto _ : state) {
+    auto unpacked = unpack(packed, values.data(), kNumValues, num_bits);
+    benchmark::DoNotOptimize(unpacked);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+static void Unpack32Default(benchmark::State& state) {
+  BenchmarkUnpack32(state, internal::unpack32_default);
+}
+
+// Dispatched to the best SIMD implementation available at runtime
+static void Unpack32(benchmark::State& state) {
+  BenchmarkUnpack32(state, internal::unpack32);
+}
+
+// Decoding of random (hence mostly bit-packed) values, such as definition
+// levels (int16) or dictionary indices (int32)
+template <typename T>
+static void BenchmarkRleDecoderGetBatch(benchmark::State& state) {
+  const int bit_width = static_cast<int>(state.range(0));
+  constexpr int kNumValues = 64 * 1024;
+
+  std::shared_ptr<Buffer> random_values = CreateRandomBuffer(kNumValues * sizeof(T));
+  const T* raw_values = reinterpret_cast<const T*>(random_values->data());
+  const uint64_t value_mask = (1ULL << bit_width) - 1;
+
+  std::vector<uint8_t> encoded(util::RleEncoder::MaxBufferSize(bit_width, kNumValues) +
+                               util::RleEncoder::MinBufferSize(bit_width));
+  util::RleEncoder encoder(encoded.data(), static_cast<int>(encoded.size()), bit_width);
+  for (int i = 0; i < kNumValues; ++i) {
+    if (!encoder.Put(static_cast<uint64_t>(raw_values[i]) & value_mask)) {
+      state.SkipWithError("RleEncoder buffer full");
+      return;
+    }
+  }
+  const int encoded_size = encoder.Flush();
+
+  std::vector<T> values(kNumValues);
+  for (auto _ : state) {
+    util::RleDecoder decoder(encoded.data(), encoded_size, bit_width);
+    auto decoded = decoder.GetBatch(values.data(), kNumValues);
+    benchmark::DoNotOptimize(decoded);
+  }
+  state.SetItemsProcessed(state.iterations() * kNumValues);
+}
+
+static void RleDecoderGetBatchInt16(benchmark::State& state) {
+  BenchmarkRleDecoderGetBatch<int16_t>(state);
+}
+
+static void RleDecoderGetBatchInt32(benchmark::State& state) {
+  BenchmarkRleDecoderGetBatch<int32_t>(state);
+}
+
 #ifdef ARROW_WITH_BENCHMARKS_REFERENCE
 static void ReferenceNaiveBitmapReader(benchmark::State& state) {
   BenchmarkBitmapReader<NaiveBitmapReader>(state, state.range(0));
@@ -393,5 +459,11 @@ BENCHMARK(BenchmarkBitmapVisitBitsetAnd)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitUInt8And)->Ranges(AND_BENCHMARK_RANGES);
 BENCHMARK(BenchmarkBitmapVisitUInt64And)->Ranges(AND_BENCHMARK_RANGES);
 
+BENCHMARK(Unpack32Default)->DenseRange(1, 32);
+BENCHMARK(Unpack32)->DenseRange(1, 32);
+
+BENCHMARK(RleDecoderGetBatchInt16)->Arg(1)->Arg(2)->Arg(3)->Arg(8);
+BENCHMARK(RleDecoderGetBatchInt32)->Arg(1)->Arg(4)->Arg(8)->Arg(12)->Arg(16)->Arg(20);
+
 }  // namespace BitUtil
 }  // namespace arrow
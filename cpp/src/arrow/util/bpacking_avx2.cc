@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/util/bpacking.h"
+#include "arrow/util/bpacking_simd_internal.h"
+
+namespace arrow {
+namespace internal {
+
+// Eight consecutive values of num_bits each always start on a byte boundary
+// and occupy num_bits <= 32 bytes, so each group of 8 values is unpacked from
+// a single unaligned 256-bit load: every lane picks the 32-bit word its value
+// starts in and the following one, shifts both and merges them.
+int unpack32_avx2(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  if (num_bits == 0 || num_bits == 32) {
+    return unpack32_default(in, out, batch_size, num_bits);
+  }
+  batch_size = batch_size / 32 * 32;
+
+  alignas(32) int32_t low_words[8], high_words[8], low_shifts[8], high_shifts[8];
+  for (int i = 0; i < 8; ++i) {
+    const int bit_offset = i * num_bits;
+    // As num_bits < 32, the high word is always within the loaded group. When
+    // the value lies entirely within the low word, its high bits are masked off
+    low_words[i] = bit_offset / 32;
+    high_words[i] = bit_offset / 32 + 1;
+    low_shifts[i] = bit_offset % 32;
+    // A shift count of 32 yields zero for variable shifts
+    high_shifts[i] = 32 - bit_offset % 32;
+  }
+  const __m256i low_index = _mm256_load_si256(reinterpret_cast<__m256i*>(low_words));
+  const __m256i high_index = _mm256_load_si256(reinterpret_cast<__m256i*>(high_words));
+  const __m256i low_shift = _mm256_load_si256(reinterpret_cast<__m256i*>(low_shifts));
+  const __m256i high_shift = _mm256_load_si256(reinterpret_cast<__m256i*>(high_shifts));
+  const __m256i mask = _mm256_set1_epi32(static_cast<int32_t>((1U << num_bits) - 1));
+
+  auto unpack8 = [&](const uint8_t* group_in, uint32_t* group_out) {
+    const __m256i words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(group_in));
+    const __m256i low = _mm256_srlv_epi32(
+        _mm256_permutevar8x32_epi32(words, low_index), low_shift);
+    const __m256i high = _mm256_sllv_epi32(
+        _mm256_permutevar8x32_epi32(words, high_index), high_shift);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(group_out),
+                        _mm256_and_si256(_mm256_or_si256(low, high), mask));
+  };
+
+  // Unpack whole blocks of 32 values as long as the 32-byte loads stay within
+  // the packed input, and leave the remaining blocks to the scalar code
+  const uint8_t* in_bytes = reinterpret_cast<const uint8_t*>(in);
+  const int64_t in_size = static_cast<int64_t>(batch_size) * num_bits / 8;
+  const int num_blocks = batch_size / 32;
+  int block = 0;
+  for (; block < num_blocks; ++block) {
+    const int64_t block_offset = static_cast<int64_t>(block) * num_bits * 4;
+    if (block_offset + 3 * num_bits + 32 > in_size) {
+      break;
+    }
+    for (int group = 0; group < 4; ++group) {
+      unpack8(in_bytes + block_offset + group * num_bits, out + block * 32 + group * 8);
+    }
+  }
+  unpack32_default(in + block * num_bits, out + block * 32, (num_blocks - block) * 32,
+                   num_bits);
+  return batch_size;
+}
+
+}  // namespace internal
+}  // namespace arrow
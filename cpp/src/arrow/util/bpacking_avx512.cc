@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <immintrin.h>
+
+#include "arrow/util/bpacking.h"
+#include "arrow/util/bpacking_simd_internal.h"
+
+namespace arrow {
+namespace internal {
+
+// Same scheme as unpack32_avx2, with groups of 16 values which occupy
+// 2 * num_bits <= 64 bytes.
+int unpack32_avx512(const uint32_t* in, uint32_t* out, int batch_size, int num_bits) {
+  if (num_bits == 0 || num_bits == 32) {
+    return unpack32_default(in, out, batch_size, num_bits);
+  }
+  batch_size = batch_size / 32 * 32;
+
+  alignas(64) int32_t low_words[16], high_words[16], low_shifts[16], high_shifts[16];
+  for (int i = 0; i < 16; ++i) {
+    const int bit_offset = i * num_bits;
+    low_words[i] = bit_offset / 32;
+    high_words[i] = bit_offset / 32 + 1;
+    low_shifts[i] = bit_offset % 32;
+    high_shifts[i] = 32 - bit_offset % 32;
+  }
+  const __m512i low_index = _mm512_load_si512(low_words);
+  const __m512i high_index = _mm512_load_si512(high_words);
+  const __m512i low_shift = _mm512_load_si512(low_shifts);
+  const __m512i high_shift = _mm512_load_si512(high_shifts);
+  const __m512i mask = _mm512_set1_epi32(static_cast<int32_t>((1U << num_bits) - 1));
+
+  // The zero-masked variants are used with a full mask, as the unmasked ones
+  // trip -Wmaybe-uninitialized in some gcc versions
+  const __mmask16 all = 0xFFFF;
+  auto unpack16 = [&](const uint8_t* group_in, uint32_t* group_out) {
+    const __m512i words = _mm512_loadu_si512(group_in);
+    const __m512i low = _mm512_maskz_srlv_epi32(
+        all, _mm512_maskz_permutexvar_epi32(all, low_index, words), low_shift);
+    const __m512i high = _mm512_maskz_sllv_epi32(
+        all, _mm512_maskz_permutexvar_epi32(all, high_index, words), high_shift);
+    _mm512_storeu_si512(group_out, _mm512_and_si512(_mm512_or_si512(low, high), mask));
+  };
+
+  // Unpack whole blocks of 32 values as long as the 64-byte loads stay within
+  // the packed input, and leave the remaining blocks to the scalar code
+  const uint8_t* in_bytes = reinterpret_cast<const uint8_t*>(in);
+  const int64_t in_size = static_cast<int64_t>(batch_size) * num_bits / 8;
+  const int num_blocks = batch_size / 32;
+  int block = 0;
+  for (; block < num_blocks; ++block) {
+    const int64_t block_offset = static_cast<int64_t>(block) * num_bits * 4;
+    if (block_offset + 2 * num_bits + 64 > in_size) {
+      break;
+    }
+    unpack16(in_bytes + block_offset, out + block * 32);
+    unpack16(in_bytes + block_offset + 2 * num_bits, out + block * 32 + 16);
+  }
+  unpack32_default(in + block * num_bits, out + block * 32, (num_blocks - block) * 32,
+                   num_bits);
+  return batch_size;
+}
+
+}  // namespace internal
+}  // namespace arrow
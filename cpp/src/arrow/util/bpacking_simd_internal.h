@@ -0,0 +1,43 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// SIMD implementations of internal::unpack32, each compiled in its own
+// translation unit with the corresponding instruction set enabled. Callers must
+// check CpuInfo before invoking them; use internal::unpack32 for automatic
+// dispatch.
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+ARROW_EXPORT
+int unpack32_avx2(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+ARROW_EXPORT
+int unpack32_avx512(const uint32_t* in, uint32_t* out, int batch_size, int num_bits);
+#endif
+
+}  // namespace internal
+}  // namespace arrow
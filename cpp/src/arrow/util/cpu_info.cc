@@ -70,6 +70,9 @@ static struct {
     {"sse4_1", CpuInfo::SSE4_1},
     {"sse4_2", CpuInfo::SSE4_2},
     {"popcnt", CpuInfo::POPCNT},
+    {"avx2", CpuInfo::AVX2},
+    // Foundation instructions, which is all the AVX512 kernels require
+    {"avx512f", CpuInfo::AVX512},
 };
 static const int64_t num_flags = sizeof(flag_mappings) / sizeof(flag_mappings[0]);
 
@@ -144,9 +147,11 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
     return false;
   }
   const int register_ECX_id = 1;
+  const int register_extended_features_id = 7;
   int highest_valid_id = 0;
   int highest_extended_valid_id = 0;
   std::bitset<32> features_ECX;
+  std::bitset<32> extended_features_EBX;
   std::array<int, 4> cpu_info;
 
   // Get highest valid id
@@ -158,6 +163,11 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   __cpuidex(cpu_info.data(), register_ECX_id, 0);
   features_ECX = cpu_info[2];
 
+  if (highest_valid_id >= register_extended_features_id) {
+    __cpuidex(cpu_info.data(), register_extended_features_id, 0);
+    extended_features_EBX = cpu_info[1];
+  }
+
   // Get highest extended id
   __cpuid(cpu_info.data(), 0x80000000);
   highest_extended_valid_id = cpu_info[0];
@@ -176,6 +186,11 @@ bool RetrieveCPUInfo(int64_t* hardware_flags, std::string* model_name) {
   if (features_ECX[19]) *hardware_flags |= CpuInfo::SSE4_1;
   if (features_ECX[20]) *hardware_flags |= CpuInfo::SSE4_2;
   if (features_ECX[23]) *hardware_flags |= CpuInfo::POPCNT;
+  // Wide registers are only usable if the OS saves them (OSXSAVE)
+  if (features_ECX[27]) {
+    if (extended_features_EBX[5]) *hardware_flags |= CpuInfo::AVX2;
+    if (extended_features_EBX[16]) *hardware_flags |= CpuInfo::AVX512;
+  }
   return true;
 }
 #endif
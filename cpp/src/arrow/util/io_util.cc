@@ -65,7 +65,9 @@
 #undef Realloc
 #undef Free
 #else  // POSIX-like platforms
+#include <limits.h>
 #include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>
 #endif
 
@@ -1177,6 +1179,71 @@ Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes) {
   return Status::OK();
 }
 
+#if !defined(_WIN32)
+#if defined(IOV_MAX)
+static constexpr int kMaxIovecs = IOV_MAX;
+#else
+static constexpr int kMaxIovecs = 1024;
+#endif
+#endif
+
+Status FileWritev(int fd, const std::vector<util::string_view>& pieces) {
+#if defined(_WIN32)
+  for (const auto& piece : pieces) {
+    RETURN_NOT_OK(FileWrite(fd, reinterpret_cast<const uint8_t*>(piece.data()),
+                            static_cast<int64_t>(piece.size())));
+  }
+  return Status::OK();
+#else
+  std::vector<struct iovec> iov;
+  iov.reserve(pieces.size());
+  for (const auto& piece : pieces) {
+    if (piece.size() > 0) {
+      iov.push_back({const_cast<char*>(piece.data()), piece.size()});
+    }
+  }
+
+  size_t next = 0;
+  while (next < iov.size()) {
+    // Gather as many pieces as one call accepts, keeping the total below
+    // the per-call limit. A piece larger than the limit goes out on its own
+    // through FileWrite
+    if (iov[next].iov_len > static_cast<size_t>(ARROW_MAX_IO_CHUNKSIZE)) {
+      RETURN_NOT_OK(FileWrite(fd, reinterpret_cast<const uint8_t*>(iov[next].iov_base),
+                              static_cast<int64_t>(iov[next].iov_len)));
+      ++next;
+      continue;
+    }
+    size_t end = next;
+    size_t total = 0;
+    while (end < iov.size() && static_cast<int>(end - next) < kMaxIovecs &&
+           total + iov[end].iov_len <= static_cast<size_t>(ARROW_MAX_IO_CHUNKSIZE)) {
+      total += iov[end].iov_len;
+      ++end;
+    }
+
+    ssize_t ret = writev(fd, &iov[next], static_cast<int>(end - next));
+    if (ret == -1) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return Status::IOError("Error writing bytes to file: ", ErrnoMessage(errno));
+    }
+    // Skip the pieces written in full, and trim a partially written one
+    size_t written = static_cast<size_t>(ret);
+    while (written > 0 && written >= iov[next].iov_len) {
+      written -= iov[next].iov_len;
+      ++next;
+    }
+    if (written > 0) {
+      iov[next].iov_base = static_cast<uint8_t*>(iov[next].iov_base) + written;
+      iov[next].iov_len -= written;
+    }
+  }
+  return Status::OK();
+#endif
+}
+
 Status FileTruncate(int fd, const int64_t size) {
   int ret, errno_actual;
 
@@ -182,6 +182,9 @@ Status FileReadAt(int fd, uint8_t* buffer, int64_t position, int64_t nbytes,
                   int64_t* bytes_read);
 ARROW_EXPORT
 Status FileWrite(int fd, const uint8_t* buffer, const int64_t nbytes);
+/// Write several pieces of data in order, with as few writev() calls as possible
+ARROW_EXPORT
+Status FileWritev(int fd, const std::vector<util::string_view>& pieces);
 ARROW_EXPORT
 Status FileTruncate(int fd, const int64_t size);
 
@@ -0,0 +1,197 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#ifdef __linux__
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "arrow/util/numa.h"
+
+#include <cerrno>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "arrow/util/io_util.h"
+#include "arrow/util/logging.h"
+#include "arrow/util/parsing.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Parse a sysfs list of CPUs or nodes such as "0-3,8-11"
+std::vector<int> ParseSysfsList(const std::string& list) {
+  std::vector<int> ids;
+  std::stringstream ss(list);
+  std::string range;
+  StringConverter<Int32Type> converter;
+  while (std::getline(ss, range, ',')) {
+    const auto dash = range.find('-');
+    const std::string first_str = range.substr(0, dash);
+    const std::string last_str = dash == std::string::npos ? first_str
+                                                           : range.substr(dash + 1);
+    int32_t first, last;
+    if (!converter(first_str.data(), first_str.size(), &first) ||
+        !converter(last_str.data(), last_str.size(), &last) || first < 0) {
+      // Ignore malformed ranges
+      continue;
+    }
+    for (int id = first; id <= last; ++id) {
+      ids.push_back(id);
+    }
+  }
+  return ids;
+}
+
+#ifdef __linux__
+std::string ReadSysfsLine(const std::string& path) {
+  std::ifstream file(path);
+  std::string line;
+  std::getline(file, line);
+  return line;
+}
+#endif
+
+struct NumaTopology {
+  NumaTopology() {
+#ifdef __linux__
+    // Node ids may be sparse, e.g. after hot-unplugging a node
+    const std::string sysfs_dir = "/sys/devices/system/node/";
+    for (int id : ParseSysfsList(ReadSysfsLine(sysfs_dir + "online"))) {
+      std::vector<int> cpus = ParseSysfsList(
+          ReadSysfsLine(sysfs_dir + "node" + std::to_string(id) + "/cpulist"));
+      // Memory-only nodes have no CPUs, and nothing runs on them
+      if (cpus.empty()) {
+        continue;
+      }
+      for (int cpu : cpus) {
+        if (cpu >= static_cast<int>(cpu_nodes.size())) {
+          cpu_nodes.resize(cpu + 1, 0);
+        }
+        cpu_nodes[cpu] = static_cast<int>(node_cpus.size());
+      }
+      node_ids.push_back(id);
+      node_cpus.push_back(std::move(cpus));
+    }
+#endif
+    if (node_cpus.empty()) {
+      // Unknown topology: a single node with all CPUs
+      std::vector<int> cpus;
+      for (unsigned int cpu = 0; cpu < std::thread::hardware_concurrency(); ++cpu) {
+        cpus.push_back(static_cast<int>(cpu));
+      }
+      node_ids.push_back(0);
+      node_cpus.push_back(std::move(cpus));
+    }
+  }
+
+  // Indexed by node number, i.e. the rank of the node among those with CPUs
+  std::vector<int> node_ids;
+  std::vector<std::vector<int>> node_cpus;
+  // The node number of each CPU
+  std::vector<int> cpu_nodes;
+};
+
+const NumaTopology& GetTopology() {
+  static NumaTopology topology;
+  return topology;
+}
+
+}  // namespace
+
+int GetNumaNodeCount() { return static_cast<int>(GetTopology().node_cpus.size()); }
+
+std::vector<int> GetNumaNodeCpus(int node) {
+  const auto& topology = GetTopology();
+  if (node < 0 || node >= static_cast<int>(topology.node_cpus.size())) {
+    return {};
+  }
+  return topology.node_cpus[node];
+}
+
+int GetCurrentNumaNode() {
+#ifdef __linux__
+  const auto& topology = GetTopology();
+  const int cpu = sched_getcpu();
+  if (cpu >= 0 && cpu < static_cast<int>(topology.cpu_nodes.size())) {
+    return topology.cpu_nodes[cpu];
+  }
+#endif
+  return 0;
+}
+
+Status SetCurrentThreadAffinity(const std::vector<int>& cpus) {
+#ifdef __linux__
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (int cpu : cpus) {
+    if (cpu >= 0 && cpu < CPU_SETSIZE) {
+      CPU_SET(cpu, &cpu_set);
+    }
+  }
+  if (CPU_COUNT(&cpu_set) == 0) {
+    return Status::Invalid("No valid CPU to set thread affinity to");
+  }
+  const int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+  if (ret != 0) {
+    return Status::IOError("Failed to set thread affinity: ", ErrnoMessage(ret));
+  }
+  return Status::OK();
+#else
+  return Status::NotImplemented("Thread affinity is not supported on this platform");
+#endif
+}
+
+Status BindMemoryToNumaNode(void* addr, int64_t size, int node) {
+#if defined(__linux__) && defined(SYS_mbind)
+  // Call mbind() directly rather than depending on libnuma
+  constexpr int kMpolPreferred = 1;
+  constexpr int kMaxNodes = 1024;
+  const auto& topology = GetTopology();
+  if (node < 0 || node >= static_cast<int>(topology.node_ids.size())) {
+    return Status::Invalid("Invalid NUMA node: ", node);
+  }
+  // The OS id of the node
+  node = topology.node_ids[node];
+  if (node >= kMaxNodes) {
+    return Status::Invalid("Invalid NUMA node: ", node);
+  }
+  constexpr int kBitsPerWord = 8 * sizeof(unsigned long);  // NOLINT
+  unsigned long nodemask[kMaxNodes / kBitsPerWord] = {};   // NOLINT
+  nodemask[node / kBitsPerWord] = 1UL << (node % kBitsPerWord);
+  if (syscall(SYS_mbind, addr, static_cast<unsigned long>(size),  // NOLINT
+              kMpolPreferred, nodemask, kMaxNodes, 0) != 0) {
+    return Status::IOError("Failed to bind memory to NUMA node: ", ErrnoMessage(errno));
+  }
+  return Status::OK();
+#else
+  return Status::NotImplemented("NUMA memory binding is not supported on this platform");
+#endif
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,54 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Helpers for NUMA topology, thread affinity and memory placement.
+// They are implemented on Linux only; elsewhere the machine is presented
+// as a single node and affinity or binding requests return NotImplemented.
+// Nodes are numbered from 0 to GetNumaNodeCount() - 1 in the order of their
+// OS ids, skipping nodes without CPUs.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// Return the number of NUMA nodes with CPUs, at least 1
+ARROW_EXPORT int GetNumaNodeCount();
+
+/// Return the CPUs of the given NUMA node
+ARROW_EXPORT std::vector<int> GetNumaNodeCpus(int node);
+
+/// Return the NUMA node of the CPU the calling thread runs on, or 0 if unknown
+ARROW_EXPORT int GetCurrentNumaNode();
+
+/// Restrict the calling thread to run on the given CPUs
+ARROW_EXPORT Status SetCurrentThreadAffinity(const std::vector<int>& cpus);
+
+/// Ask the OS to place the pages of a memory range on the given NUMA node
+///
+/// The range must be page-aligned, e.g. mapped with mmap().  This is a
+/// preference: pages are placed elsewhere if the node runs out of memory.
+ARROW_EXPORT Status BindMemoryToNumaNode(void* addr, int64_t size, int node);
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,144 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "arrow/memory_pool.h"
+#include "arrow/status.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/numa.h"
+#include "arrow/util/task_group.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace internal {
+
+static uint64_t SumWords(const uint8_t* data, int64_t size) {
+  const auto words = reinterpret_cast<const uint64_t*>(data);
+  uint64_t total = 0;
+  for (int64_t i = 0; i < size / 8; ++i) {
+    total += words[i];
+  }
+  return total;
+}
+
+static std::vector<int> AllCpus() {
+  std::vector<int> cpus;
+  for (int node = 0; node < GetNumaNodeCount(); ++node) {
+    for (int cpu : GetNumaNodeCpus(node)) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+// Memory bandwidth reading a buffer placed on one node from another node
+static void NumaMemoryBandwidth(benchmark::State& state) {  // NOLINT non-const reference
+  const auto alloc_node = static_cast<int>(state.range(0));
+  const auto read_node = static_cast<int>(state.range(1));
+  const int64_t size = 256 << 20;
+
+  NumaMemoryPool pool(default_memory_pool());
+  uint8_t* data = nullptr;
+  std::thread allocator([&] {
+    ABORT_NOT_OK(SetCurrentThreadAffinity(GetNumaNodeCpus(alloc_node)));
+    ABORT_NOT_OK(pool.Allocate(size, &data));
+    std::memset(data, 1, size);
+  });
+  allocator.join();
+
+  ABORT_NOT_OK(SetCurrentThreadAffinity(GetNumaNodeCpus(read_node)));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(SumWords(data, size));
+  }
+  ABORT_NOT_OK(SetCurrentThreadAffinity(AllCpus()));
+
+  pool.Free(data, size);
+  state.SetBytesProcessed(state.iterations() * size);
+}
+
+// Tasks filling buffers, then summing them in follow-up tasks.
+// state.range(0) selects a regular thread pool and memory pool (0) or
+// NUMA-aware ones, with follow-up tasks hinted to stay on the node (1).
+static void NumaTaskGroupScan(benchmark::State& state) {  // NOLINT non-const reference
+  const bool numa_aware = state.range(0) != 0;
+  const int num_nodes = GetNumaNodeCount();
+  const int threads_per_node =
+      std::max(1, static_cast<int>(std::thread::hardware_concurrency()) / num_nodes);
+  const int64_t buffer_size = 4 << 20;
+  const int num_buffers = 64;
+
+  std::shared_ptr<ThreadPool> thread_pool;
+  std::unique_ptr<MemoryPool> numa_pool;
+  MemoryPool* pool = default_memory_pool();
+  if (numa_aware) {
+    ABORT_NOT_OK(ThreadPool::MakeNumaAware(std::vector<int>(num_nodes, threads_per_node),
+                                           &thread_pool));
+    numa_pool.reset(new NumaMemoryPool(pool));
+    pool = numa_pool.get();
+  } else {
+    ABORT_NOT_OK(ThreadPool::Make(threads_per_node * num_nodes, &thread_pool));
+  }
+
+  for (auto _ : state) {
+    auto task_group = TaskGroup::MakeThreaded(thread_pool.get());
+    std::atomic<uint64_t> total(0);
+    for (int i = 0; i < num_buffers; ++i) {
+      task_group->Append([&]() {
+        uint8_t* data;
+        RETURN_NOT_OK(pool->Allocate(buffer_size, &data));
+        std::memset(data, 1, buffer_size);
+        auto consume = [&, data]() {
+          total += SumWords(data, buffer_size);
+          pool->Free(data, buffer_size);
+          return Status::OK();
+        };
+        if (numa_aware) {
+          task_group->AppendLocal(consume);
+        } else {
+          task_group->Append(consume);
+        }
+        return Status::OK();
+      });
+    }
+    ABORT_NOT_OK(task_group->Finish());
+    benchmark::DoNotOptimize(total.load());
+  }
+  state.SetBytesProcessed(state.iterations() * num_buffers * buffer_size);
+}
+
+static void NumaNodePairs(benchmark::internal::Benchmark* b) {
+  for (int alloc_node = 0; alloc_node < GetNumaNodeCount(); ++alloc_node) {
+    for (int read_node = 0; read_node < GetNumaNodeCount(); ++read_node) {
+      b->Args({alloc_node, read_node});
+    }
+  }
+  b->ArgNames({"alloc_node", "read_node"});
+}
+
+BENCHMARK(NumaMemoryBandwidth)->Apply(NumaNodePairs);
+BENCHMARK(NumaTaskGroupScan)->Arg(0)->Arg(1)->UseRealTime();
+
+}  // namespace internal
+}  // namespace arrow
@@ -20,6 +20,7 @@
 #include <cstdint>
 #include <cstring>
 #include <random>
+#include <string>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -32,11 +33,16 @@
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/bpacking_simd_internal.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/rle_encoding.h"
 
 namespace arrow {
 namespace util {
 
+using ::arrow::internal::CpuInfo;
+
 const int MAX_WIDTH = 32;
 
 TEST(BitArray, TestBool) {
@@ -174,6 +180,54 @@ TEST(BitArray, TestMixed) {
   }
 }
 
+// Checks an unpack32 implementation against the scalar one, with an input
+// buffer sized exactly to the packed data, starting `offset` words into it
+void CheckUnpack32(int (*unpack)(const uint32_t*, uint32_t*, int, int),
+                   int offset = 0) {
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<uint32_t> dist;
+  for (int num_bits = 0; num_bits <= MAX_WIDTH; ++num_bits) {
+    for (int batch_size : {32, 64, 96, 1024, 1056}) {
+      SCOPED_TRACE("num_bits = " + std::to_string(num_bits) +
+                   ", batch_size = " + std::to_string(batch_size));
+      std::vector<uint32_t> packed(offset + batch_size * num_bits / 32);
+      for (auto& word : packed) {
+        word = dist(gen);
+      }
+      const uint32_t* in = packed.data() + offset;
+      std::vector<uint32_t> expected(batch_size), actual(batch_size);
+      ASSERT_EQ(batch_size, ::arrow::internal::unpack32_default(in, expected.data(),
+                                                                batch_size, num_bits));
+      ASSERT_EQ(batch_size, unpack(in, actual.data(), batch_size, num_bits));
+      ASSERT_EQ(expected, actual);
+    }
+  }
+}
+
+TEST(BitArray, Unpack32) { CheckUnpack32(::arrow::internal::unpack32); }
+
+// The SIMD implementations are tested directly, as unpack32 only dispatches
+// to the widest one the CPU supports.  They must handle unaligned input.
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+TEST(BitArray, Unpack32Avx2) {
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2)) {
+    return;
+  }
+  CheckUnpack32(::arrow::internal::unpack32_avx2);
+  CheckUnpack32(::arrow::internal::unpack32_avx2, /*offset=*/1);
+}
+#endif
+
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+TEST(BitArray, Unpack32Avx512) {
+  if (!CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX512)) {
+    return;
+  }
+  CheckUnpack32(::arrow::internal::unpack32_avx512);
+  CheckUnpack32(::arrow::internal::unpack32_avx512, /*offset=*/1);
+}
+#endif
+
 // Validates encoding of values by encoding and decoding them.  If
 // expected_encoding != NULL, also validates that the encoded buffer is
 // exactly 'expected_encoding'.
@@ -20,8 +20,10 @@
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
@@ -76,7 +78,7 @@ class SerialTaskGroup : public TaskGroup {
 class ThreadedTaskGroup : public TaskGroup {
  public:
   explicit ThreadedTaskGroup(ThreadPool* thread_pool)
-      : thread_pool_(thread_pool), nremaining_(0), ok_(true) {}
+      : thread_pool_(thread_pool), nremaining_(0), ok_(true), nwaiters_(0) {}
 
   ~ThreadedTaskGroup() override {
     // Make sure all pending tasks are finished, so that dangling references
@@ -85,22 +87,11 @@ class ThreadedTaskGroup : public TaskGroup {
   }
 
   void AppendReal(std::function<Status()> task) override {
-    // The hot path is unlocked thanks to atomics
-    // Only if an error occurs is the lock taken
-    if (ok_.load(std::memory_order_acquire)) {
-      nremaining_.fetch_add(1, std::memory_order_acquire);
+    AppendTask(std::move(task), /*local=*/false);
+  }
 
-      auto self = checked_pointer_cast<ThreadedTaskGroup>(shared_from_this());
-      Status st = thread_pool_->Spawn([self, task]() {
-        if (self->ok_.load(std::memory_order_acquire)) {
-          // XXX what about exceptions?
-          Status st = task();
-          self->UpdateStatus(std::move(st));
-        }
-        self->OneTaskDone();
-      });
-      UpdateStatus(std::move(st));
-    }
+  void AppendLocalReal(std::function<Status()> task) override {
+    AppendTask(std::move(task), /*local=*/true);
   }
 
   Status current_status() override {
@@ -113,7 +104,22 @@ class ThreadedTaskGroup : public TaskGroup {
   Status Finish() override {
     std::unique_lock<std::mutex> lock(mutex_);
     if (!finished_) {
-      cv_.wait(lock, [&]() { return nremaining_.load() == 0; });
+      // Rather than blocking, help running the pending tasks of this group
+      // and its subgroups.  When Finish() is called from a pool thread,
+      // this keeps it busy and avoids deadlocking if all pool threads are
+      // waiting on nested groups.
+      nwaiters_.fetch_add(1);
+      while (nremaining_.load() != 0) {
+        lock.unlock();
+        const bool ran_task = RunPendingTask();
+        lock.lock();
+        if (!ran_task) {
+          // Nothing to run; wait for a new task or for the remaining tasks
+          // to be finished by other threads
+          cv_.wait(lock, [&]() { return nremaining_.load() == 0 || HasPendingTasks(); });
+        }
+      }
+      nwaiters_.fetch_sub(1);
       // Current tasks may start other tasks, so only set this when done
       finished_ = true;
       if (parent_) {
@@ -127,13 +133,45 @@ class ThreadedTaskGroup : public TaskGroup {
 
   std::shared_ptr<TaskGroup> MakeSubGroup() override {
     std::lock_guard<std::mutex> lock(mutex_);
-    auto child = new ThreadedTaskGroup(thread_pool_);
+    auto child = std::shared_ptr<ThreadedTaskGroup>(new ThreadedTaskGroup(thread_pool_));
     child->parent_ = this;
     nremaining_.fetch_add(1, std::memory_order_acquire);
-    return std::shared_ptr<TaskGroup>(child);
+    {
+      std::lock_guard<std::mutex> queue_lock(queue_mutex_);
+      subgroups_.push_back(child);
+    }
+    return std::move(child);
   }
 
  protected:
+  void AppendTask(std::function<Status()> task, bool local) {
+    // The hot path is unlocked thanks to atomics
+    // Only if an error occurs is the lock taken
+    if (ok_.load(std::memory_order_acquire)) {
+      nremaining_.fetch_add(1, std::memory_order_acquire);
+
+      // The task is queued in the group, and a pool task spawned to run
+      // it.  A thread waiting in Finish() may run it first, in which case
+      // the pool task finds nothing to do.
+      {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        pending_tasks_.push_back(std::move(task));
+      }
+      NotifyWaiters();
+
+      auto self = checked_pointer_cast<ThreadedTaskGroup>(shared_from_this());
+      auto run_pending = [self]() {
+        std::function<Status()> task;
+        if (self->TakeOwnTask(&task)) {
+          self->RunTask(task);
+        }
+      };
+      Status st = local ? thread_pool_->SpawnLocal(std::move(run_pending))
+                        : thread_pool_->Spawn(std::move(run_pending));
+      UpdateStatus(std::move(st));
+    }
+  }
+
   void UpdateStatus(Status&& st) {
     // Must be called unlocked, only locks on error
     if (ARROW_PREDICT_FALSE(!st.ok())) {
@@ -149,16 +187,112 @@ class ThreadedTaskGroup : public TaskGroup {
     DCHECK_GE(nremaining, 0);
     if (nremaining == 0) {
       // Take the lock so that ~ThreadedTaskGroup cannot destroy cv
-      // before cv.notify_one() has returned
+      // before cv.notify_all() has returned
       std::unique_lock<std::mutex> lock(mutex_);
-      cv_.notify_one();
+      cv_.notify_all();
+    }
+  }
+
+  void RunTask(const std::function<Status()>& task) {
+    if (ok_.load(std::memory_order_acquire)) {
+      // XXX what about exceptions?
+      Status st = task();
+      UpdateStatus(std::move(st));
+    }
+    OneTaskDone();
+  }
+
+  // Run a pending task of this group or its subgroups, if any
+  bool RunPendingTask() {
+    std::function<Status()> task;
+    std::shared_ptr<ThreadedTaskGroup> holder;
+    ThreadedTaskGroup* group = TakeTask(&task, &holder);
+    if (group == nullptr) {
+      return false;
     }
+    group->RunTask(task);
+    return true;
+  }
+
+  // Wake up threads waiting in Finish() on this group or its parents, as a
+  // new task is available to them.  Since AppendReal() queues the task
+  // before checking for waiters, and Finish() registers as a waiter before
+  // checking for tasks, no wakeup is lost.
+  void NotifyWaiters() {
+    for (ThreadedTaskGroup* group = this; group != nullptr; group = group->parent_) {
+      if (group->nwaiters_.load() > 0) {
+        std::lock_guard<std::mutex> lock(group->mutex_);
+        group->cv_.notify_all();
+      }
+    }
+  }
+
+  bool TakeOwnTask(std::function<Status()>* out) {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    if (pending_tasks_.empty()) {
+      return false;
+    }
+    *out = std::move(pending_tasks_.front());
+    pending_tasks_.pop_front();
+    return true;
+  }
+
+  std::vector<std::shared_ptr<ThreadedTaskGroup>> LiveSubGroups() {
+    std::lock_guard<std::mutex> lock(queue_mutex_);
+    std::vector<std::shared_ptr<ThreadedTaskGroup>> out;
+    auto it = subgroups_.begin();
+    while (it != subgroups_.end()) {
+      auto subgroup = it->lock();
+      if (subgroup) {
+        out.push_back(std::move(subgroup));
+        ++it;
+      } else {
+        it = subgroups_.erase(it);
+      }
+    }
+    return out;
+  }
+
+  // Take a pending task of this group or its subgroups, and return the group
+  // it belongs to.  A subgroup is kept alive through `holder`.
+  ThreadedTaskGroup* TakeTask(std::function<Status()>* out,
+                              std::shared_ptr<ThreadedTaskGroup>* holder) {
+    if (TakeOwnTask(out)) {
+      return this;
+    }
+    for (auto& subgroup : LiveSubGroups()) {
+      ThreadedTaskGroup* group = subgroup->TakeTask(out, holder);
+      if (group != nullptr) {
+        if (group == subgroup.get()) {
+          *holder = std::move(subgroup);
+        }
+        return group;
+      }
+    }
+    return nullptr;
+  }
+
+  bool HasPendingTasks() {
+    {
+      std::lock_guard<std::mutex> lock(queue_mutex_);
+      if (!pending_tasks_.empty()) {
+        return true;
+      }
+    }
+    for (const auto& subgroup : LiveSubGroups()) {
+      if (subgroup->HasPendingTasks()) {
+        return true;
+      }
+    }
+    return false;
   }
 
   // These members are usable unlocked
   ThreadPool* thread_pool_;
   std::atomic<int32_t> nremaining_;
   std::atomic<bool> ok_;
+  // Number of threads waiting in Finish()
+  std::atomic<int32_t> nwaiters_;
 
   // These members use locking
   std::mutex mutex_;
@@ -166,6 +300,12 @@ class ThreadedTaskGroup : public TaskGroup {
   Status status_;
   bool finished_ = false;
   ThreadedTaskGroup* parent_ = nullptr;
+
+  // These members are protected by queue_mutex_, which is never held
+  // while taking another lock
+  std::mutex queue_mutex_;
+  std::deque<std::function<Status()>> pending_tasks_;
+  std::vector<std::weak_ptr<ThreadedTaskGroup>> subgroups_;
 };
 
 std::shared_ptr<TaskGroup> TaskGroup::MakeSerial() {
@@ -49,10 +49,22 @@ class ARROW_EXPORT TaskGroup : public std::enable_shared_from_this<TaskGroup> {
     return AppendReal(std::forward<Function>(func));
   }
 
+  /// Same as Append(), hinting that the function should run on the same
+  /// NUMA node as the caller, e.g. because it processes data the caller
+  /// has just allocated.  See ThreadPool::SpawnLocal().
+  template <typename Function>
+  void AppendLocal(Function&& func) {
+    return AppendLocalReal(std::forward<Function>(func));
+  }
+
   /// Wait for execution of all tasks (and subgroups) to be finished,
   /// or for at least one task (or subgroup) to error out.
   /// The returned Status propagates the error status of the first failing
   /// task (or subgroup).
+  ///
+  /// While waiting, the calling thread runs pending tasks of this group
+  /// and its subgroups.  It is therefore safe to call Finish() from a task
+  /// running on the same thread pool, e.g. for nested parallelism.
   virtual Status Finish() = 0;
 
   /// The current agregate error Status.  Non-blocking, useful for stopping early.
@@ -83,6 +95,9 @@ class ARROW_EXPORT TaskGroup : public std::enable_shared_from_this<TaskGroup> {
   ARROW_DISALLOW_COPY_AND_ASSIGN(TaskGroup);
 
   virtual void AppendReal(std::function<Status()> task) = 0;
+  virtual void AppendLocalReal(std::function<Status()> task) {
+    AppendReal(std::move(task));
+  }
 };
 
 }  // namespace internal
@@ -28,6 +28,7 @@
 
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
+#include "arrow/util/numa.h"
 #include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
 
@@ -212,6 +213,35 @@ void TestTasksSpawnTasks(std::shared_ptr<TaskGroup> task_group) {
   ASSERT_EQ(count.load(), (1 << (N + 1)) - 1);
 }
 
+// Tasks that run nested task groups and wait for them.  Since Finish()
+// runs pending tasks, this doesn't deadlock even when all pool threads are
+// waiting.
+void TestNestedTaskGroups(ThreadPool* thread_pool) {
+  const int NOUTER = 8;
+  const int NINNER = 20;
+
+  auto task_group = TaskGroup::MakeThreaded(thread_pool);
+  std::atomic<int> count(0);
+  for (int i = 0; i < NOUTER; ++i) {
+    task_group->Append([&, i]() {
+      // Alternate between independent groups and subgroups
+      auto inner_group = (i % 2 == 0) ? TaskGroup::MakeThreaded(thread_pool)
+                                      : task_group->MakeSubGroup();
+      for (int j = 0; j < NINNER; ++j) {
+        inner_group->Append([&]() {
+          sleep_for(1e-4);
+          count++;
+          return Status::OK();
+        });
+      }
+      return inner_group->Finish();
+    });
+  }
+
+  ASSERT_OK(task_group->Finish());
+  ASSERT_EQ(count.load(), NOUTER * NINNER);
+}
+
 // A task that keeps recursing until a barrier is set.
 // Using a lambda for this doesn't play well with Thread Sanitizer.
 struct BarrierTask {
@@ -328,6 +358,75 @@ TEST(ThreadedTaskGroup, SubGroupsErrors) {
   TestTaskSubGroupsErrors(TaskGroup::MakeThreaded(thread_pool.get()));
 }
 
+TEST(ThreadedTaskGroup, AppendLocal) {
+  std::shared_ptr<ThreadPool> thread_pool;
+  ASSERT_OK(ThreadPool::MakeNumaAware(std::vector<int>(GetNumaNodeCount(), 2),
+                                      &thread_pool));
+
+  // Tasks processing data produced by other tasks hint to stay on their node
+  auto task_group = TaskGroup::MakeThreaded(thread_pool.get());
+  std::atomic<int> count(0);
+  for (int i = 0; i < 50; ++i) {
+    task_group->Append([&]() {
+      task_group->AppendLocal([&]() {
+        count++;
+        return Status::OK();
+      });
+      return Status::OK();
+    });
+  }
+  ASSERT_OK(task_group->Finish());
+  ASSERT_EQ(count.load(), 50);
+
+  task_group = TaskGroup::MakeSerial();
+  task_group->AppendLocal([&]() {
+    count++;
+    return Status::OK();
+  });
+  ASSERT_OK(task_group->Finish());
+  ASSERT_EQ(count.load(), 51);
+}
+
+TEST(ThreadedTaskGroup, NestedTaskGroups) {
+  for (int threads : {1, 2, 8}) {
+    std::shared_ptr<ThreadPool> thread_pool;
+    ASSERT_OK(ThreadPool::Make(threads, &thread_pool));
+
+    TestNestedTaskGroups(thread_pool.get());
+  }
+}
+
+TEST(ThreadedTaskGroup, FinishRunsSubGroupTasks) {
+  // A single pool thread is kept busy, so the main thread must run the
+  // tasks of the group and its subgroups itself
+  std::shared_ptr<ThreadPool> thread_pool;
+  ASSERT_OK(ThreadPool::Make(1, &thread_pool));
+  std::atomic<bool> barrier(false);
+  ASSERT_OK(thread_pool->Spawn([&]() {
+    while (!barrier.load()) {
+      sleep_for(1e-4);
+    }
+  }));
+
+  auto task_group = TaskGroup::MakeThreaded(thread_pool.get());
+  auto subgroup = task_group->MakeSubGroup();
+  std::atomic<int> count(0);
+  auto task = [&]() {
+    count++;
+    return Status::OK();
+  };
+  task_group->Append(task);
+  subgroup->Append(task);
+  subgroup->Append(task);
+  ASSERT_OK(subgroup->Finish());
+  ASSERT_EQ(count.load(), 2);
+  ASSERT_OK(task_group->Finish());
+  ASSERT_EQ(count.load(), 3);
+
+  barrier.store(true);
+  ASSERT_OK(thread_pool->Shutdown());
+}
+
 TEST(ThreadedTaskGroup, StressTaskGroupLifetime) {
   std::shared_ptr<ThreadPool> thread_pool;
   ASSERT_OK(ThreadPool::Make(16, &thread_pool));
@@ -18,6 +18,7 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <list>
@@ -28,16 +29,93 @@
 
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/numa.h"
+#include "arrow/util/parsing.h"
 
 namespace arrow {
 namespace internal {
 
-struct ThreadPool::State {
-  State() : desired_capacity_(0), please_shutdown_(false), quick_shutdown_(false) {}
+namespace {
+
+// A worker's task queue.  The owner pushes and pops at the back (LIFO, for
+// cache locality of nested tasks) while thieves take from the front (FIFO,
+// taking the oldest and typically largest tasks).  Each queue has its own
+// lock, so the owner and submitters only contend when they hit the same queue.
+struct WorkerQueue {
+  WorkerQueue() : node_(-1) {}
+
+  bool PopBack(std::function<void()>* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto tasks : {&local_tasks_, &tasks_}) {
+      if (!tasks->empty()) {
+        *out = std::move(tasks->back());
+        tasks->pop_back();
+        return true;
+      }
+    }
+    return false;
+  }
 
-  // NOTE: in case locking becomes too expensive, we can investigate lock-free FIFOs
-  // such as https://github.com/cameron314/concurrentqueue
+  bool PopFront(bool take_local, bool take_other, std::function<void()>* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (take_local && !local_tasks_.empty()) {
+      *out = std::move(local_tasks_.front());
+      local_tasks_.pop_front();
+      return true;
+    }
+    if (take_other && !tasks_.empty()) {
+      *out = std::move(tasks_.front());
+      tasks_.pop_front();
+      return true;
+    }
+    return false;
+  }
 
+  std::mutex mutex_;
+  std::deque<std::function<void()>> tasks_;
+  // Tasks spawned with SpawnLocal()
+  std::deque<std::function<void()>> local_tasks_;
+  // The NUMA node of the owner, or -1
+  std::atomic<int> node_;
+  // Avoid false sharing between adjacent queues
+  char padding_[64];
+};
+
+// The maximum number of task queues.  Workers beyond this number share
+// queues, which is correct but contended.
+constexpr int kMaxQueues = 256;
+
+}  // namespace
+
+struct ThreadPool::State {
+  State()
+      : queues_(new WorkerQueue[kMaxQueues]),
+        num_queues_(1),
+        next_queue_(0),
+        num_pending_(0),
+        num_sleeping_(0),
+        num_workers_(0),
+        desired_capacity_(0),
+        num_spawning_(0),
+        please_shutdown_(false),
+        quick_shutdown_(false) {}
+
+  // Push a task to the calling worker's own queue if it belongs to this pool,
+  // otherwise to the queues in round-robin order (restricted to workers on
+  // the caller's NUMA node for local tasks)
+  void PushTask(std::function<void()> task, bool local);
+  // Pop a task from the given worker's queue, or steal one from other queues
+  bool TakeTask(int slot, std::function<void()>* out);
+  // Discard all queued tasks
+  void ClearTasks();
+
+  // The NUMA node of the worker in the given slot, or -1
+  int NodeForSlot(int slot) const;
+
+  bool ShouldSecede() const { return num_workers_.load() > desired_capacity_.load(); }
+
+  // The mutex protects the set of workers and is used for sleeping and
+  // waking them up, but not for queueing tasks
   std::mutex mutex_;
   std::condition_variable cv_;
   std::condition_variable cv_shutdown_;
@@ -45,19 +123,143 @@ struct ThreadPool::State {
   std::list<std::thread> workers_;
   // Trashcan for finished threads
   std::vector<std::thread> finished_workers_;
-  std::deque<std::function<void()>> pending_tasks_;
+  // Which queue slots are owned by a running worker
+  std::vector<bool> used_slots_;
+
+  // Number of workers pinned to each NUMA node, empty if not NUMA-aware.
+  // This is set at construction.
+  std::vector<int> node_capacities_;
+
+  std::unique_ptr<WorkerQueue[]> queues_;
+  // Number of queues in use; only grows so that tasks in the queue of a
+  // seceded worker can still be stolen
+  std::atomic<int> num_queues_;
+  std::atomic<uint32_t> next_queue_;
+  // Number of queued tasks, across all queues
+  std::atomic<int64_t> num_pending_;
+  // Number of workers waiting on cv_
+  std::atomic<int> num_sleeping_;
+  // Same as workers_.size(), readable without the mutex
+  std::atomic<int> num_workers_;
 
   // Desired number of threads
-  int desired_capacity_;
+  std::atomic<int> desired_capacity_;
+  // Number of SpawnReal() calls that passed the shutdown check but may not
+  // have queued their task yet
+  std::atomic<int> num_spawning_;
   // Are we shutting down?
-  bool please_shutdown_;
-  bool quick_shutdown_;
+  std::atomic<bool> please_shutdown_;
+  std::atomic<bool> quick_shutdown_;
 };
 
+namespace {
+
+// The pool state and queue slot of the current thread, if it is a worker
+thread_local ThreadPool::State* current_state = NULLPTR;
+thread_local int current_slot = -1;
+
+}  // namespace
+
+void ThreadPool::State::PushTask(std::function<void()> task, bool local) {
+  int slot = -1;
+  if (current_state == this) {
+    slot = current_slot;
+  } else if (local && !node_capacities_.empty()) {
+    const int node = GetCurrentNumaNode();
+    const int num_queues = num_queues_.load();
+    const uint32_t start = next_queue_.fetch_add(1);
+    for (int i = 0; i < num_queues; ++i) {
+      const int candidate = static_cast<int>((start + i) % num_queues);
+      if (queues_[candidate].node_ == node) {
+        slot = candidate;
+        break;
+      }
+    }
+  }
+  if (slot < 0) {
+    slot = static_cast<int>(next_queue_.fetch_add(1) % num_queues_.load());
+  }
+  {
+    WorkerQueue& queue = queues_[slot];
+    std::lock_guard<std::mutex> lock(queue.mutex_);
+    (local ? queue.local_tasks_ : queue.tasks_).push_back(std::move(task));
+  }
+  // The task must be queued before it is counted, and counted before
+  // checking for sleepers (see the wait in WorkerLoop)
+  num_pending_.fetch_add(1);
+  if (num_sleeping_.load() > 0) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    cv_.notify_one();
+  }
+}
+
+bool ThreadPool::State::TakeTask(int slot, std::function<void()>* out) {
+  if (num_pending_.load() == 0) {
+    return false;
+  }
+  if (queues_[slot].PopBack(out)) {
+    num_pending_.fetch_sub(1);
+    return true;
+  }
+  // Steal from workers of the same node first.  Then from workers of other
+  // nodes, taking their local tasks only as a last resort.
+  const int node = queues_[slot].node_;
+  const int num_passes = node_capacities_.empty() ? 1 : 3;
+  const int num_queues = num_queues_.load();
+  for (int pass = 0; pass < num_passes; ++pass) {
+    for (int i = 1; i < num_queues; ++i) {
+      WorkerQueue& queue = queues_[(slot + i) % num_queues];
+      if ((queue.node_ == node) != (pass == 0)) {
+        continue;
+      }
+      if (queue.PopFront(/*take_local=*/pass != 1, /*take_other=*/pass != 2, out)) {
+        num_pending_.fetch_sub(1);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void ThreadPool::State::ClearTasks() {
+  for (int i = 0; i < num_queues_.load(); ++i) {
+    WorkerQueue& queue = queues_[i];
+    std::lock_guard<std::mutex> lock(queue.mutex_);
+    num_pending_.fetch_sub(
+        static_cast<int64_t>(queue.tasks_.size() + queue.local_tasks_.size()));
+    queue.tasks_.clear();
+    queue.local_tasks_.clear();
+  }
+}
+
+int ThreadPool::State::NodeForSlot(int slot) const {
+  if (node_capacities_.empty()) {
+    return -1;
+  }
+  int first_slot = 0;
+  for (size_t node = 0; node < node_capacities_.size(); ++node) {
+    first_slot += node_capacities_[node];
+    if (slot < first_slot) {
+      return static_cast<int>(node);
+    }
+  }
+  // Workers beyond the initial capacity
+  return slot % static_cast<int>(node_capacities_.size());
+}
+
 // The worker loop is an independent function so that it can keep running
 // after the ThreadPool is destroyed.
 static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
-                       std::list<std::thread>::iterator it) {
+                       std::list<std::thread>::iterator it, int slot) {
+  const int queue_slot = slot % kMaxQueues;
+  current_state = state.get();
+  current_slot = queue_slot;
+  const int node = state->NodeForSlot(slot);
+  if (node >= 0) {
+    // Pinning is best effort, e.g. a cgroup may forbid the node's CPUs
+    ARROW_UNUSED(SetCurrentThreadAffinity(GetNumaNodeCpus(node)));
+  }
+
   std::unique_lock<std::mutex> lock(state->mutex_);
 
   // Since we hold the lock, `it` now points to the correct thread object
@@ -74,27 +276,45 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
     // or shutdown could even have been requested.  So we only wait on the
     // condition variable at the end of the loop.
 
-    // Execute pending tasks if any
-    while (!state->pending_tasks_.empty() && !state->quick_shutdown_) {
-      // We check this opportunistically at each loop iteration since
-      // it releases the lock below.
-      if (should_secede()) {
+    // Execute pending tasks if any, without holding the lock
+    lock.unlock();
+    while (!state->quick_shutdown_ && !state->ShouldSecede()) {
+      std::function<void()> task;
+      if (!state->TakeTask(queue_slot, &task)) {
         break;
       }
-      {
-        std::function<void()> task = std::move(state->pending_tasks_.front());
-        state->pending_tasks_.pop_front();
-        lock.unlock();
-        task();
-      }
+      task();
+    }
+    lock.lock();
+
+    // Now either the queues are empty, a quick shutdown was requested
+    // or we should secede
+    if (state->quick_shutdown_ || should_secede()) {
+      break;
+    }
+    // Check for spawns in progress after the shutdown request and before the
+    // pending tasks: a task spawned before the request is then seen as
+    // either in progress or pending
+    const bool shutting_down = state->please_shutdown_;
+    if ((shutting_down && state->num_spawning_ > 0) || state->num_pending_ > 0) {
+      // A task was queued in the meantime or is about to be, or another
+      // worker is about to take it
+      lock.unlock();
+      std::this_thread::yield();
       lock.lock();
+      continue;
     }
-    // Now either the queue is empty *or* a quick shutdown was requested
-    if (state->please_shutdown_ || should_secede()) {
+    if (shutting_down) {
       break;
     }
-    // Wait for next wakeup
-    state->cv_.wait(lock);
+    // Wait for next wakeup.  Since PushTask() counts the task before
+    // checking for sleepers, either it sees us sleeping and notifies us
+    // under the lock, or we see the task.
+    ++state->num_sleeping_;
+    state->cv_.wait(lock, [&] {
+      return state->num_pending_ > 0 || state->please_shutdown_ || should_secede();
+    });
+    --state->num_sleeping_;
   }
 
   // We're done.  Move our thread object to the trashcan of finished
@@ -107,6 +327,13 @@ static void WorkerLoop(std::shared_ptr<ThreadPool::State> state,
   DCHECK_EQ(std::this_thread::get_id(), it->get_id());
   state->finished_workers_.push_back(std::move(*it));
   state->workers_.erase(it);
+  --state->num_workers_;
+  state->used_slots_[slot] = false;
+  current_state = NULLPTR;
+  if (state->num_pending_ > 0) {
+    // Hand over the tasks left in our queue
+    state->cv_.notify_all();
+  }
   if (state->please_shutdown_) {
     // Notify the function waiting in Shutdown().
     state->cv_shutdown_.notify_one();
@@ -139,8 +366,9 @@ void ThreadPool::ProtectAgainstFork() {
     int capacity = state_->desired_capacity_;
 
     auto new_state = std::make_shared<ThreadPool::State>();
-    new_state->please_shutdown_ = state_->please_shutdown_;
-    new_state->quick_shutdown_ = state_->quick_shutdown_;
+    new_state->node_capacities_ = state_->node_capacities_;
+    new_state->please_shutdown_ = state_->please_shutdown_.load();
+    new_state->quick_shutdown_ = state_->quick_shutdown_.load();
 
     pid_ = current_pid;
     sp_state_ = new_state;
@@ -199,10 +427,17 @@ Status ThreadPool::Shutdown(bool wait) {
   state_->quick_shutdown_ = !wait;
   state_->cv_.notify_all();
   state_->cv_shutdown_.wait(lock, [this] { return state_->workers_.empty(); });
+  // With a quick shutdown, let spawns in progress queue their task before
+  // discarding the queued tasks
+  while (state_->num_spawning_ > 0) {
+    lock.unlock();
+    std::this_thread::yield();
+    lock.lock();
+  }
   if (!state_->quick_shutdown_) {
-    DCHECK_EQ(state_->pending_tasks_.size(), 0);
+    DCHECK_EQ(state_->num_pending_, 0);
   } else {
-    state_->pending_tasks_.clear();
+    state_->ClearTasks();
   }
   CollectFinishedWorkersUnlocked();
   return Status::OK();
@@ -220,23 +455,42 @@ void ThreadPool::LaunchWorkersUnlocked(int threads) {
   std::shared_ptr<State> state = sp_state_;
 
   for (int i = 0; i < threads; i++) {
+    // Take the first free queue slot
+    auto& used_slots = state_->used_slots_;
+    auto slot_it = std::find(used_slots.begin(), used_slots.end(), false);
+    const int slot = static_cast<int>(slot_it - used_slots.begin());
+    if (slot_it == used_slots.end()) {
+      used_slots.push_back(true);
+    } else {
+      *slot_it = true;
+    }
+    if (slot < kMaxQueues) {
+      state_->queues_[slot].node_ = state_->NodeForSlot(slot);
+      if (slot >= state_->num_queues_) {
+        state_->num_queues_ = slot + 1;
+      }
+    }
+
     state_->workers_.emplace_back();
+    ++state_->num_workers_;
     auto it = --(state_->workers_.end());
-    *it = std::thread([state, it] { WorkerLoop(state, it); });
+    *it = std::thread([state, it, slot] { WorkerLoop(state, it, slot); });
   }
 }
 
-Status ThreadPool::SpawnReal(std::function<void()> task) {
-  {
-    ProtectAgainstFork();
-    std::lock_guard<std::mutex> lock(state_->mutex_);
-    if (state_->please_shutdown_) {
-      return Status::Invalid("operation forbidden during or after shutdown");
-    }
-    CollectFinishedWorkersUnlocked();
-    state_->pending_tasks_.push_back(std::move(task));
+Status ThreadPool::SpawnReal(std::function<void()> task, bool local) {
+  // Finished workers are collected by SetCapacity() and Shutdown(), so as
+  // not to take the pool-wide lock here
+  ProtectAgainstFork();
+  // Announce the spawn before checking for shutdown, so that either
+  // Shutdown() waits for the task to be queued, or the spawn fails
+  ++state_->num_spawning_;
+  if (state_->please_shutdown_) {
+    --state_->num_spawning_;
+    return Status::Invalid("operation forbidden during or after shutdown");
   }
-  state_->cv_.notify_one();
+  state_->PushTask(std::move(task), local);
+  --state_->num_spawning_;
   return Status::OK();
 }
 
@@ -247,6 +501,27 @@ Status ThreadPool::Make(int threads, std::shared_ptr<ThreadPool>* out) {
   return Status::OK();
 }
 
+Status ThreadPool::MakeNumaAware(const std::vector<int>& threads_per_node,
+                                 std::shared_ptr<ThreadPool>* out) {
+  const int num_nodes = GetNumaNodeCount();
+  if (threads_per_node.empty() || static_cast<int>(threads_per_node.size()) > num_nodes) {
+    return Status::Invalid("Expected thread counts for 1 to ", num_nodes,
+                           " NUMA nodes, got ", threads_per_node.size());
+  }
+  int threads = 0;
+  for (int node_threads : threads_per_node) {
+    if (node_threads < 0) {
+      return Status::Invalid("Thread counts per NUMA node must be >= 0");
+    }
+    threads += node_threads;
+  }
+  auto pool = std::shared_ptr<ThreadPool>(new ThreadPool());
+  pool->state_->node_capacities_ = threads_per_node;
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  *out = std::move(pool);
+  return Status::OK();
+}
+
 // ----------------------------------------------------------------------
 // Global thread pool
 
@@ -287,9 +562,9 @@ int ThreadPool::DefaultCapacity() {
 }
 
 // Helper for the singleton pattern
-std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
+std::shared_ptr<ThreadPool> ThreadPool::MakeGlobalThreadPool(int threads) {
   std::shared_ptr<ThreadPool> pool;
-  ARROW_CHECK_OK(ThreadPool::Make(ThreadPool::DefaultCapacity(), &pool));
+  ARROW_CHECK_OK(ThreadPool::Make(threads, &pool));
   // On Windows, the global ThreadPool destructor may be called after
   // non-main threads have been killed by the OS, and hang in a condition
   // variable.
@@ -300,11 +575,43 @@ std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
   return pool;
 }
 
+std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
+  return MakeGlobalThreadPool(ThreadPool::DefaultCapacity());
+}
+
+// I/O threads mostly wait on the storage, so their number does not follow
+// the number of cores
+static constexpr int kDefaultIOThreadPoolCapacity = 8;
+
+int ThreadPool::DefaultIOCapacity() {
+  std::string str;
+  if (GetEnvVar("ARROW_IO_THREADS", &str).ok()) {
+    // Unlike std::stoi(), reject trailing garbage and out of range values
+    StringConverter<Int32Type> converter;
+    int32_t capacity;
+    if (converter(str.data(), str.size(), &capacity) && capacity > 0) {
+      return capacity;
+    }
+    ARROW_LOG(WARNING) << "ARROW_IO_THREADS does not contain a valid number of threads: '"
+                       << str << "'";
+  }
+  return kDefaultIOThreadPoolCapacity;
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::MakeIOThreadPool() {
+  return MakeGlobalThreadPool(ThreadPool::DefaultIOCapacity());
+}
+
 ThreadPool* GetCpuThreadPool() {
   static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeCpuThreadPool();
   return singleton.get();
 }
 
+ThreadPool* GetIOThreadPool() {
+  static std::shared_ptr<ThreadPool> singleton = ThreadPool::MakeIOThreadPool();
+  return singleton.get();
+}
+
 }  // namespace internal
 
 int GetCpuThreadPoolCapacity() { return internal::GetCpuThreadPool()->GetCapacity(); }
@@ -313,4 +620,10 @@ Status SetCpuThreadPoolCapacity(int threads) {
   return internal::GetCpuThreadPool()->SetCapacity(threads);
 }
 
+int GetIOThreadPoolCapacity() { return internal::GetIOThreadPool()->GetCapacity(); }
+
+Status SetIOThreadPoolCapacity(int threads) {
+  return internal::GetIOThreadPool()->SetCapacity(threads);
+}
+
 }  // namespace arrow
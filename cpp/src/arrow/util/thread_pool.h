@@ -29,6 +29,7 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
@@ -53,6 +54,26 @@ ARROW_EXPORT int GetCpuThreadPoolCapacity();
 /// The current number is returned by GetCpuThreadPoolCapacity().
 ARROW_EXPORT Status SetCpuThreadPoolCapacity(int threads);
 
+/// \brief Get the capacity of the global I/O thread pool
+///
+/// Return the number of worker threads in the thread pool to which
+/// Arrow dispatches blocking I/O, such as file reads and filesystem
+/// requests.  It defaults to 8, or the value of the ARROW_IO_THREADS
+/// environment variable if set.
+///
+/// You can change this number using SetIOThreadPoolCapacity().
+ARROW_EXPORT int GetIOThreadPoolCapacity();
+
+/// \brief Set the capacity of the global I/O thread pool
+///
+/// Set the number of worker threads in the thread pool to which
+/// Arrow dispatches blocking I/O.  As I/O threads mostly wait on the
+/// storage, this can exceed the number of cores, e.g. to keep many
+/// requests to a remote filesystem in flight.
+///
+/// The current number is returned by GetIOThreadPoolCapacity().
+ARROW_EXPORT Status SetIOThreadPoolCapacity(int threads);
+
 namespace internal {
 
 namespace detail {
@@ -77,6 +98,13 @@ class ARROW_EXPORT ThreadPool {
   // Construct a thread pool with the given number of worker threads
   static Status Make(int threads, std::shared_ptr<ThreadPool>* out);
 
+  // Construct a thread pool whose workers are pinned to NUMA nodes, with
+  // threads_per_node[i] workers running on the CPUs of node i.  If the
+  // capacity is later increased, additional workers are distributed over
+  // the nodes.  Each worker prefers stealing tasks from workers of its node.
+  static Status MakeNumaAware(const std::vector<int>& threads_per_node,
+                              std::shared_ptr<ThreadPool>* out);
+
   // Destroy thread pool; the pool will first be shut down
   ~ThreadPool();
 
@@ -94,6 +122,10 @@ class ARROW_EXPORT ThreadPool {
   // This is exposed as a static method to help with testing.
   static int DefaultCapacity();
 
+  // Default capacity of the I/O thread pool, from the ARROW_IO_THREADS
+  // environment variable if set.
+  static int DefaultIOCapacity();
+
   // Shutdown the pool.  Once the pool starts shutting down, new tasks
   // cannot be submitted anymore.
   // If "wait" is true, shutdown waits for all pending tasks to be finished.
@@ -102,11 +134,25 @@ class ARROW_EXPORT ThreadPool {
   Status Shutdown(bool wait = true);
 
   // Spawn a fire-and-forget task on one of the workers.
+  // Each worker has its own task queue.  Tasks spawned from a worker are
+  // queued to that worker, which runs the most recent first; tasks spawned
+  // from other threads are distributed over the queues.  Idle workers
+  // steal the oldest tasks from other queues.
   template <typename Function>
   Status Spawn(Function&& func) {
     return SpawnReal(std::forward<Function>(func));
   }
 
+  // Spawn a fire-and-forget task, hinting that it should run on the NUMA
+  // node of the caller, e.g. because it uses memory the caller allocated.
+  // Such tasks are only stolen by workers of other nodes when no other
+  // task is available to them.  Without NUMA awareness, this is the same
+  // as Spawn() except for that stealing preference.
+  template <typename Function>
+  Status SpawnLocal(Function&& func) {
+    return SpawnReal(std::forward<Function>(func), /*local=*/true);
+  }
+
   // Submit a callable and arguments for execution.  Return a future that
   // will return the callable's result value once.
   // The callable's arguments are copied before execution.
@@ -135,13 +181,15 @@ class ARROW_EXPORT ThreadPool {
  protected:
   FRIEND_TEST(TestThreadPool, SetCapacity);
   FRIEND_TEST(TestGlobalThreadPool, Capacity);
+  FRIEND_TEST(TestGlobalThreadPool, IOThreadPool);
   friend ARROW_EXPORT ThreadPool* GetCpuThreadPool();
+  friend ARROW_EXPORT ThreadPool* GetIOThreadPool();
 
   ThreadPool();
 
   ARROW_DISALLOW_COPY_AND_ASSIGN(ThreadPool);
 
-  Status SpawnReal(std::function<void()> task);
+  Status SpawnReal(std::function<void()> task, bool local = false);
   // Collect finished worker threads, making sure the OS threads have exited
   void CollectFinishedWorkersUnlocked();
   // Launch a given number of additional workers
@@ -151,7 +199,9 @@ class ARROW_EXPORT ThreadPool {
   // Reinitialize the thread pool if the pid changed
   void ProtectAgainstFork();
 
+  static std::shared_ptr<ThreadPool> MakeGlobalThreadPool(int threads);
   static std::shared_ptr<ThreadPool> MakeCpuThreadPool();
+  static std::shared_ptr<ThreadPool> MakeIOThreadPool();
 
   std::shared_ptr<State> sp_state_;
   State* state_;
@@ -164,6 +214,16 @@ class ARROW_EXPORT ThreadPool {
 // Return the process-global thread pool for CPU-bound tasks.
 ARROW_EXPORT ThreadPool* GetCpuThreadPool();
 
+// Return the process-global thread pool for blocking I/O, such as the
+// default implementation of io::RandomAccessFile::ReadAsync().
+//
+// Code that blocks on storage (reads, directory listings, requests to
+// remote filesystems) should run there, and hand the results over to the
+// CPU thread pool for decoding.  This way slow storage doesn't leave CPU
+// threads idle, and many reads can be outstanding without oversubscribing
+// the cores.
+ARROW_EXPORT ThreadPool* GetIOThreadPool();
+
 }  // namespace internal
 }  // namespace arrow
 
@@ -18,6 +18,7 @@
 #include "benchmark/benchmark.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <functional>
@@ -25,6 +26,7 @@
 #include <limits>
 #include <memory>
 #include <random>
+#include <thread>
 #include <vector>
 
 #include "arrow/status.h"
@@ -103,6 +105,84 @@ static void ThreadPoolSpawn(benchmark::State& state) {
   state.SetItemsProcessed(state.iterations() * nspawns);
 }
 
+// Benchmark ThreadPool::Spawn from several external threads at once
+static void ThreadPoolSpawnThreaded(benchmark::State& state) {
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+  const int nsubmitters = 4;
+
+  Workload workload(workload_size);
+
+  const int32_t nspawns = 200000000 / workload_size / nsubmitters + 1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::shared_ptr<ThreadPool> pool;
+    ABORT_NOT_OK(ThreadPool::Make(nthreads, &pool));
+    state.ResumeTiming();
+
+    std::vector<std::thread> submitters;
+    for (int j = 0; j < nsubmitters; ++j) {
+      submitters.emplace_back([&] {
+        for (int32_t i = 0; i < nspawns; ++i) {
+          ABORT_NOT_OK(pool->Spawn(std::ref(workload)));
+        }
+      });
+    }
+    for (auto& thread : submitters) {
+      thread.join();
+    }
+
+    // Wait for all tasks to finish
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nspawns * nsubmitters);
+}
+
+// Benchmark ThreadPool::Spawn from within tasks, which queue to the
+// current worker and get stolen by the others
+static void ThreadPoolNestedSpawn(benchmark::State& state) {
+  const auto nthreads = static_cast<int>(state.range(0));
+  const auto workload_size = static_cast<int32_t>(state.range(1));
+
+  Workload workload(workload_size);
+
+  const int32_t nouter = 1000;
+  const int32_t ninner = 200000000 / workload_size / nouter + 1;
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::shared_ptr<ThreadPool> pool;
+    ABORT_NOT_OK(ThreadPool::Make(nthreads, &pool));
+    std::atomic<int32_t> nremaining(nouter * ninner);
+    state.ResumeTiming();
+
+    for (int32_t i = 0; i < nouter; ++i) {
+      ABORT_NOT_OK(pool->Spawn([&] {
+        for (int32_t j = 0; j < ninner; ++j) {
+          ABORT_NOT_OK(pool->Spawn([&] {
+            workload();
+            --nremaining;
+          }));
+        }
+      }));
+    }
+
+    // Subtasks can't be spawned after shutdown, so wait for them first
+    while (nremaining.load() > 0) {
+      std::this_thread::yield();
+    }
+    ABORT_NOT_OK(pool->Shutdown(true /* wait */));
+    state.PauseTiming();
+    pool.reset();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * nouter * ninner);
+}
+
 // Benchmark serial TaskGroup
 static void SerialTaskGroup(benchmark::State& state) {
   const auto workload_size = static_cast<int32_t>(state.range(0));
@@ -189,6 +269,8 @@ BENCHMARK(ReferenceWorkloadCost)->Apply(WorkloadCost_Customize);
 
 BENCHMARK(SerialTaskGroup)->Apply(WorkloadCost_Customize);
 BENCHMARK(ThreadPoolSpawn)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(ThreadPoolSpawnThreaded)->Apply(ThreadPoolSpawn_Customize);
+BENCHMARK(ThreadPoolNestedSpawn)->Apply(ThreadPoolSpawn_Customize);
 BENCHMARK(ThreadedTaskGroup)->Apply(ThreadPoolSpawn_Customize);
 
 }  // namespace internal
@@ -21,6 +21,7 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <cstdio>
@@ -38,6 +39,7 @@
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/numa.h"
 #include "arrow/util/thread_pool.h"
 
 namespace arrow {
@@ -199,6 +201,102 @@ TEST_F(TestThreadPool, StressSpawnThreaded) {
   SpawnAddsThreaded(pool.get(), 20, 100, task_add<int>);
 }
 
+// Tasks spawned from a worker go to its own queue, from which idle
+// workers steal
+static void SpawnTree(ThreadPool* pool, int depth, std::atomic<int>* count) {
+  ++*count;
+  if (depth > 0) {
+    for (int i = 0; i < 3; ++i) {
+      ASSERT_OK(pool->Spawn([=] { SpawnTree(pool, depth - 1, count); }));
+    }
+  }
+}
+
+TEST_F(TestThreadPool, NestedSpawn) {
+  for (int threads : {1, 4, 30}) {
+    auto pool = this->MakeThreadPool(threads);
+    std::atomic<int> count(0);
+    ASSERT_OK(pool->Spawn([&] { SpawnTree(pool.get(), 6, &count); }));
+    // 1 + 3 + ... + 3**6
+    busy_wait(5.0, [&] { return count == 1093; });
+    ASSERT_EQ(1093, count);
+    ASSERT_OK(pool->Shutdown());
+  }
+}
+
+TEST_F(TestThreadPool, StealSlowTasks) {
+  // A single worker queues slow tasks to itself; others must steal them
+  auto pool = this->MakeThreadPool(4);
+  std::atomic<int> count(0);
+  std::vector<std::thread::id> thread_ids(8);
+  ASSERT_OK(pool->Spawn([&] {
+    for (int i = 0; i < 8; ++i) {
+      ASSERT_OK(pool->Spawn([&, i] {
+        thread_ids[i] = std::this_thread::get_id();
+        sleep_for(0.01);
+        ++count;
+      }));
+    }
+  }));
+  busy_wait(5.0, [&] { return count == 8; });
+  ASSERT_EQ(8, count);
+  ASSERT_OK(pool->Shutdown());
+  std::sort(thread_ids.begin(), thread_ids.end());
+  ASSERT_GT(std::unique(thread_ids.begin(), thread_ids.end()) - thread_ids.begin(), 1);
+}
+
+TEST(TestNuma, Topology) {
+  const int num_nodes = GetNumaNodeCount();
+  ASSERT_GE(num_nodes, 1);
+  ASSERT_FALSE(GetNumaNodeCpus(0).empty());
+  ASSERT_TRUE(GetNumaNodeCpus(num_nodes).empty());
+  ASSERT_GE(GetCurrentNumaNode(), 0);
+  ASSERT_LT(GetCurrentNumaNode(), num_nodes);
+
+#ifdef __linux__
+  // Pin a separate thread to the first node
+  std::thread thread([&] {
+    ASSERT_OK(SetCurrentThreadAffinity(GetNumaNodeCpus(0)));
+    ASSERT_EQ(GetCurrentNumaNode(), 0);
+  });
+  thread.join();
+  ASSERT_RAISES(Invalid, SetCurrentThreadAffinity({-1}));
+#endif
+}
+
+TEST_F(TestThreadPool, NumaAware) {
+  const int num_nodes = GetNumaNodeCount();
+  ASSERT_GE(num_nodes, 1);
+  ASSERT_RAISES(Invalid, ThreadPool::MakeNumaAware({}, nullptr));
+  ASSERT_RAISES(Invalid,
+                ThreadPool::MakeNumaAware(std::vector<int>(num_nodes + 1, 1), nullptr));
+  ASSERT_RAISES(Invalid, ThreadPool::MakeNumaAware({-1}, nullptr));
+
+  std::shared_ptr<ThreadPool> pool;
+  ASSERT_OK(ThreadPool::MakeNumaAware(std::vector<int>(num_nodes, 2), &pool));
+  ASSERT_EQ(pool->GetCapacity(), 2 * num_nodes);
+
+  // Local and regular tasks, from outside and inside the pool
+  std::atomic<int> count(0);
+  std::atomic<int> invalid_nodes(0);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_OK(pool->SpawnLocal([&] {
+      ASSERT_OK(pool->SpawnLocal([&] { ++count; }));
+      ASSERT_OK(pool->Spawn([&] { ++count; }));
+      const int node = GetCurrentNumaNode();
+      if (node < 0 || node >= num_nodes) {
+        ++invalid_nodes;
+      }
+    }));
+  }
+  busy_wait(5.0, [&] { return count == 200; });
+  ASSERT_EQ(count, 200);
+  ASSERT_EQ(invalid_nodes, 0);
+
+  ASSERT_OK(pool->SetCapacity(3 * num_nodes));
+  SpawnAdds(pool.get(), 100, task_add<int>);
+}
+
 TEST_F(TestThreadPool, SpawnSlow) {
   // This checks that Shutdown() waits for all tasks to finish
   auto pool = this->MakeThreadPool(2);
@@ -221,6 +319,29 @@ TEST_F(TestThreadPool, StressSpawnSlowThreaded) {
   });
 }
 
+TEST_F(TestThreadPool, SpawnDuringShutdown) {
+  // Every task whose spawn succeeded must run, even if Shutdown() was
+  // called concurrently
+  for (int i = 0; i < 20; ++i) {
+    auto pool = this->MakeThreadPool(4);
+    std::atomic<int> spawned(0), ran(0);
+    std::vector<std::thread> spawners;
+    for (int j = 0; j < 4; ++j) {
+      spawners.emplace_back([&] {
+        while (pool->Spawn([&] { ++ran; }).ok()) {
+          ++spawned;
+        }
+      });
+    }
+    sleep_for(0.001);
+    ASSERT_OK(pool->Shutdown());
+    for (auto& spawner : spawners) {
+      spawner.join();
+    }
+    ASSERT_EQ(spawned.load(), ran.load());
+  }
+}
+
 TEST_F(TestThreadPool, QuickShutdown) {
   AddTester add_tester(100);
   {
@@ -401,5 +522,43 @@ TEST(TestGlobalThreadPool, Capacity) {
   ASSERT_OK(DelEnvVar("OMP_THREAD_LIMIT"));
 }
 
+TEST(TestGlobalThreadPool, IOThreadPool) {
+  auto pool = GetIOThreadPool();
+  ASSERT_NE(pool, GetCpuThreadPool());
+  ASSERT_GT(pool->GetCapacity(), 0);
+  ASSERT_EQ(pool, GetIOThreadPool());
+
+  auto fut = pool->Submit(add<int>, 4, 5);
+  ASSERT_EQ(fut.get(), 9);
+
+  // The capacity is set independently of the CPU thread pool
+  const int cpu_capacity = GetCpuThreadPoolCapacity();
+  const int capacity = GetIOThreadPoolCapacity();
+  ASSERT_EQ(pool->GetCapacity(), capacity);
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity + 3));
+  ASSERT_EQ(GetIOThreadPoolCapacity(), capacity + 3);
+  ASSERT_EQ(pool->GetActualCapacity(), capacity + 3);
+  ASSERT_EQ(GetCpuThreadPoolCapacity(), cpu_capacity);
+  ASSERT_RAISES(Invalid, SetIOThreadPoolCapacity(0));
+  ASSERT_OK(SetIOThreadPoolCapacity(capacity));
+
+  // Default capacity
+  ASSERT_OK(DelEnvVar("ARROW_IO_THREADS"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 8);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "64"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 64);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "0"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 8);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "zzz"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 8);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "-4"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 8);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "16 threads"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 8);
+  ASSERT_OK(SetEnvVar("ARROW_IO_THREADS", "99999999999"));
+  ASSERT_EQ(ThreadPool::DefaultIOCapacity(), 8);
+  ASSERT_OK(DelEnvVar("ARROW_IO_THREADS"));
+}
+
 }  // namespace internal
 }  // namespace arrow
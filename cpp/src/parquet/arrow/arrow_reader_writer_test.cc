@@ -35,6 +35,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/thread_pool.h"
 
 #include "parquet/api/reader.h"
 #include "parquet/api/writer.h"
@@ -1879,6 +1880,51 @@ TEST(TestArrowReadWrite, MultithreadedRead) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, MultithreadedReadPageRuns) {
+  // Fewer columns than threads: column chunks are decoded in runs of pages
+  const int num_columns = 2;
+  const int num_rows = 10000;
+
+  // Restore the pool capacity even if an assertion fails
+  struct RestoreCapacity {
+    ~RestoreCapacity() { ARROW_EXPECT_OK(::arrow::SetCpuThreadPoolCapacity(capacity)); }
+    int capacity;
+  } restore_capacity{::arrow::GetCpuThreadPoolCapacity()};
+  ASSERT_OK(::arrow::SetCpuThreadPoolCapacity(8));
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+  auto strings = ::arrow::random::RandomArrayGenerator(0).String(num_rows, 0, 20, 0.1);
+  ASSERT_OK(table->AddColumn(num_columns, ::arrow::field("strings", ::arrow::utf8()),
+                             std::make_shared<ChunkedArray>(strings), &table));
+
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder()
+                         .data_pagesize(1024)
+                         ->write_batch_size(100)
+                         ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                num_rows / 2, write_props,
+                                default_arrow_writer_properties()));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK_NO_THROW(sink->Finish(&buffer));
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(ArrowReaderProperties(/*use_threads=*/true))
+                ->Build(&reader));
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
+
+  ASSERT_OK_NO_THROW(reader->ReadRowGroups({1}, &result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table->Slice(num_rows / 2),
+                                                     *result,
+                                                     /*same_chunk_layout=*/false));
+}
+
 TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   const int num_columns = 10;
   const int num_rows = 100;
@@ -1966,6 +2012,98 @@ TEST(TestArrowReadWrite, GetRecordBatchReader) {
   ASSERT_EQ(nullptr, actual_batch);
 }
 
+TEST(TestArrowReadWrite, GetRecordBatchReaderBoundedMemory) {
+  const int num_columns = 5;
+  const int num_rows = 100000;
+  const int batch_size = 1000;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  // A single large row group made of many small pages
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder()
+                         .disable_dictionary()
+                         ->data_pagesize(16 * 1024)
+                         ->write_batch_size(100)
+                         ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink, num_rows,
+                                write_props, default_arrow_writer_properties()));
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_OK_NO_THROW(sink->Finish(&buffer));
+
+  ::arrow::ProxyMemoryPool pool(::arrow::default_memory_pool());
+  ReaderProperties reader_properties(&pool);
+  reader_properties.enable_buffered_stream();
+  reader_properties.set_buffer_size(16 * 1024);
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_batch_size(batch_size);
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer), reader_properties));
+  ASSERT_OK(builder.memory_pool(&pool)->properties(properties)->Build(&reader));
+
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0}, &rb_reader));
+
+  std::shared_ptr<::arrow::RecordBatch> actual_batch, expected_batch;
+  ::arrow::TableBatchReader table_reader(*table);
+  table_reader.set_chunksize(batch_size);
+  for (int i = 0; i < num_rows / batch_size; ++i) {
+    ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+    ASSERT_OK(table_reader.ReadNext(&expected_batch));
+    ASSERT_NO_FATAL_FAILURE(::arrow::AssertBatchesEqual(*expected_batch, *actual_batch));
+  }
+  ASSERT_OK(rb_reader->ReadNext(&actual_batch));
+  ASSERT_EQ(nullptr, actual_batch);
+
+  // Only a few batches and pages per column are ever alive at once, far less
+  // than the decoded row group
+  const int64_t row_group_bytes = num_columns * num_rows * sizeof(double);
+  ASSERT_LT(pool.max_memory(), row_group_bytes / 8);
+}
+
+TEST(TestArrowReadWrite, GetRecordBatchReaderChunkedColumns) {
+  // Both row groups have distinct dictionaries, so a batch spanning the row
+  // group boundary yields a chunked dictionary column
+  auto values = ::arrow::ArrayFromJSON(
+      ::arrow::utf8(), R"(["a", "b", "a", "c", "b", "a",
+                           "x", "y", "x", null, "z", "y"])");
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(MakeSimpleTable(values, /*nullable=*/true),
+                                             /*row_group_size=*/6,
+                                             default_arrow_writer_properties(), &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_read_dictionary(0, true);
+  properties.set_batch_size(4);
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<Table> expected;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&expected));
+
+  std::shared_ptr<::arrow::RecordBatchReader> rb_reader;
+  ASSERT_OK_NO_THROW(reader->GetRecordBatchReader({0, 1}, &rb_reader));
+  std::vector<std::shared_ptr<::arrow::RecordBatch>> batches;
+  std::shared_ptr<::arrow::RecordBatch> batch;
+  do {
+    ASSERT_OK(rb_reader->ReadNext(&batch));
+    if (batch != nullptr) {
+      ASSERT_LE(batch->num_rows(), 4);
+      batches.push_back(batch);
+    }
+  } while (batch != nullptr);
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK(Table::FromRecordBatches(batches, &actual));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST(TestArrowReadWrite, ScanContents) {
   const int num_columns = 20;
   const int num_rows = 1000;
@@ -2867,6 +3005,64 @@ INSTANTIATE_TEST_CASE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+void CheckReadAsDictionary(const std::shared_ptr<Array>& values,
+                           const std::shared_ptr<Array>& expected_indices,
+                           const std::shared_ptr<Array>& expected_dictionary,
+                           int64_t row_group_size) {
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(MakeSimpleTable(values, /*nullable=*/true),
+                                             row_group_size,
+                                             default_arrow_writer_properties(), &buffer));
+
+  auto properties = default_arrow_reader_properties();
+  properties.set_read_dictionary(0, true);
+
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK_NO_THROW(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+
+  auto column = actual->column(0);
+  auto expected_type = ::arrow::dictionary(::arrow::int32(), values->type());
+  ASSERT_TRUE(column->type()->Equals(*expected_type));
+  ASSERT_EQ(values->length() / row_group_size, column->num_chunks());
+
+  std::shared_ptr<Array> first_dictionary;
+  for (const auto& chunk : column->chunks()) {
+    const auto& dict_chunk = static_cast<const ::arrow::DictionaryArray&>(*chunk);
+    AssertArraysEqual(*expected_indices, *dict_chunk.indices());
+    AssertArraysEqual(*expected_dictionary, *dict_chunk.dictionary());
+    if (first_dictionary == nullptr) {
+      first_dictionary = dict_chunk.dictionary();
+    }
+    // Identical dictionaries from consecutive row groups are shared
+    ASSERT_EQ(first_dictionary.get(), dict_chunk.dictionary().get());
+  }
+}
+
+TEST(TestArrowReadDictionaryTypes, ReadPrimitiveAsDictionary) {
+  // Each row group has the same values, hence an identical dictionary page
+  auto indices = ::arrow::ArrayFromJSON(::arrow::int32(), "[0, 1, null, 2, 0, 1]");
+  auto check = [&](const std::shared_ptr<DataType>& type, const std::string& row_group,
+                   const std::string& dictionary) {
+    auto values = ::arrow::ArrayFromJSON(type, "[" + row_group + ", " + row_group + "]");
+    CheckReadAsDictionary(values, indices, ::arrow::ArrayFromJSON(type, dictionary),
+                          indices->length());
+  };
+
+  check(::arrow::int32(), "-1, 5, null, 7, -1, 5", "[-1, 5, 7]");
+  check(::arrow::int64(), "-1, 5, null, 7, -1, 5", "[-1, 5, 7]");
+  check(::arrow::date32(), "1, 5, null, 7, 1, 5", "[1, 5, 7]");
+  check(::arrow::float32(), "1.5, 5, null, 7, 1.5, 5", "[1.5, 5, 7]");
+  check(::arrow::float64(), "1.5, 5, null, 7, 1.5, 5", "[1.5, 5, 7]");
+  check(::arrow::utf8(), R"("a", "bc", null, "d", "a", "bc")", R"(["a", "bc", "d"])");
+  check(::arrow::fixed_size_binary(2), R"("aa", "bc", null, "dd", "aa", "bc")",
+        R"(["aa", "bc", "dd"])");
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
@@ -19,16 +19,19 @@
 
 #include <algorithm>
 #include <cstring>
-#include <future>
+#include <iterator>
+#include <limits>
 #include <utility>
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/range.h"
+#include "arrow/util/task_group.h"
 #include "arrow/util/thread_pool.h"
 
 #include "parquet/arrow/reader_internal.h"
@@ -183,6 +186,41 @@ class FileReaderImpl : public FileReader {
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  // Whether the chunks of this field can be split into runs of pages decoded
+  // concurrently. Records of flat columns never span pages.
+  bool CanDecodePagesInParallel(const SchemaField& field) const {
+    return field.is_leaf() && field.max_repetition_level == 0 &&
+           field.field->type()->id() != ::arrow::Type::DICTIONARY;
+  }
+
+  // Read the column chunk of a flat leaf column in the given row group and
+  // split it into at most max_partitions runs of pages
+  Status GetPageRuns(const SchemaField& field, int row_group, int max_partitions,
+                     std::vector<std::unique_ptr<PageReader>>* out) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    *out = reader_->RowGroup(row_group)->GetColumnPageReaders(field.column_index,
+                                                              max_partitions);
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  // Decode a run of pages of a flat leaf column
+  Status DecodePages(const SchemaField& field, std::unique_ptr<PageReader> pages,
+                     std::shared_ptr<ChunkedArray>* out) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    const ColumnDescriptor* descr = manifest_.descr->Column(field.column_index);
+    std::shared_ptr<RecordReader> record_reader = RecordReader::Make(descr, pool_);
+    record_reader->SetPageReader(std::move(pages));
+    while (record_reader->HasMoreData()) {
+      if (record_reader->ReadRecords(kPageRunBatchSize) == 0) {
+        break;
+      }
+    }
+    return TransferColumnData(record_reader.get(), field.field->type(), descr, pool_,
+                              out);
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
   Status GetColumn(int i, std::unique_ptr<ColumnReader>* out) override {
     return GetColumn(i, AllRowGroupsFactory(), out);
   }
@@ -273,6 +311,9 @@ class FileReaderImpl : public FileReader {
     END_PARQUET_CATCH_EXCEPTIONS
   }
 
+  // Number of records requested at a time when decoding a run of pages
+  static constexpr int64_t kPageRunBatchSize = 64 * 1024;
+
   MemoryPool* pool_;
   std::unique_ptr<ParquetFileReader> reader_;
   ArrowReaderProperties reader_properties_;
@@ -280,6 +321,8 @@ class FileReaderImpl : public FileReader {
   SchemaManifest manifest_;
 };
 
+constexpr int64_t FileReaderImpl::kPageRunBatchSize;
+
 class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
  public:
   RowGroupRecordBatchReader(std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers,
@@ -313,28 +356,40 @@ class RowGroupRecordBatchReader : public ::arrow::RecordBatchReader {
   }
 
   Status ReadNext(std::shared_ptr<::arrow::RecordBatch>* out) override {
+    // Hand out what is left of the previously read columns first. They are
+    // chunked when a batch spans a row group boundary or when a column is
+    // read as dictionary and the dictionary changes.
+    if (pending_batches_ != nullptr) {
+      RETURN_NOT_OK(pending_batches_->ReadNext(out));
+      if (*out != nullptr) {
+        return Status::OK();
+      }
+      pending_batches_.reset();
+      pending_table_.reset();
+    }
+
     // TODO (hatemhelal): Consider refactoring this to share logic with ReadTable as this
     // does not currently honor the use_threads option.
     std::vector<std::shared_ptr<ChunkedArray>> columns(field_readers_.size());
     for (size_t i = 0; i < field_readers_.size(); ++i) {
       RETURN_NOT_OK(field_readers_[i]->NextBatch(batch_size_, &columns[i]));
-      if (columns[i]->num_chunks() > 1) {
-        return Status::NotImplemented("This class cannot yet iterate chunked arrays");
-      }
     }
 
     // Create an intermediate table and use TableBatchReader as an adaptor to a
-    // RecordBatch
-    std::shared_ptr<Table> table = Table::Make(schema_, columns);
-    RETURN_NOT_OK(table->Validate());
-    ::arrow::TableBatchReader table_batch_reader(*table);
-    return table_batch_reader.ReadNext(out);
+    // RecordBatch, slicing at the chunk boundaries of the columns
+    pending_table_ = Table::Make(schema_, columns);
+    RETURN_NOT_OK(pending_table_->Validate());
+    pending_batches_.reset(new ::arrow::TableBatchReader(*pending_table_));
+    return pending_batches_->ReadNext(out);
   }
 
  private:
   std::vector<std::unique_ptr<ColumnReaderImpl>> field_readers_;
   std::shared_ptr<::arrow::Schema> schema_;
   int64_t batch_size_;
+
+  std::shared_ptr<Table> pending_table_;
+  std::unique_ptr<::arrow::TableBatchReader> pending_batches_;
 };
 
 class ColumnChunkReaderImpl : public ColumnChunkReader {
@@ -765,6 +820,43 @@ Status FileReaderImpl::GetColumn(int i, FileColumnIteratorFactory iterator_facto
   return Status::OK();
 }
 
+// Upper bound of the offsets of an array: they can't exceed the total
+// length and byte size of the array and its children
+static int64_t OffsetsUpperBound(const ::arrow::ArrayData& data) {
+  int64_t bound = data.length;
+  for (const auto& buffer : data.buffers) {
+    if (buffer != nullptr) {
+      bound += buffer->size();
+    }
+  }
+  for (const auto& child : data.child_data) {
+    bound += OffsetsUpperBound(*child);
+  }
+  return bound;
+}
+
+// Combine the given chunked arrays into a single contiguous array, or keep the
+// chunks as-is if the offsets of the result could overflow
+static Status StitchChunks(const std::vector<std::shared_ptr<ChunkedArray>>& parts,
+                           const std::shared_ptr<DataType>& type, MemoryPool* pool,
+                           std::shared_ptr<ChunkedArray>* out) {
+  ::arrow::ArrayVector chunks;
+  int64_t offsets_bound = 0;
+  for (const auto& part : parts) {
+    for (const auto& chunk : part->chunks()) {
+      offsets_bound += OffsetsUpperBound(*chunk->data());
+      chunks.push_back(chunk);
+    }
+  }
+  if (chunks.size() > 1 && offsets_bound <= std::numeric_limits<int32_t>::max()) {
+    std::shared_ptr<Array> concatenated;
+    RETURN_NOT_OK(::arrow::Concatenate(chunks, pool, &concatenated));
+    chunks = {concatenated};
+  }
+  *out = std::make_shared<ChunkedArray>(chunks, type);
+  return Status::OK();
+}
+
 Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
                                      const std::vector<int>& indices,
                                      std::shared_ptr<Table>* out) {
@@ -787,19 +879,67 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   };
 
   if (reader_properties_.use_threads()) {
-    std::vector<std::future<Status>> futures;
     auto pool = ::arrow::internal::GetCpuThreadPool();
+    auto group = ::arrow::internal::TaskGroup::MakeThreaded(pool);
+
+    // With fewer columns than threads, the column chunks of flat columns are
+    // further split into runs of pages, each decoded by its own task, so that
+    // a few large columns still keep all threads busy
+    const int max_partitions = pool->GetCapacity() / std::max(num_fields, 1);
+    const int num_row_groups = static_cast<int>(row_groups.size());
+    std::vector<bool> decode_by_pages(num_fields, false);
+    // Indexed by field, then row group, then run of pages
+    std::vector<std::vector<std::vector<std::unique_ptr<PageReader>>>> page_runs(
+        num_fields);
+    std::vector<std::vector<std::vector<std::shared_ptr<ChunkedArray>>>> decoded_runs(
+        num_fields);
+
     for (int i = 0; i < num_fields; i++) {
-      futures.push_back(pool->Submit(ReadColumnFunc, i));
+      const SchemaField& schema_field = manifest_.schema_fields[field_indices[i]];
+      if (max_partitions <= 1 || !CanDecodePagesInParallel(schema_field)) {
+        group->Append([&, i]() { return ReadColumnFunc(i); });
+        continue;
+      }
+      decode_by_pages[i] = true;
+      fields[i] = schema_field.field;
+      page_runs[i].resize(num_row_groups);
+      decoded_runs[i].resize(num_row_groups);
+      for (int r = 0; r < num_row_groups; r++) {
+        // Each task reads its own column chunk, then hands the runs of pages
+        // over to further tasks
+        group->Append([&, i, r]() {
+          RETURN_NOT_OK(GetPageRuns(manifest_.schema_fields[field_indices[i]],
+                                    row_groups[r], max_partitions, &page_runs[i][r]));
+          decoded_runs[i][r].resize(page_runs[i][r].size());
+          for (size_t j = 0; j < page_runs[i][r].size(); j++) {
+            group->Append([&, i, r, j]() {
+              return DecodePages(manifest_.schema_fields[field_indices[i]],
+                                 std::move(page_runs[i][r][j]), &decoded_runs[i][r][j]);
+            });
+          }
+          return Status::OK();
+        });
+      }
     }
-    Status final_status = Status::OK();
-    for (auto& fut : futures) {
-      Status st = fut.get();
-      if (!st.ok()) {
-        final_status = std::move(st);
+    RETURN_NOT_OK(group->Finish());
+
+    // Stitch the runs of pages back together, one task per column
+    auto stitch_group = ::arrow::internal::TaskGroup::MakeThreaded(pool);
+    for (int i = 0; i < num_fields; i++) {
+      if (!decode_by_pages[i]) {
+        continue;
       }
+      stitch_group->Append([&, i]() {
+        std::vector<std::shared_ptr<ChunkedArray>> runs;
+        for (auto& row_group_runs : decoded_runs[i]) {
+          std::move(row_group_runs.begin(), row_group_runs.end(),
+                    std::back_inserter(runs));
+        }
+        decoded_runs[i].clear();
+        return StitchChunks(runs, fields[i]->type(), pool_, &columns[i]);
+      });
     }
-    RETURN_NOT_OK(final_status);
+    RETURN_NOT_OK(stitch_group->Finish());
   } else {
     for (int i = 0; i < num_fields; i++) {
       RETURN_NOT_OK(ReadColumnFunc(i));
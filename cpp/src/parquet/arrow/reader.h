@@ -152,6 +152,14 @@ class PARQUET_EXPORT FileReader {
 
   /// \brief Return a RecordBatchReader of row groups selected from row_group_indices, the
   ///    ordering in row_group_indices matters.
+  ///
+  /// Batches of ArrowReaderProperties::batch_size() rows are decoded on demand.
+  /// To also read and decompress the column chunks page by page, rather than
+  /// loading each whole column chunk up front, open the file with
+  /// ReaderProperties::enable_buffered_stream(). Peak memory is then bounded
+  /// by the batch size and buffer size times the number of columns, regardless
+  /// of the row group size.
+  ///
   /// \returns error Status if row_group_indices contains invalid index
   virtual ::arrow::Status GetRecordBatchReader(
       const std::vector<int>& row_group_indices,
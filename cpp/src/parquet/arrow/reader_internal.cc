@@ -30,6 +30,7 @@
 #include <boost/algorithm/string/predicate.hpp>
 
 #include "arrow/array.h"
+#include "arrow/buffer_builder.h"
 #include "arrow/builder.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/extension_type.h"
@@ -333,9 +334,28 @@ struct SchemaTreeContext {
   }
 };
 
-bool IsDictionaryReadSupported(const DataType& type) {
-  // Only supported currently for BYTE_ARRAY types
-  return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+// Dictionary decoding yields the dictionary values in the physical type's
+// natural Arrow representation, so we support those Arrow types which are a
+// zero-copy view of it
+bool IsDictionaryReadSupported(const DataType& type, ParquetType::type physical_type) {
+  switch (physical_type) {
+    case ParquetType::INT32:
+      return type.id() == ::arrow::Type::INT32 || type.id() == ::arrow::Type::UINT32 ||
+             type.id() == ::arrow::Type::DATE32 || type.id() == ::arrow::Type::TIME32;
+    case ParquetType::INT64:
+      return type.id() == ::arrow::Type::INT64 || type.id() == ::arrow::Type::UINT64 ||
+             type.id() == ::arrow::Type::TIMESTAMP || type.id() == ::arrow::Type::TIME64;
+    case ParquetType::FLOAT:
+      return type.id() == ::arrow::Type::FLOAT;
+    case ParquetType::DOUBLE:
+      return type.id() == ::arrow::Type::DOUBLE;
+    case ParquetType::BYTE_ARRAY:
+      return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+    case ParquetType::FIXED_LEN_BYTE_ARRAY:
+      return type.id() == ::arrow::Type::FIXED_SIZE_BINARY;
+    default:
+      return false;
+  }
 }
 
 Status GetTypeForNode(int column_index, const schema::PrimitiveNode& primitive_node,
@@ -343,7 +363,7 @@ Status GetTypeForNode(int column_index, const schema::PrimitiveNode& primitive_n
   std::shared_ptr<DataType> storage_type;
   RETURN_NOT_OK(GetPrimitiveType(primitive_node, &storage_type));
   if (ctx->properties.read_dictionary(column_index) &&
-      IsDictionaryReadSupported(*storage_type)) {
+      IsDictionaryReadSupported(*storage_type, primitive_node.physical_type())) {
     *out = ::arrow::dictionary(::arrow::int32(), storage_type);
   } else {
     *out = storage_type;
@@ -603,6 +623,7 @@ Status GetOriginSchema(const std::shared_ptr<const KeyValueMetadata>& metadata,
 }
 
 Status ApplyOriginalMetadata(std::shared_ptr<Field> field, const Field& origin_field,
+                             const ColumnDescriptor* leaf_descr,
                              std::shared_ptr<Field>* out) {
   auto origin_type = origin_field.type();
   if (field->type()->id() == ::arrow::Type::TIMESTAMP) {
@@ -618,8 +639,8 @@ Status ApplyOriginalMetadata(std::shared_ptr<Field> field, const Field& origin_f
     }
   }
   if (origin_type->id() == ::arrow::Type::DICTIONARY &&
-      field->type()->id() != ::arrow::Type::DICTIONARY &&
-      IsDictionaryReadSupported(*field->type())) {
+      field->type()->id() != ::arrow::Type::DICTIONARY && leaf_descr != nullptr &&
+      IsDictionaryReadSupported(*field->type(), leaf_descr->physical_type())) {
     const auto& dict_origin_type =
         static_cast<const ::arrow::DictionaryType&>(*origin_type);
     field = field->WithType(
@@ -678,8 +699,10 @@ Status SchemaManifest::Make(const SchemaDescriptor* schema,
       continue;
     }
     auto origin_field = manifest->origin_schema->field(i);
-    RETURN_NOT_OK(
-        ApplyOriginalMetadata(out_field->field, *origin_field, &out_field->field));
+    const ColumnDescriptor* leaf_descr =
+        out_field->is_leaf() ? schema->Column(out_field->column_index) : nullptr;
+    RETURN_NOT_OK(ApplyOriginalMetadata(out_field->field, *origin_field, leaf_descr,
+                                        &out_field->field));
   }
   return Status::OK();
 }
@@ -868,7 +891,7 @@ Status TransferDate64(RecordReader* reader, MemoryPool* pool,
 }
 
 // ----------------------------------------------------------------------
-// Binary, direct to dictionary-encoded
+// Direct to dictionary-encoded
 
 Status TransferDictionary(RecordReader* reader,
                           const std::shared_ptr<DataType>& logical_value_type,
@@ -876,9 +899,27 @@ Status TransferDictionary(RecordReader* reader,
   auto dict_reader = dynamic_cast<internal::DictionaryRecordReader*>(reader);
   DCHECK(dict_reader);
   *out = dict_reader->GetResult();
-  if (!logical_value_type->Equals(*(*out)->type())) {
-    RETURN_NOT_OK((*out)->View(logical_value_type, out));
+  if (logical_value_type->Equals(*(*out)->type())) {
+    return Status::OK();
+  }
+
+  // View each distinct dictionary only once so that chunks which shared a
+  // dictionary still do so after the conversion to the logical type
+  const auto& dict_type =
+      checked_cast<const ::arrow::DictionaryType&>(*logical_value_type);
+  ::arrow::ArrayVector chunks;
+  std::shared_ptr<Array> physical_dictionary, logical_dictionary;
+  for (const auto& chunk : (*out)->chunks()) {
+    const auto& dict_chunk = checked_cast<const ::arrow::DictionaryArray&>(*chunk);
+    if (dict_chunk.dictionary() != physical_dictionary) {
+      physical_dictionary = dict_chunk.dictionary();
+      RETURN_NOT_OK(
+          physical_dictionary->View(dict_type.value_type(), &logical_dictionary));
+    }
+    chunks.push_back(std::make_shared<::arrow::DictionaryArray>(
+        logical_value_type, dict_chunk.indices(), logical_dictionary));
   }
+  *out = std::make_shared<ChunkedArray>(std::move(chunks), logical_value_type);
   return Status::OK();
 }
 
@@ -1340,8 +1381,8 @@ Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
   // Walk downwards to extract nullability
   std::vector<std::string> item_names;
   std::vector<bool> nullable;
-  std::vector<std::shared_ptr<::arrow::Int32Builder>> offset_builders;
-  std::vector<std::shared_ptr<::arrow::BooleanBuilder>> valid_bits_builders;
+  std::vector<::arrow::TypedBufferBuilder<int32_t>> offset_builders;
+  std::vector<::arrow::TypedBufferBuilder<bool>> valid_bits_builders;
   nullable.push_back(field->nullable());
   while (field->type()->num_children() > 0) {
     if (field->type()->num_children() > 1) {
@@ -1353,14 +1394,22 @@ Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
       field = field->type()->child(0);
     }
     item_names.push_back(field->name());
-    offset_builders.emplace_back(
-        std::make_shared<::arrow::Int32Builder>(::arrow::int32(), pool));
-    valid_bits_builders.emplace_back(
-        std::make_shared<::arrow::BooleanBuilder>(::arrow::boolean(), pool));
+    offset_builders.emplace_back(pool);
+    valid_bits_builders.emplace_back(pool);
     nullable.push_back(field->nullable());
   }
 
   int64_t list_depth = offset_builders.size();
+
+  // Each level starts at most one list at every depth, so reserving for the
+  // total number of levels up front lets the main loop append without checks
+  for (int64_t j = 0; j < list_depth; j++) {
+    RETURN_NOT_OK(offset_builders[j].Reserve(total_levels + 1));
+    if (nullable[j]) {
+      RETURN_NOT_OK(valid_bits_builders[j].Reserve(total_levels));
+    }
+  }
+
   // This describes the minimal definition that describes a level that
   // reflects a value in the primitive values array.
   int16_t values_def_level = max_def_level;
@@ -1380,55 +1429,56 @@ Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
     def_level++;
   }
 
+  auto append_offset = [&](int64_t j, int32_t values_offset) {
+    if (j == (list_depth - 1)) {
+      offset_builders[j].UnsafeAppend(values_offset);
+    } else {
+      offset_builders[j].UnsafeAppend(
+          static_cast<int32_t>(offset_builders[j + 1].length()));
+    }
+  };
+
   int32_t values_offset = 0;
   std::vector<int64_t> null_counts(list_depth, 0);
   for (int64_t i = 0; i < total_levels; i++) {
-    int16_t rep_level = rep_levels[i];
-    if (rep_level < max_rep_level) {
-      for (int64_t j = rep_level; j < list_depth; j++) {
-        if (j == (list_depth - 1)) {
-          RETURN_NOT_OK(offset_builders[j]->Append(values_offset));
-        } else {
-          RETURN_NOT_OK(offset_builders[j]->Append(
-              static_cast<int32_t>(offset_builders[j + 1]->length())));
-        }
-
-        if (((empty_def_level[j] - 1) == def_levels[i]) && (nullable[j])) {
-          RETURN_NOT_OK(valid_bits_builders[j]->Append(false));
-          null_counts[j]++;
-          break;
-        } else {
-          RETURN_NOT_OK(valid_bits_builders[j]->Append(true));
-          if (empty_def_level[j] == def_levels[i]) {
+    const int16_t current_rep_level = rep_levels[i];
+    const int16_t current_def_level = def_levels[i];
+    if (current_rep_level < max_rep_level) {
+      for (int64_t j = current_rep_level; j < list_depth; j++) {
+        append_offset(j, values_offset);
+
+        if (nullable[j]) {
+          if ((empty_def_level[j] - 1) == current_def_level) {
+            valid_bits_builders[j].UnsafeAppend(false);
+            null_counts[j]++;
             break;
           }
+          valid_bits_builders[j].UnsafeAppend(true);
+        }
+        if (empty_def_level[j] == current_def_level) {
+          break;
         }
       }
     }
-    if (def_levels[i] >= values_def_level) {
+    if (current_def_level >= values_def_level) {
       values_offset++;
     }
   }
   // Add the final offset to all lists
   for (int64_t j = 0; j < list_depth; j++) {
-    if (j == (list_depth - 1)) {
-      RETURN_NOT_OK(offset_builders[j]->Append(values_offset));
-    } else {
-      RETURN_NOT_OK(offset_builders[j]->Append(
-          static_cast<int32_t>(offset_builders[j + 1]->length())));
-    }
+    append_offset(j, values_offset);
   }
 
-  std::vector<std::shared_ptr<Buffer>> offsets;
-  std::vector<std::shared_ptr<Buffer>> valid_bits;
-  std::vector<int64_t> list_lengths;
+  std::vector<std::shared_ptr<Buffer>> offsets(list_depth);
+  std::vector<std::shared_ptr<Buffer>> valid_bits(list_depth);
+  std::vector<int64_t> list_lengths(list_depth);
   for (int64_t j = 0; j < list_depth; j++) {
-    list_lengths.push_back(offset_builders[j]->length() - 1);
-    std::shared_ptr<Array> array;
-    RETURN_NOT_OK(offset_builders[j]->Finish(&array));
-    offsets.emplace_back(std::static_pointer_cast<Int32Array>(array)->values());
-    RETURN_NOT_OK(valid_bits_builders[j]->Finish(&array));
-    valid_bits.emplace_back(std::static_pointer_cast<BooleanArray>(array)->values());
+    list_lengths[j] = offset_builders[j].length() - 1;
+    RETURN_NOT_OK(offset_builders[j].Finish(&offsets[j]));
+    // Lists without nulls don't need a validity bitmap
+    if (null_counts[j] > 0) {
+      RETURN_NOT_OK(valid_bits_builders[j].Finish(&valid_bits[j]));
+    }
   }
 
   *out = arr;
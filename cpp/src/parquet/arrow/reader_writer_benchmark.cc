@@ -28,6 +28,7 @@
 #include "parquet/platform.h"
 
 #include "arrow/api.h"
+#include "arrow/buffer_builder.h"
 
 using arrow::BooleanBuilder;
 using arrow::NumericBuilder;
@@ -270,6 +271,94 @@ static void BM_ReadMultipleRowGroups(::benchmark::State& state) {
 
 BENCHMARK(BM_ReadMultipleRowGroups);
 
+// Number of elements of each list in the nested benchmarks
+constexpr int64_t kNestedListLength = 8;
+
+// Wrap int32 values into `depth` levels of lists. When nullable, every 10th
+// value is null and each level has an extra null list every 10 lists.
+static std::shared_ptr<::arrow::Table> MakeNestedListTable(int depth, bool nullable) {
+  const int64_t num_values = BENCHMARK_SIZE;
+  std::vector<int32_t> values(num_values, 128);
+  std::vector<bool> is_valid(num_values);
+  for (int64_t i = 0; i < num_values; i++) {
+    is_valid[i] = !nullable || (i % 10 != 0);
+  }
+  std::shared_ptr<::arrow::Array> array;
+  ::arrow::Int32Builder values_builder;
+  EXIT_NOT_OK(values_builder.AppendValues(values, is_valid));
+  EXIT_NOT_OK(values_builder.Finish(&array));
+  auto field = ::arrow::field("item", ::arrow::int32(), nullable);
+
+  for (int level = 0; level < depth; level++) {
+    const int64_t num_lists = array->length() / kNestedListLength;
+    ::arrow::TypedBufferBuilder<int32_t> offsets_builder;
+    ::arrow::TypedBufferBuilder<bool> valid_builder;
+    EXIT_NOT_OK(offsets_builder.Reserve(num_lists * 2 + 1));
+    EXIT_NOT_OK(valid_builder.Reserve(num_lists * 2));
+    int64_t null_count = 0;
+    for (int64_t i = 0; i < num_lists; i++) {
+      const int32_t offset = static_cast<int32_t>(i * kNestedListLength);
+      if (nullable && i % 10 == 5) {
+        offsets_builder.UnsafeAppend(offset);
+        valid_builder.UnsafeAppend(false);
+        ++null_count;
+      }
+      offsets_builder.UnsafeAppend(offset);
+      valid_builder.UnsafeAppend(true);
+    }
+    const int64_t length = valid_builder.length();
+    offsets_builder.UnsafeAppend(static_cast<int32_t>(num_lists * kNestedListLength));
+    std::shared_ptr<Buffer> offsets_buffer, valid_buffer;
+    EXIT_NOT_OK(offsets_builder.Finish(&offsets_buffer));
+    EXIT_NOT_OK(valid_builder.Finish(&valid_buffer));
+
+    auto type = ::arrow::list(field);
+    array = std::make_shared<::arrow::ListArray>(type, length, offsets_buffer, array,
+                                                 null_count > 0 ? valid_buffer : nullptr,
+                                                 null_count);
+    field = ::arrow::field("list", type, nullable);
+  }
+  return ::arrow::Table::Make(::arrow::schema({field}), {array});
+}
+
+static void BM_WriteListColumn(::benchmark::State& state) {
+  std::shared_ptr<::arrow::Table> table =
+      MakeNestedListTable(static_cast<int>(state.range(0)), state.range(1) != 0);
+
+  while (state.KeepRunning()) {
+    auto output = CreateOutputStream();
+    EXIT_NOT_OK(
+        WriteTable(*table, ::arrow::default_memory_pool(), output, BENCHMARK_SIZE));
+  }
+  state.SetBytesProcessed(state.iterations() * BENCHMARK_SIZE * sizeof(int32_t));
+}
+
+// Arguments: list depth, nullable
+BENCHMARK(BM_WriteListColumn)->Args({1, 0})->Args({1, 1})->Args({2, 0})->Args({2, 1});
+
+static void BM_ReadListColumn(::benchmark::State& state) {
+  std::shared_ptr<::arrow::Table> table =
+      MakeNestedListTable(static_cast<int>(state.range(0)), state.range(1) != 0);
+  auto output = CreateOutputStream();
+  EXIT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), output, BENCHMARK_SIZE));
+
+  std::shared_ptr<Buffer> buffer;
+  PARQUET_THROW_NOT_OK(output->Finish(&buffer));
+
+  while (state.KeepRunning()) {
+    auto reader =
+        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+    std::unique_ptr<FileReader> arrow_reader;
+    EXIT_NOT_OK(FileReader::Make(::arrow::default_memory_pool(), std::move(reader),
+                                 &arrow_reader));
+    std::shared_ptr<::arrow::Table> table;
+    EXIT_NOT_OK(arrow_reader->ReadTable(&table));
+  }
+  state.SetBytesProcessed(state.iterations() * BENCHMARK_SIZE * sizeof(int32_t));
+}
+
+BENCHMARK(BM_ReadListColumn)->Args({1, 0})->Args({1, 1})->Args({2, 0})->Args({2, 1});
+
 }  // namespace benchmark
 
 }  // namespace parquet
@@ -114,6 +114,8 @@ class LevelBuilder {
     // Min offset isn't always zero in the case of sliced Arrays.
     min_offset_idx_ = array.value_offset(min_offset_idx_);
     max_offset_idx_ = array.value_offset(max_offset_idx_);
+    // Every child slot yields at most one level
+    max_num_levels_ += max_offset_idx_ - min_offset_idx_;
 
     return VisitInline(*array.values());
   }
@@ -159,6 +161,7 @@ class LevelBuilder {
     // Work downwards to extract bitmaps and offsets
     min_offset_idx_ = 0;
     max_offset_idx_ = array.length();
+    max_num_levels_ = array.length();
     RETURN_NOT_OK(VisitInline(array));
     *num_values = max_offset_idx_ - min_offset_idx_;
     *values_offset = min_offset_idx_;
@@ -194,13 +197,14 @@ class LevelBuilder {
       }
       *num_levels = array.length();
     } else {
-      // Note it is hard to estimate memory consumption due to zero length
-      // arrays otherwise we would preallocate.  An upper boun on memory
-      // is the sum of the length of each list array  + number of elements
-      // but this might be too loose of an upper bound so we choose to use
-      // safe methods.
-      RETURN_NOT_OK(rep_levels_.Append(0));
-      RETURN_NOT_OK(HandleListEntries(0, 0, 0, array.length()));
+      // Each level is produced either by a leaf value or by a null or empty
+      // list, so the sum of the lengths of the list arrays and of the values
+      // is an upper bound on the number of levels. Reserve it up front and
+      // generate the levels without per-level checks.
+      RETURN_NOT_OK(def_levels_.Reserve(max_num_levels_));
+      RETURN_NOT_OK(rep_levels_.Reserve(max_num_levels_));
+      rep_levels_.UnsafeAppend(0);
+      HandleListEntries(0, 0, 0, array.length());
 
       RETURN_NOT_OK(def_levels_.Finish(def_levels_out));
       RETURN_NOT_OK(rep_levels_.Finish(rep_levels_out));
@@ -210,72 +214,71 @@ class LevelBuilder {
     return Status::OK();
   }
 
-  Status HandleList(int16_t def_level, int16_t rep_level, int64_t index) {
+  void HandleList(int16_t def_level, int16_t rep_level, int64_t index) {
     if (nullable_[rep_level]) {
       if (null_counts_[rep_level] == 0 ||
           BitUtil::GetBit(valid_bitmaps_[rep_level], index + array_offsets_[rep_level])) {
-        return HandleNonNullList(static_cast<int16_t>(def_level + 1), rep_level, index);
+        HandleNonNullList(static_cast<int16_t>(def_level + 1), rep_level, index);
       } else {
-        return def_levels_.Append(def_level);
+        def_levels_.UnsafeAppend(def_level);
       }
     } else {
-      return HandleNonNullList(def_level, rep_level, index);
+      HandleNonNullList(def_level, rep_level, index);
     }
   }
 
-  Status HandleNonNullList(int16_t def_level, int16_t rep_level, int64_t index) {
+  void HandleNonNullList(int16_t def_level, int16_t rep_level, int64_t index) {
     const int32_t inner_offset = offsets_[rep_level][index];
     const int32_t inner_length = offsets_[rep_level][index + 1] - inner_offset;
     const int64_t recursion_level = rep_level + 1;
     if (inner_length == 0) {
-      return def_levels_.Append(def_level);
+      def_levels_.UnsafeAppend(def_level);
+      return;
     }
     if (recursion_level < static_cast<int64_t>(offsets_.size())) {
-      return HandleListEntries(static_cast<int16_t>(def_level + 1),
-                               static_cast<int16_t>(rep_level + 1), inner_offset,
-                               inner_length);
+      HandleListEntries(static_cast<int16_t>(def_level + 1),
+                        static_cast<int16_t>(rep_level + 1), inner_offset, inner_length);
+      return;
     }
     // We have reached the leaf: primitive list, handle remaining nullables
     const bool nullable_level = nullable_[recursion_level];
     const int64_t level_null_count = null_counts_[recursion_level];
     const uint8_t* level_valid_bitmap = valid_bitmaps_[recursion_level];
 
-    if (inner_length >= 1) {
-      RETURN_NOT_OK(
-          rep_levels_.Append(inner_length - 1, static_cast<int16_t>(rep_level + 1)));
-    }
+    rep_levels_.UnsafeAppend(inner_length - 1, static_cast<int16_t>(rep_level + 1));
 
     // Special case: this is a null array (all elements are null)
     if (level_null_count && level_valid_bitmap == nullptr) {
-      return def_levels_.Append(inner_length, static_cast<int16_t>(def_level + 1));
+      def_levels_.UnsafeAppend(inner_length, static_cast<int16_t>(def_level + 1));
+      return;
     }
-    for (int64_t i = 0; i < inner_length; i++) {
-      if (nullable_level &&
-          ((level_null_count == 0) ||
-           BitUtil::GetBit(level_valid_bitmap,
-                           inner_offset + i + array_offsets_[recursion_level]))) {
-        // Non-null element in a null level
-        RETURN_NOT_OK(def_levels_.Append(static_cast<int16_t>(def_level + 2)));
-      } else {
-        // This can be produced in two cases:
-        //  * elements are nullable and this one is null
-        //   (i.e. max_def_level = def_level + 2)
-        //  * elements are non-nullable (i.e. max_def_level = def_level + 1)
-        RETURN_NOT_OK(def_levels_.Append(static_cast<int16_t>(def_level + 1)));
+    if (nullable_level && level_null_count == 0) {
+      // All elements are non-null in a nullable level
+      def_levels_.UnsafeAppend(inner_length, static_cast<int16_t>(def_level + 2));
+    } else if (!nullable_level) {
+      // Elements are non-nullable (i.e. max_def_level = def_level + 1)
+      def_levels_.UnsafeAppend(inner_length, static_cast<int16_t>(def_level + 1));
+    } else {
+      // Nullable elements, some of them null (i.e. max_def_level = def_level + 2)
+      ::arrow::internal::BitmapReader valid_bits_reader(
+          level_valid_bitmap, inner_offset + array_offsets_[recursion_level],
+          inner_length);
+      for (int64_t i = 0; i < inner_length; i++) {
+        def_levels_.UnsafeAppend(
+            static_cast<int16_t>(def_level + (valid_bits_reader.IsSet() ? 2 : 1)));
+        valid_bits_reader.Next();
       }
     }
-    return Status::OK();
   }
 
-  Status HandleListEntries(int16_t def_level, int16_t rep_level, int64_t offset,
-                           int64_t length) {
+  void HandleListEntries(int16_t def_level, int16_t rep_level, int64_t offset,
+                         int64_t length) {
     for (int64_t i = 0; i < length; i++) {
       if (i > 0) {
-        RETURN_NOT_OK(rep_levels_.Append(rep_level));
+        rep_levels_.UnsafeAppend(rep_level);
       }
-      RETURN_NOT_OK(HandleList(def_level, rep_level, offset + i));
+      HandleList(def_level, rep_level, offset + i);
     }
-    return Status::OK();
   }
 
  private:
@@ -293,6 +296,7 @@ class LevelBuilder {
 
   int64_t min_offset_idx_;
   int64_t max_offset_idx_;
+  int64_t max_num_levels_;
   std::shared_ptr<Array> values_array_;
 };
 
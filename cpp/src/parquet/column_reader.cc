@@ -30,6 +30,7 @@
 
 #include "arrow/array.h"
 #include "arrow/builder.h"
+#include "arrow/io/memory.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/util/bit_stream_utils.h"
@@ -361,6 +362,131 @@ std::unique_ptr<PageReader> PageReader::Open(
       new SerializedPageReader(stream, total_num_rows, codec, pool, ctx));
 }
 
+namespace {
+
+// Yields the pages of each of its readers in turn
+class ConcatenatedPageReader : public PageReader {
+ public:
+  explicit ConcatenatedPageReader(std::vector<std::unique_ptr<PageReader>> readers)
+      : readers_(std::move(readers)), current_(0) {}
+
+  std::shared_ptr<Page> NextPage() override {
+    while (current_ < readers_.size()) {
+      std::shared_ptr<Page> page = readers_[current_]->NextPage();
+      if (page != nullptr) {
+        return page;
+      }
+      ++current_;
+    }
+    return std::shared_ptr<Page>(nullptr);
+  }
+
+  void set_max_page_header_size(uint32_t size) override {
+    for (auto& reader : readers_) {
+      reader->set_max_page_header_size(size);
+    }
+  }
+
+ private:
+  std::vector<std::unique_ptr<PageReader>> readers_;
+  size_t current_;
+};
+
+struct PageLocation {
+  int64_t offset;
+  int64_t length;
+  int64_t num_values;
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<PageReader>> PageReader::OpenPartitions(
+    const std::shared_ptr<Buffer>& column_chunk, Compression::type codec,
+    int max_partitions, ::arrow::MemoryPool* pool) {
+  // Locate the pages, skipping over their (compressed) bodies
+  const uint8_t* data = column_chunk->data();
+  const int64_t size = column_chunk->size();
+  bool has_dictionary_page = false;
+  int64_t dictionary_page_length = 0;
+  std::vector<PageLocation> data_pages;
+  int64_t total_num_values = 0;
+
+  int64_t position = 0;
+  while (position < size) {
+    format::PageHeader header;
+    uint32_t header_size = static_cast<uint32_t>(
+        std::min<int64_t>(size - position, kDefaultMaxPageHeaderSize));
+    DeserializeThriftMsg(data + position, &header_size, &header);
+    const int64_t page_length = header_size + header.compressed_page_size;
+    if (position + page_length > size) {
+      ParquetException::EofException("Page extends past the end of the column chunk");
+    }
+
+    if (header.type == format::PageType::DICTIONARY_PAGE) {
+      if (position != 0) {
+        throw ParquetException("Dictionary page must be the first page of a chunk");
+      }
+      has_dictionary_page = true;
+      dictionary_page_length = page_length;
+    } else if (header.type == format::PageType::DATA_PAGE ||
+               header.type == format::PageType::DATA_PAGE_V2) {
+      const int64_t num_values = header.type == format::PageType::DATA_PAGE
+                                     ? header.data_page_header.num_values
+                                     : header.data_page_header_v2.num_values;
+      data_pages.push_back({position, page_length, num_values});
+      total_num_values += num_values;
+    } else if (!data_pages.empty()) {
+      // Other pages are skipped by the reader; keep them inside the partition
+      data_pages.back().length = position + page_length - data_pages.back().offset;
+    }
+    position += page_length;
+  }
+
+  // Split the data pages into runs of roughly equal byte size
+  const int64_t num_partitions =
+      std::max<int64_t>(1, std::min<int64_t>(max_partitions, data_pages.size()));
+  const int64_t data_length = position - dictionary_page_length;
+
+  std::vector<std::unique_ptr<PageReader>> partitions;
+  size_t page_index = 0;
+  while (page_index < data_pages.size()) {
+    const int64_t start = data_pages[page_index].offset;
+    const int64_t target_end =
+        dictionary_page_length +
+        data_length * static_cast<int64_t>(partitions.size() + 1) / num_partitions;
+    int64_t end = start;
+    int64_t num_values = 0;
+    do {
+      end = data_pages[page_index].offset + data_pages[page_index].length;
+      num_values += data_pages[page_index].num_values;
+      ++page_index;
+    } while (page_index < data_pages.size() && end < target_end);
+
+    std::vector<std::unique_ptr<PageReader>> readers;
+    if (has_dictionary_page) {
+      // The stream ends right after the dictionary page
+      auto dictionary_page =
+          ::arrow::SliceBuffer(column_chunk, 0, dictionary_page_length);
+      readers.push_back(PageReader::Open(
+          std::make_shared<::arrow::io::BufferReader>(dictionary_page), num_values, codec,
+          pool));
+    }
+    auto data_pages_run = ::arrow::SliceBuffer(column_chunk, start, end - start);
+    readers.push_back(
+        PageReader::Open(std::make_shared<::arrow::io::BufferReader>(data_pages_run),
+                         num_values, codec, pool));
+    partitions.emplace_back(new ConcatenatedPageReader(std::move(readers)));
+  }
+
+  if (partitions.empty()) {
+    // No data pages at all
+    partitions.push_back(PageReader::Open(
+        std::make_shared<::arrow::io::BufferReader>(column_chunk), total_num_values,
+        codec, pool));
+  }
+  return partitions;
+}
+
 // ----------------------------------------------------------------------
 // Impl base class for TypedColumnReader and RecordReader
 
@@ -879,7 +1005,10 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
  public:
   using T = typename DType::c_type;
   using BASE = ColumnReaderImplBase<DType>;
-  TypedRecordReader(const ColumnDescriptor* descr, MemoryPool* pool) : BASE(descr, pool) {
+  TypedRecordReader(const ColumnDescriptor* descr, MemoryPool* pool,
+                    bool read_dictionary = false)
+      : BASE(descr, pool) {
+    read_dictionary_ = read_dictionary;
     nullable_values_ = internal::HasSpacedValues(descr);
     at_record_start_ = true;
     records_read_ = 0;
@@ -889,7 +1018,9 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     levels_written_ = 0;
     levels_position_ = 0;
     levels_capacity_ = 0;
-    uses_values_ = !(descr->physical_type() == Type::BYTE_ARRAY);
+    // Values are accumulated directly into builders for BYTE_ARRAY columns and
+    // for columns read as dictionary-encoded
+    uses_values_ = !(read_dictionary || descr->physical_type() == Type::BYTE_ARRAY);
 
     if (uses_values_) {
       values_ = AllocateBuffer(pool);
@@ -1340,28 +1471,35 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
-class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
-                                        virtual public DictionaryRecordReader {
+/// \brief Reads dictionary-encoded data pages directly into a
+/// Dictionary32Builder: the dictionary page is inserted into the builder's memo
+/// and the RLE-encoded indices are appended without materializing values.
+/// Pages which have fallen back to a non-dictionary encoding are hashed into
+/// the same builder.
+template <typename DType>
+class DictionaryRecordReaderImpl : public TypedRecordReader<DType>,
+                                   virtual public DictionaryRecordReader {
  public:
-  ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr,
-                                  ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, pool), builder_(pool) {
-    this->read_dictionary_ = true;
-  }
+  DictionaryRecordReaderImpl(const ColumnDescriptor* descr, ::arrow::MemoryPool* pool)
+      : TypedRecordReader<DType>(descr, pool, /*read_dictionary=*/true),
+        builder_(GetDictionaryValueType(descr), pool) {}
 
   std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
     FlushBuilder();
-    return std::make_shared<::arrow::ChunkedArray>(result_chunks_, builder_.type());
+    std::vector<std::shared_ptr<::arrow::Array>> result;
+    std::swap(result, result_chunks_);
+    return std::make_shared<::arrow::ChunkedArray>(std::move(result), builder_.type());
   }
 
   void FlushBuilder() {
     if (builder_.length() > 0) {
       std::shared_ptr<::arrow::Array> chunk;
       PARQUET_THROW_NOT_OK(builder_.Finish(&chunk));
-      result_chunks_.emplace_back(std::move(chunk));
+      result_chunks_.emplace_back(ShareDictionary(std::move(chunk)));
 
-      // Also clears the dictionary memo table
-      builder_.ResetFull();
+      // Keep the dictionary memo table, as the current dictionary page may
+      // still have indices left to decode
+      builder_.Reset();
     }
   }
 
@@ -1370,7 +1508,8 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
       /// If there is a new dictionary, we may need to flush the builder, then
       /// insert the new dictionary values
       FlushBuilder();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      builder_.ResetFull();
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       decoder->InsertDictionary(&builder_);
       this->new_dictionary_ = false;
     }
@@ -1378,44 +1517,81 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
 
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
           static_cast<int>(values_to_read), &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
   void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndicesSpaced(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrow(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
 
       /// Flush values since they have been copied into the builder
-      ResetValues();
+      this->ResetValues();
     }
     DCHECK_EQ(num_decoded, values_to_read - null_count);
   }
 
+  void DebugPrintState() override {}
+
  private:
-  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
+  static std::shared_ptr<::arrow::DataType> GetDictionaryValueType(
+      const ColumnDescriptor* descr) {
+    switch (descr->physical_type()) {
+      case Type::INT32:
+        return ::arrow::int32();
+      case Type::INT64:
+        return ::arrow::int64();
+      case Type::FLOAT:
+        return ::arrow::float32();
+      case Type::DOUBLE:
+        return ::arrow::float64();
+      case Type::BYTE_ARRAY:
+        return ::arrow::binary();
+      case Type::FIXED_LEN_BYTE_ARRAY:
+        return ::arrow::fixed_size_binary(descr->type_length());
+      default:
+        throw ParquetException("Cannot read column of physical type " +
+                               TypeToString(descr->physical_type()) +
+                               " as dictionary-encoded");
+    }
+  }
+
+  // Consecutive row groups often carry identical dictionaries; have their
+  // chunks share the previously emitted dictionary rather than each holding
+  // its own copy
+  std::shared_ptr<::arrow::Array> ShareDictionary(std::shared_ptr<::arrow::Array> chunk) {
+    const auto& dict_chunk = checked_cast<const ::arrow::DictionaryArray&>(*chunk);
+    if (last_dictionary_ != nullptr &&
+        last_dictionary_->Equals(*dict_chunk.dictionary())) {
+      return std::make_shared<::arrow::DictionaryArray>(
+          dict_chunk.type(), dict_chunk.indices(), last_dictionary_);
+    }
+    last_dictionary_ = dict_chunk.dictionary();
+    return chunk;
+  }
 
-  ::arrow::BinaryDictionary32Builder builder_;
+  typename EncodingTraits<DType>::DictAccumulator builder_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
+  std::shared_ptr<::arrow::Array> last_dictionary_;
 };
 
 // TODO(wesm): Implement these to some satisfaction
@@ -1428,19 +1604,34 @@ void TypedRecordReader<ByteArrayType>::DebugPrintState() {}
 template <>
 void TypedRecordReader<FLBAType>::DebugPrintState() {}
 
-std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor* descr,
-                                                        arrow::MemoryPool* pool,
-                                                        bool read_dictionary) {
-  if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, pool);
-  } else {
-    return std::make_shared<ByteArrayChunkedRecordReader>(descr, pool);
+std::shared_ptr<RecordReader> MakeDictionaryRecordReader(const ColumnDescriptor* descr,
+                                                         arrow::MemoryPool* pool) {
+  switch (descr->physical_type()) {
+    case Type::INT32:
+      return std::make_shared<DictionaryRecordReaderImpl<Int32Type>>(descr, pool);
+    case Type::INT64:
+      return std::make_shared<DictionaryRecordReaderImpl<Int64Type>>(descr, pool);
+    case Type::FLOAT:
+      return std::make_shared<DictionaryRecordReaderImpl<FloatType>>(descr, pool);
+    case Type::DOUBLE:
+      return std::make_shared<DictionaryRecordReaderImpl<DoubleType>>(descr, pool);
+    case Type::BYTE_ARRAY:
+      return std::make_shared<DictionaryRecordReaderImpl<ByteArrayType>>(descr, pool);
+    case Type::FIXED_LEN_BYTE_ARRAY:
+      return std::make_shared<DictionaryRecordReaderImpl<FLBAType>>(descr, pool);
+    default:
+      throw ParquetException("Cannot read column of physical type " +
+                             TypeToString(descr->physical_type()) +
+                             " as dictionary-encoded");
   }
 }
 
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                  MemoryPool* pool,
                                                  const bool read_dictionary) {
+  if (read_dictionary) {
+    return MakeDictionaryRecordReader(descr, pool);
+  }
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, pool);
@@ -1455,7 +1646,7 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
     case Type::DOUBLE:
       return std::make_shared<TypedRecordReader<DoubleType>>(descr, pool);
     case Type::BYTE_ARRAY:
-      return MakeByteArrayRecordReader(descr, pool, read_dictionary);
+      return std::make_shared<ByteArrayChunkedRecordReader>(descr, pool);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<FLBARecordReader>(descr, pool);
     default: {
@@ -101,6 +101,15 @@ class PARQUET_EXPORT PageReader {
       Compression::type codec, ::arrow::MemoryPool* pool = ::arrow::default_memory_pool(),
       const CryptoContext* ctx = NULLPTR);
 
+  // Split an unencrypted column chunk, loaded in memory, into at most
+  // max_partitions page readers over contiguous runs of data pages. Page
+  // boundaries are located from the page headers alone; nothing is decompressed
+  // or decoded here. Each reader yields the dictionary page first, if any, so
+  // that the partitions can be decoded independently and concurrently.
+  static std::vector<std::unique_ptr<PageReader>> OpenPartitions(
+      const std::shared_ptr<Buffer>& column_chunk, Compression::type codec,
+      int max_partitions, ::arrow::MemoryPool* pool = ::arrow::default_memory_pool());
+
   // @returns: shared_ptr<Page>(nullptr) on EOS, std::shared_ptr<Page>
   // containing new Page otherwise
   virtual std::shared_ptr<Page> NextPage() = 0;
@@ -304,7 +313,7 @@ class BinaryRecordReader : virtual public RecordReader {
 };
 
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
-/// indices). Only valid for BYTE_ARRAY columns
+/// indices). Valid for all physical types except BOOLEAN and INT96
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
@@ -1515,9 +1515,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
       bit_reader.Next();
     }
 
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+    AppendIndices(indices_buffer, num_values, valid_bytes.data(), builder);
     num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -1537,13 +1535,20 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
+    AppendIndices(indices_buffer, num_values, /*valid_bytes=*/nullptr, builder);
     num_values_ -= num_values;
     return num_values;
   }
 
  protected:
+  // Append decoded indices to a Dictionary32Builder of the matching value type
+  void AppendIndices(const int32_t* indices, int64_t length, const uint8_t* valid_bytes,
+                     arrow::ArrayBuilder* builder) {
+    auto dict_builder =
+        checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+    PARQUET_THROW_NOT_OK(dict_builder->AppendIndices(indices, length, valid_bytes));
+  }
+
   inline void DecodeDict(TypedDecoder<Type>* dictionary) {
     dictionary_length_ = static_cast<int32_t>(dictionary->values_left());
     PARQUET_THROW_NOT_OK(dictionary_->Resize(dictionary_length_ * sizeof(T),
@@ -1790,9 +1795,50 @@ int DictDecoderImpl<Type>::DecodeArrow(
   return num_values - null_count;
 }
 
+template <>
+void DictDecoderImpl<BooleanType>::AppendIndices(const int32_t* indices, int64_t length,
+                                                 const uint8_t* valid_bytes,
+                                                 arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("No dictionary encoding for BooleanType");
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::AppendIndices(const int32_t* indices, int64_t length,
+                                               const uint8_t* valid_bytes,
+                                               arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("Dictionary indices for Int96Type");
+}
+
 template <typename Type>
 void DictDecoderImpl<Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
-  ParquetException::NYI("InsertDictionary only implemented for BYTE_ARRAY types");
+  using ArrowType = typename EncodingTraits<Type>::ArrowType;
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+
+  // Make a NumericArray referencing the internal dictionary data
+  arrow::NumericArray<ArrowType> arr(dictionary_length_, dictionary_);
+  PARQUET_THROW_NOT_OK(dict_builder->InsertMemoValues(arr));
+}
+
+template <>
+void DictDecoderImpl<BooleanType>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("No dictionary encoding for BooleanType");
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("InsertDictionary for Int96Type");
+}
+
+template <>
+void DictDecoderImpl<FLBAType>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  auto fixed_builder =
+      checked_cast<typename EncodingTraits<FLBAType>::DictAccumulator*>(builder);
+
+  // Make a FixedSizeBinaryArray referencing the internal dictionary data
+  arrow::FixedSizeBinaryArray arr(arrow::fixed_size_binary(descr_->type_length()),
+                                  dictionary_length_, byte_array_data_);
+  PARQUET_THROW_NOT_OK(fixed_builder->InsertMemoValues(arr));
 }
 
 template <>
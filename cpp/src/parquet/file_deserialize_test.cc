@@ -17,6 +17,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <memory>
@@ -307,6 +308,56 @@ TEST_F(TestPageSerde, LZONotSupported) {
   ASSERT_THROW(InitSerializedPageReader(data_size, Compression::LZO), ParquetException);
 }
 
+TEST_F(TestPageSerde, OpenPartitions) {
+  const int num_data_pages = 7;
+  const int32_t page_size = 64;
+  std::vector<uint8_t> faux_data(page_size);
+
+  format::DictionaryPageHeader dict_header;
+  dict_header.num_values = 5;
+  dict_header.encoding = format::Encoding::PLAIN;
+  format::PageHeader dict_page_header;
+  dict_page_header.__set_dictionary_page_header(dict_header);
+  dict_page_header.type = format::PageType::DICTIONARY_PAGE;
+  dict_page_header.uncompressed_page_size = page_size;
+  dict_page_header.compressed_page_size = page_size;
+  ThriftSerializer serializer;
+  ASSERT_NO_THROW(serializer.Serialize(&dict_page_header, out_stream_.get()));
+  ASSERT_OK(out_stream_->Write(faux_data.data(), page_size));
+
+  for (int i = 0; i < num_data_pages; ++i) {
+    data_page_header_.num_values = 100 + i;
+    ASSERT_NO_FATAL_FAILURE(WriteDataPageHeader(1024, page_size, page_size));
+    ASSERT_OK(out_stream_->Write(faux_data.data(), page_size));
+  }
+  EndStream();
+
+  for (int max_partitions : {1, 3, 7, 20}) {
+    auto partitions = PageReader::OpenPartitions(out_buffer_, Compression::UNCOMPRESSED,
+                                                 max_partitions);
+    ASSERT_EQ(std::min(max_partitions, num_data_pages),
+              static_cast<int>(partitions.size()));
+
+    // Every partition starts with the dictionary page, followed by a
+    // contiguous run of the data pages
+    int expected_num_values = 100;
+    for (auto& partition : partitions) {
+      std::shared_ptr<Page> page = partition->NextPage();
+      ASSERT_NE(nullptr, page);
+      ASSERT_EQ(PageType::DICTIONARY_PAGE, page->type());
+      int num_pages = 0;
+      while ((page = partition->NextPage()) != nullptr) {
+        ASSERT_EQ(PageType::DATA_PAGE, page->type());
+        ASSERT_EQ(expected_num_values++,
+                  static_cast<const DataPageV1&>(*page).num_values());
+        ++num_pages;
+      }
+      ASSERT_GT(num_pages, 0);
+    }
+    ASSERT_EQ(100 + num_data_pages, expected_num_values);
+  }
+}
+
 // ----------------------------------------------------------------------
 // File structure tests
 
@@ -22,6 +22,7 @@
 #include <cstring>
 #include <memory>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <utility>
 
@@ -76,6 +77,21 @@ std::unique_ptr<PageReader> RowGroupReader::GetColumnPageReader(int i) {
   return contents_->GetColumnPageReader(i);
 }
 
+std::vector<std::unique_ptr<PageReader>> RowGroupReader::GetColumnPageReaders(
+    int i, int max_partitions) {
+  DCHECK(i < metadata()->num_columns())
+      << "The RowGroup only has " << metadata()->num_columns()
+      << "columns, requested column: " << i;
+  return contents_->GetColumnPageReaders(i, max_partitions);
+}
+
+std::vector<std::unique_ptr<PageReader>> RowGroupReader::Contents::GetColumnPageReaders(
+    int i, int max_partitions) {
+  std::vector<std::unique_ptr<PageReader>> result;
+  result.push_back(GetColumnPageReader(i));
+  return result;
+}
+
 // Returns the rowgroup metadata
 const RowGroupMetaData* RowGroupReader::metadata() const { return contents_->metadata(); }
 
@@ -102,26 +118,8 @@ class SerializedRowGroup : public RowGroupReader::Contents {
     // Read column chunk from the file
     auto col = row_group_metadata_->ColumnChunk(i, row_group_ordinal_, file_decryptor_);
 
-    int64_t col_start = col->data_page_offset();
-    if (col->has_dictionary_page() && col->dictionary_page_offset() > 0 &&
-        col_start > col->dictionary_page_offset()) {
-      col_start = col->dictionary_page_offset();
-    }
-
-    int64_t col_length = col->total_compressed_size();
-
-    // PARQUET-816 workaround for old files created by older parquet-mr
-    const ApplicationVersion& version = file_metadata_->writer_version();
-    if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
-      // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
-      // dictionary page header size in total_compressed_size and total_uncompressed_size
-      // (see IMPALA-694). We add padding to compensate.
-      int64_t size = -1;
-      PARQUET_THROW_NOT_OK(source_->GetSize(&size));
-      int64_t bytes_remaining = size - (col_start + col_length);
-      int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
-      col_length += padding;
-    }
+    int64_t col_start, col_length;
+    ComputeColumnChunkRange(*col, &col_start, &col_length);
 
     std::shared_ptr<ArrowInputStream> stream =
         properties_.GetStream(source_, col_start, col_length);
@@ -162,7 +160,58 @@ class SerializedRowGroup : public RowGroupReader::Contents {
                             properties_.memory_pool(), &ctx);
   }
 
+  std::vector<std::unique_ptr<PageReader>> GetColumnPageReaders(
+      int i, int max_partitions) override {
+    auto col = row_group_metadata_->ColumnChunk(i, row_group_ordinal_, file_decryptor_);
+
+    // Encrypted pages depend on their ordinal, and padded chunks (see
+    // ComputeColumnChunkRange) don't end on a page boundary
+    const ApplicationVersion& version = file_metadata_->writer_version();
+    if (max_partitions <= 1 || col->crypto_metadata() != nullptr ||
+        version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
+      return RowGroupReader::Contents::GetColumnPageReaders(i, max_partitions);
+    }
+
+    int64_t col_start, col_length;
+    ComputeColumnChunkRange(*col, &col_start, &col_length);
+
+    std::shared_ptr<Buffer> data;
+    PARQUET_THROW_NOT_OK(source_->ReadAt(col_start, col_length, &data));
+    if (data->size() != col_length) {
+      std::stringstream ss;
+      ss << "Tried reading " << col_length << " bytes starting at position " << col_start
+         << " from file but only got " << data->size();
+      throw ParquetException(ss.str());
+    }
+    return PageReader::OpenPartitions(data, col->compression(), max_partitions,
+                                      properties_.memory_pool());
+  }
+
  private:
+  void ComputeColumnChunkRange(const ColumnChunkMetaData& col, int64_t* col_start,
+                               int64_t* col_length) {
+    *col_start = col.data_page_offset();
+    if (col.has_dictionary_page() && col.dictionary_page_offset() > 0 &&
+        *col_start > col.dictionary_page_offset()) {
+      *col_start = col.dictionary_page_offset();
+    }
+
+    *col_length = col.total_compressed_size();
+
+    // PARQUET-816 workaround for old files created by older parquet-mr
+    const ApplicationVersion& version = file_metadata_->writer_version();
+    if (version.VersionLt(ApplicationVersion::PARQUET_816_FIXED_VERSION())) {
+      // The Parquet MR writer had a bug in 1.2.8 and below where it didn't include the
+      // dictionary page header size in total_compressed_size and total_uncompressed_size
+      // (see IMPALA-694). We add padding to compensate.
+      int64_t size = -1;
+      PARQUET_THROW_NOT_OK(source_->GetSize(&size));
+      int64_t bytes_remaining = size - (*col_start + *col_length);
+      int64_t padding = std::min<int64_t>(kMaxDictHeaderSize, bytes_remaining);
+      *col_length += padding;
+    }
+  }
+
   std::shared_ptr<ArrowInputFile> source_;
   FileMetaData* file_metadata_;
   std::unique_ptr<RowGroupMetaData> row_group_metadata_;
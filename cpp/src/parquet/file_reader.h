@@ -43,6 +43,8 @@ class PARQUET_EXPORT RowGroupReader {
   struct Contents {
     virtual ~Contents() {}
     virtual std::unique_ptr<PageReader> GetColumnPageReader(int i) = 0;
+    virtual std::vector<std::unique_ptr<PageReader>> GetColumnPageReaders(
+        int i, int max_partitions);
     virtual const RowGroupMetaData* metadata() const = 0;
     virtual const ReaderProperties* properties() const = 0;
   };
@@ -58,6 +60,13 @@ class PARQUET_EXPORT RowGroupReader {
 
   std::unique_ptr<PageReader> GetColumnPageReader(int i);
 
+  // Split the column chunk into at most max_partitions page readers over
+  // contiguous runs of pages, which may be decoded concurrently. Fewer readers
+  // (possibly just one) are returned when the chunk has few data pages or
+  // cannot be split, e.g. when it is encrypted.
+  std::vector<std::unique_ptr<PageReader>> GetColumnPageReaders(int i,
+                                                                int max_partitions);
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
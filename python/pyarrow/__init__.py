@@ -46,7 +46,8 @@ except ImportError:
 
 import pyarrow.compat as compat
 
-from pyarrow.lib import cpu_count, set_cpu_count
+from pyarrow.lib import (cpu_count, set_cpu_count,
+                         io_thread_count, set_io_thread_count)
 from pyarrow.lib import (null, bool_,
                          int8, int16, int32, int64,
                          uint8, uint16, uint32, uint64,
@@ -66,6 +66,26 @@ def set_cpu_count(int count):
     check_status(SetCpuThreadPoolCapacity(count))
 
 
+def io_thread_count():
+    """
+    Return the number of threads to use for blocking I/O operations.
+
+    The number of threads is determined at startup by inspecting the
+    ``ARROW_IO_THREADS`` environment variable, and defaults to 8.
+    It can be modified at runtime by calling :func:`set_io_thread_count()`.
+    """
+    return GetIOThreadPoolCapacity()
+
+
+def set_io_thread_count(int count):
+    """
+    Set the number of threads to use for blocking I/O operations.
+    """
+    if count < 1:
+        raise ValueError("IO thread count must be strictly positive")
+    check_status(SetIOThreadPoolCapacity(count))
+
+
 Type_NA = _Type_NA
 Type_BOOL = _Type_BOOL
 Type_UINT8 = _Type_UINT8